@@ -1,5 +1,6 @@
 #include "binder/binder.h"
 #include "binder/expression/expression_util.h"
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/path_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression_visitor.h"
@@ -10,6 +11,7 @@
 #include "common/exception/binder.h"
 #include "common/keyword/rdf_keyword.h"
 #include "common/string_format.h"
+#include "common/string_utils.h"
 #include "function/cast/functions/cast_from_string_functions.h"
 #include "main/client_context.h"
 
@@ -364,9 +366,24 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
     bindRecursiveRelProjectionList(relProjectionList, relFields);
     auto relExtraInfo = std::make_unique<StructTypeInfo>(std::move(relFields));
     rel->getDataTypeReference().setExtraTypeInfo(std::move(relExtraInfo));
-    // Bind predicates in {}, e.g. [e* {date=1999-01-01}]
+    // Bind predicates in {}, e.g. [e* {date=1999-01-01}]. The internal key _weight names the rel
+    // property to weight a shortest path by instead, e.g. [e* SHORTEST {_weight: 'distance'}]. It
+    // is ambiguous if the rel has a property of that name.
+    auto relType = relPattern.getRelType();
+    std::shared_ptr<Expression> weightProperty;
     std::shared_ptr<Expression> relPredicate;
     for (auto& [propertyName, rhs] : relPattern.getPropertyKeyVals()) {
+        if (StringUtils::getUpper(propertyName) == InternalKeyword::WEIGHT) {
+            if (rel->hasPropertyExpression(propertyName)) {
+                throw BinderException(stringFormat(
+                    "{} of recursive rel {} is ambiguous with its property {}. Filter by the "
+                    "property in a WHERE predicate instead.",
+                    propertyName, relPattern.getVariableName(), propertyName));
+            }
+            weightProperty = bindRecursiveRelWeightProperty(relPattern, *rel, *rhs);
+            relType = QueryRelType::WEIGHTED_SHORTEST;
+            continue;
+        }
         auto boundLhs = expressionBinder.bindNodeOrRelPropertyExpression(*rel, propertyName);
         auto boundRhs = expressionBinder.bindExpression(*rhs);
         boundRhs = ExpressionBinder::implicitCastIfNecessary(boundRhs, boundLhs->dataType);
@@ -408,7 +425,7 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
     auto queryRel = make_shared<RelExpression>(
         *getRecursiveRelLogicalType(node->getDataType(), rel->getDataType()),
         getUniqueExpressionName(parsedName), parsedName, relTableIDs, std::move(srcNode),
-        std::move(dstNode), directionType, relPattern.getRelType());
+        std::move(dstNode), directionType, relType);
     auto lengthExpression = expressionBinder.createInternalLengthExpression(*queryRel);
     auto [lowerBound, upperBound] = bindVariableLengthRelBound(relPattern);
     auto recursiveInfo = std::make_unique<RecursiveInfo>();
@@ -421,12 +438,39 @@ std::shared_ptr<RelExpression> Binder::createRecursiveQueryRel(const parser::Rel
     recursiveInfo->nodePredicateExecFlag = std::move(nodePredicateExecutionFlag);
     recursiveInfo->nodePredicate = std::move(nodePredicate);
     recursiveInfo->relPredicate = std::move(relPredicate);
+    recursiveInfo->weightProperty = std::move(weightProperty);
     recursiveInfo->nodeProjectionList = std::move(nodeProjectionList);
     recursiveInfo->relProjectionList = std::move(relProjectionList);
     queryRel->setRecursiveInfo(std::move(recursiveInfo));
     return queryRel;
 }
 
+std::shared_ptr<Expression> Binder::bindRecursiveRelWeightProperty(
+    const parser::RelPattern& relPattern, const RelExpression& rel,
+    const parser::ParsedExpression& parsedWeight) {
+    if (relPattern.getRelType() != QueryRelType::SHORTEST) {
+        throw BinderException(stringFormat(
+            "Weighted recursive rel {} must be a shortest path.", relPattern.getVariableName()));
+    }
+    auto weight = expressionBinder.bindExpression(parsedWeight);
+    if (weight->expressionType != ExpressionType::LITERAL ||
+        weight->getDataType().getLogicalTypeID() != LogicalTypeID::STRING) {
+        throw BinderException(
+            stringFormat("Weight of recursive rel {} must be a rel property name.",
+                relPattern.getVariableName()));
+    }
+    auto literal = ku_dynamic_cast<Expression*, LiteralExpression*>(weight.get());
+    auto propertyName = literal->getValue()->getValue<std::string>();
+    auto weightProperty = expressionBinder.bindNodeOrRelPropertyExpression(rel, propertyName);
+    if (!LogicalTypeUtils::isNumerical(weightProperty->getDataType()) ||
+        weightProperty->getDataType().getLogicalTypeID() == LogicalTypeID::INT128) {
+        throw BinderException(
+            stringFormat("Weight property {} of recursive rel {} must be numeric.", propertyName,
+                relPattern.getVariableName()));
+    }
+    return weightProperty;
+}
+
 std::pair<uint64_t, uint64_t> Binder::bindVariableLengthRelBound(
     const kuzu::parser::RelPattern& relPattern) {
     auto recursiveInfo = relPattern.getRecursiveInfo();
@@ -0,0 +1,38 @@
+#include "common/enums/query_priority.h"
+
+#include "common/assert.h"
+#include "common/exception/runtime.h"
+#include "common/string_utils.h"
+
+namespace kuzu {
+namespace common {
+
+QueryPriority QueryPriorityUtils::fromString(const std::string& str) {
+    auto priority = str;
+    StringUtils::toLower(priority);
+    if (priority == "low") {
+        return QueryPriority::LOW;
+    } else if (priority == "normal") {
+        return QueryPriority::NORMAL;
+    } else if (priority == "high") {
+        return QueryPriority::HIGH;
+    }
+    throw RuntimeException(
+        "Invalid query priority: " + str + ". Expected one of low, normal or high.");
+}
+
+std::string QueryPriorityUtils::toString(QueryPriority priority) {
+    switch (priority) {
+    case QueryPriority::LOW:
+        return "low";
+    case QueryPriority::NORMAL:
+        return "normal";
+    case QueryPriority::HIGH:
+        return "high";
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace common
+} // namespace kuzu
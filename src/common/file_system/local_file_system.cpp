@@ -5,6 +5,7 @@
 #if defined(_WIN32)
 #include <fileapi.h>
 #include <io.h>
+#include <process.h>
 #include <windows.h>
 #else
 #include "sys/stat.h"
@@ -13,6 +14,7 @@
 
 #include <fcntl.h>
 
+#include <atomic>
 #include <cstring>
 
 #include "common/assert.h"
@@ -145,6 +147,17 @@ bool LocalFileSystem::fileOrPathExists(const std::string& path) {
     return std::filesystem::exists(path);
 }
 
+std::string LocalFileSystem::getTempFilePath(const std::string& fileNamePrefix) {
+    static std::atomic<uint64_t> nextTempFileIdx{0};
+#if defined(_WIN32)
+    auto processID = _getpid();
+#else
+    auto processID = getpid();
+#endif
+    return joinPath(std::filesystem::temp_directory_path().string(),
+        fileNamePrefix + std::to_string(processID) + "_" + std::to_string(nextTempFileIdx++));
+}
+
 void LocalFileSystem::readFromFile(
     FileInfo* fileInfo, void* buffer, uint64_t numBytes, uint64_t position) {
     auto localFileInfo = ku_dynamic_cast<FileInfo*, LocalFileInfo*>(fileInfo);
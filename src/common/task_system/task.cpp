@@ -14,7 +14,7 @@ bool Task::registerThread() {
     return false;
 }
 
-void Task::deRegisterThreadAndFinalizeTask() {
+bool Task::deRegisterThreadAndFinalizeTask() {
     lock_t lck{mtx};
     ++numThreadsFinished;
     if (!hasExceptionNoLock() && isCompletedNoLock()) {
@@ -25,7 +25,9 @@ void Task::deRegisterThreadAndFinalizeTask() {
     if (isCompletedNoLock()) {
         lck.unlock();
         cv.notify_all();
+        return true;
     }
+    return false;
 }
 
 } // namespace common
@@ -1,42 +1,73 @@
 #include "common/task_system/task_scheduler.h"
 
+#include "common/assert.h"
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace common {
 
-TaskScheduler::TaskScheduler(uint64_t numThreads) : stopThreads{false}, nextScheduledTaskID{0} {
+TaskScheduler::TaskScheduler(uint64_t numThreads)
+    : numSubmittedTasks{0, 0, 0}, pushEpoch{0}, numParkedWorkers{0}, stopThreads{false} {
+    for (auto n = 0u; n < numThreads; ++n) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    // Start the threads once all deques exist, since workers steal from each other.
     for (auto n = 0u; n < numThreads; ++n) {
-        threads.emplace_back([&] { runWorkerThread(); });
+        workers[n]->thread = std::thread([&, n] { runWorkerThread(n); });
     }
 }
 
 TaskScheduler::~TaskScheduler() {
-    lock_t lck{mtx};
     stopThreads = true;
-    lck.unlock();
-    cv.notify_all();
-    for (auto& thread : threads) {
-        thread.join();
+    pushEpoch++;
+    pushEpoch.notify_all();
+    for (auto& worker : workers) {
+        worker->thread.join();
+        while (auto taskRef = worker->deque.pop()) {
+            delete taskRef;
+        }
     }
 }
 
-void TaskScheduler::scheduleTaskAndWaitOrError(
-    const std::shared_ptr<Task>& task, processor::ExecutionContext* context) {
-    for (auto& dependency : task->children) {
-        scheduleTaskAndWaitOrError(dependency, context);
+void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
+    QueryPriority priority, processor::ExecutionContext* context) {
+    std::unordered_map<Task*, std::shared_ptr<ScheduledTask>> scheduledTasks;
+    std::vector<std::shared_ptr<ScheduledTask>> scheduledTasksInOrder;
+    auto maxNumThreads = std::max<uint64_t>(context->numThreads, 1);
+    if (priority == QueryPriority::LOW && workers.size() > 1) {
+        maxNumThreads = std::min<uint64_t>(maxNumThreads, workers.size() - 1);
+    }
+    auto query = std::make_shared<ScheduledQuery>(task, priority, maxNumThreads);
+    createScheduledTasks(task, query, scheduledTasks, scheduledTasksInOrder);
+    for (auto& scheduledTask : scheduledTasksInOrder) {
+        auto addDependency = [&](Task* dependency) {
+            KU_ASSERT(scheduledTasks.contains(dependency));
+            scheduledTasks.at(dependency)->dependents.push_back(scheduledTask);
+            scheduledTask->numPendingDependencies++;
+        };
+        for (auto& child : scheduledTask->task->children) {
+            addDependency(child.get());
+        }
+        for (auto dependency : scheduledTask->task->dependencies) {
+            addDependency(dependency);
+        }
+    }
+    for (auto& scheduledTask : scheduledTasksInOrder) {
+        if (scheduledTask->numPendingDependencies == 0) {
+            pushTask(scheduledTask, UINT64_MAX /* workerIdx */);
+        }
     }
-    auto scheduledTask = pushTaskIntoQueue(task);
-    cv.notify_all();
     std::unique_lock<std::mutex> taskLck{task->mtx, std::defer_lock};
     while (true) {
         taskLck.lock();
         bool timedWait = false;
         auto timeout = 0u;
-        if (task->isCompletedNoLock()) {
-            // Note: we do not remove completed tasks from the queue in this function. They will be
-            // removed by the worker threads when they traverse down the queue for a task to work on
-            // (see getTaskAndRegister()).
+        // An exception of any task of the DAG is passed to the root, whose dependents then never
+        // become ready, so stop waiting as soon as the root has an exception.
+        if (task->isCompletedNoLock() || task->hasExceptionNoLock()) {
+            // Note: we do not remove completed tasks from the deques in this function. They will
+            // be dropped by the worker threads when they take them (see runWorkerThread()).
             taskLck.unlock();
             break;
         }
@@ -47,9 +78,6 @@ void TaskScheduler::scheduleTaskAndWaitOrError(
             } else {
                 timedWait = true;
             }
-        } else if (task->hasExceptionNoLock()) {
-            // Interrupt tasks that errored, so other threads can stop working on them early.
-            context->clientContext->interrupt();
         }
         if (timedWait) {
             task->cv.wait_for(taskLck, std::chrono::milliseconds(timeout));
@@ -59,76 +87,183 @@ void TaskScheduler::scheduleTaskAndWaitOrError(
         taskLck.unlock();
     }
     if (task->hasException()) {
-        removeErroringTask(scheduledTask->ID);
+        // Interrupt tasks of the DAG that are still running, so threads can stop working on them
+        // early.
+        context->clientContext->interrupt();
+        removeErroringTasks(scheduledTasksInOrder);
         std::rethrow_exception(task->getExceptionPtr());
     }
 }
 
-std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
-    lock_t lck{mtx};
-    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
-    taskQueue.push_back(scheduledTask);
-    return scheduledTask;
+void TaskScheduler::createScheduledTasks(const std::shared_ptr<Task>& task,
+    const std::shared_ptr<ScheduledQuery>& query,
+    std::unordered_map<Task*, std::shared_ptr<ScheduledTask>>& scheduledTasks,
+    std::vector<std::shared_ptr<ScheduledTask>>& scheduledTasksInOrder) {
+    for (auto& child : task->children) {
+        createScheduledTasks(child, query, scheduledTasks, scheduledTasksInOrder);
+    }
+    auto scheduledTask = std::make_shared<ScheduledTask>(task, query);
+    scheduledTasks.insert({task.get(), scheduledTask});
+    scheduledTasksInOrder.push_back(std::move(scheduledTask));
 }
 
-std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
-    if (taskQueue.empty()) {
-        return nullptr;
+std::shared_ptr<ScheduledTask> TaskScheduler::getTask(uint64_t workerIdx) {
+    if (auto scheduledTask = getSubmittedTask(QueryPriority::HIGH)) {
+        return scheduledTask;
     }
-    auto it = taskQueue.begin();
-    while (it != taskQueue.end()) {
-        auto task = (*it)->task;
-        if (!task->registerThread()) {
-            // If we cannot register for a thread it is because of three possibilities:
-            // (i) maximum number of threads have registered for task and the task is completed
-            // without an exception; or (ii) same as (i) but the task has not yet successfully
-            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
-            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
-            // manually removed.
-            if (task->isCompletedSuccessfully()) { // option (i)
-                it = taskQueue.erase(it);
-            } else { // option (ii) or (iii): keep the task in the queue.
-                ++it;
+    std::unique_ptr<std::shared_ptr<ScheduledTask>> taskRef{workers[workerIdx]->deque.pop()};
+    if (taskRef) {
+        return std::move(*taskRef);
+    }
+    if (auto scheduledTask = getSubmittedTask(QueryPriority::NORMAL)) {
+        return scheduledTask;
+    }
+    for (auto i = 1u; i < workers.size(); ++i) {
+        auto& victim = workers[(workerIdx + i) % workers.size()]->deque;
+        // A steal fails if another worker takes the same task, so retry while tasks are left.
+        while (!victim.isEmpty()) {
+            taskRef.reset(victim.steal());
+            if (taskRef) {
+                return std::move(*taskRef);
             }
-        } else {
-            return *it;
         }
     }
-    return nullptr;
+    return getSubmittedTask(QueryPriority::LOW);
 }
 
-void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
-    lock_t lck{mtx};
-    for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
-        if (scheduledTaskID == (*it)->ID) {
-            taskQueue.erase(it);
-            return;
+std::shared_ptr<ScheduledTask> TaskScheduler::getSubmittedTask(QueryPriority priority) {
+    auto idx = (uint8_t)priority;
+    if (numSubmittedTasks[idx] == 0) {
+        return nullptr;
+    }
+    lock_t lck{submissionMtx};
+    auto& submissionQueue = submissionQueues[idx];
+    if (submissionQueue.empty()) {
+        return nullptr;
+    }
+    auto scheduledTask = std::move(submissionQueue.front());
+    submissionQueue.pop_front();
+    numSubmittedTasks[idx]--;
+    return scheduledTask;
+}
+
+void TaskScheduler::pushTask(
+    const std::shared_ptr<ScheduledTask>& scheduledTask, uint64_t workerIdx) {
+    auto priority = scheduledTask->query->priority;
+    if (workerIdx < workers.size() && priority != QueryPriority::HIGH) {
+        workers[workerIdx]->deque.push(new std::shared_ptr<ScheduledTask>(scheduledTask));
+    } else {
+        lock_t lck{submissionMtx};
+        submissionQueues[(uint8_t)priority].push_back(scheduledTask);
+        numSubmittedTasks[(uint8_t)priority]++;
+    }
+    unparkOne();
+}
+
+bool TaskScheduler::tryAcquireThread(const std::shared_ptr<ScheduledTask>& scheduledTask) {
+    auto& query = *scheduledTask->query;
+    lock_t lck{query.mtx};
+    if (query.numThreads == query.maxNumThreads) {
+        query.deferredTasks.push_back(scheduledTask);
+        return false;
+    }
+    query.numThreads++;
+    return true;
+}
+
+void TaskScheduler::releaseThread(ScheduledQuery& query, uint64_t workerIdx) {
+    lock_t lck{query.mtx};
+    query.numThreads--;
+    auto deferredTasks = std::move(query.deferredTasks);
+    query.deferredTasks.clear();
+    lck.unlock();
+    for (auto& scheduledTask : deferredTasks) {
+        pushTask(scheduledTask, workerIdx);
+    }
+}
+
+void TaskScheduler::park(uint64_t epoch) {
+    numParkedWorkers++;
+    // A task pushed after the epoch was read either bumped the epoch before this worker waits, or
+    // sees this worker parked and unparks it.
+    pushEpoch.wait(epoch);
+    numParkedWorkers--;
+}
+
+void TaskScheduler::unparkOne() {
+    pushEpoch++;
+    if (numParkedWorkers > 0) {
+        pushEpoch.notify_one();
+    }
+}
+
+void TaskScheduler::finishTask(
+    const std::shared_ptr<ScheduledTask>& scheduledTask, uint64_t workerIdx) {
+    auto& root = scheduledTask->query->root;
+    if (scheduledTask->task->hasException()) {
+        root->setException(scheduledTask->task->getExceptionPtr());
+        root->cv.notify_all();
+        return;
+    }
+    if (root->hasException()) {
+        // The DAG is being torn down, so do not start any more of its tasks.
+        return;
+    }
+    for (auto& dependent : scheduledTask->dependents) {
+        if (--dependent->numPendingDependencies == 0) {
+            pushTask(dependent, workerIdx);
         }
     }
 }
 
-void TaskScheduler::runWorkerThread() {
-    std::unique_lock<std::mutex> lck{mtx, std::defer_lock};
+void TaskScheduler::removeErroringTasks(
+    const std::vector<std::shared_ptr<ScheduledTask>>& scheduledTasks) {
+    auto exceptionPtr = scheduledTasks.back()->query->root->getExceptionPtr();
+    for (auto& scheduledTask : scheduledTasks) {
+        auto& task = scheduledTask->task;
+        // No worker can register to a task with an exception, so wait for the registered ones to
+        // finish.
+        task->setException(exceptionPtr);
+        lock_t taskLck{task->mtx};
+        task->cv.wait(
+            taskLck, [&] { return task->numThreadsFinished == task->numThreadsRegistered; });
+    }
+}
+
+void TaskScheduler::runWorkerThread(uint64_t workerIdx) {
     while (true) {
-        lck.lock();
-        cv.wait(lck, [&] { return !taskQueue.empty() || stopThreads; });
+        // Read the epoch before checking for the stop, which is set before the epoch is bumped.
+        auto epoch = pushEpoch.load();
         if (stopThreads) {
             return;
         }
-        auto scheduledTask = getTaskAndRegister();
-        lck.unlock();
+        auto scheduledTask = getTask(workerIdx);
         if (!scheduledTask) {
+            park(epoch);
             continue;
         }
-        try {
-            scheduledTask->task->run();
-            scheduledTask->task->deRegisterThreadAndFinalizeTask();
-        } catch (std::exception& e) {
-            scheduledTask->task->setException(std::current_exception());
-            scheduledTask->task->deRegisterThreadAndFinalizeTask();
+        auto& task = scheduledTask->task;
+        if (!tryAcquireThread(scheduledTask)) {
             continue;
         }
+        if (!task->registerThread()) {
+            // The task is completed, has as many threads as it accepts, or errored.
+            releaseThread(*scheduledTask->query, workerIdx);
+            continue;
+        }
+        if (task->canRegister()) {
+            // Let idle workers steal the task and join this one.
+            pushTask(scheduledTask, workerIdx);
+        }
+        try {
+            task->run();
+        } catch (std::exception& e) { task->setException(std::current_exception()); }
+        if (task->deRegisterThreadAndFinalizeTask()) {
+            finishTask(scheduledTask, workerIdx);
+        }
+        releaseThread(*scheduledTask->query, workerIdx);
     }
 }
+
 } // namespace common
 } // namespace kuzu
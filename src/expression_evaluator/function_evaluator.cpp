@@ -21,14 +21,8 @@ void FunctionExpressionEvaluator::evaluate() {
     for (auto& child : children) {
         child->evaluate();
     }
-    auto expr =
-        ku_dynamic_cast<binder::Expression*, binder::ScalarFunctionExpression*>(expression.get());
-    if (expr->getFunctionName() == CAST_FUNC_NAME) {
-        execFunc(parameters, *resultVector, expr->getBindData());
-        return;
-    }
     if (execFunc != nullptr) {
-        execFunc(parameters, *resultVector, nullptr);
+        execFunc(parameters, *resultVector, getBindData());
     }
 }
 
@@ -40,7 +34,7 @@ bool FunctionExpressionEvaluator::select(SelectionVector& selVector) {
     // implemented (e.g. list_contains). We should remove this if statement eventually.
     if (selectFunc == nullptr) {
         KU_ASSERT(resultVector->dataType.getLogicalTypeID() == LogicalTypeID::BOOL);
-        execFunc(parameters, *resultVector, nullptr);
+        execFunc(parameters, *resultVector, getBindData());
         auto numSelectedValues = 0u;
         for (auto i = 0u; i < resultVector->state->selVector->selectedSize; ++i) {
             auto pos = resultVector->state->selVector->selectedPositions[i];
@@ -54,6 +48,12 @@ bool FunctionExpressionEvaluator::select(SelectionVector& selVector) {
     return selectFunc(parameters, selVector);
 }
 
+function::FunctionBindData* FunctionExpressionEvaluator::getBindData() const {
+    return ku_dynamic_cast<binder::Expression*, binder::ScalarFunctionExpression*>(
+        expression.get())
+        ->getBindData();
+}
+
 std::unique_ptr<ExpressionEvaluator> FunctionExpressionEvaluator::clone() {
     std::vector<std::unique_ptr<ExpressionEvaluator>> clonedChildren;
     clonedChildren.reserve(children.size());
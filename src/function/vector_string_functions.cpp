@@ -1,5 +1,7 @@
 #include "function/string/vector_string_functions.h"
 
+#include "binder/expression/literal_expression.h"
+#include "common/cast.h"
 #include "function/string/functions/array_extract_function.h"
 #include "function/string/functions/concat_function.h"
 #include "function/string/functions/contains_function.h"
@@ -240,14 +242,60 @@ function_set SubStrFunction::getFunctionSet() {
     return functionSet;
 }
 
+std::shared_ptr<RE2> RegexCache::getRegex(const std::string& pattern) {
+    std::unique_lock lck{mtx};
+    auto iter = patternToEntry.find(pattern);
+    if (iter != patternToEntry.end()) {
+        entries.splice(entries.begin(), entries, iter->second);
+        return iter->second->second;
+    }
+    // Compile without holding the lock so that other threads can still hit the cache. If another
+    // thread cached the same pattern meanwhile, its regex is used instead.
+    lck.unlock();
+    auto regex = std::make_shared<RE2>(BaseRegexpOperation::parseCypherPatten(pattern));
+    lck.lock();
+    iter = patternToEntry.find(pattern);
+    if (iter != patternToEntry.end()) {
+        return iter->second->second;
+    }
+    if (entries.size() == CAPACITY) {
+        patternToEntry.erase(entries.back().first);
+        entries.pop_back();
+    }
+    entries.emplace_front(pattern, regex);
+    patternToEntry.emplace(pattern, entries.begin());
+    return regex;
+}
+
+std::unique_ptr<FunctionBindData> BaseRegexpFunction::bindFunc(
+    const binder::expression_vector& arguments, Function* definition) {
+    auto scalarFunction = ku_dynamic_cast<Function*, ScalarFunction*>(definition);
+    return bindRegexp(arguments, std::make_unique<LogicalType>(scalarFunction->returnTypeID));
+}
+
+std::unique_ptr<FunctionBindData> BaseRegexpFunction::bindRegexp(
+    const binder::expression_vector& arguments, std::unique_ptr<LogicalType> dataType) {
+    auto bindData = std::make_unique<RegexpBindData>(std::move(dataType));
+    auto& pattern = arguments[1];
+    if (pattern->expressionType == ExpressionType::LITERAL) {
+        auto value = ku_dynamic_cast<binder::Expression*, binder::LiteralExpression*>(pattern.get())
+                         ->getValue();
+        if (!value->isNull()) {
+            bindData->constantRegex = std::make_unique<RE2>(
+                BaseRegexpOperation::parseCypherPatten(value->getValue<std::string>()));
+        }
+    }
+    return bindData;
+}
+
 function_set RegexpFullMatchFunction::getFunctionSet() {
     function_set functionSet;
     functionSet.emplace_back(make_unique<ScalarFunction>(REGEXP_FULL_MATCH_FUNC_NAME,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
         LogicalTypeID::BOOL,
-        ScalarFunction::BinaryExecFunction<ku_string_t, ku_string_t, uint8_t, RegexpFullMatch>,
-        ScalarFunction::BinarySelectFunction<ku_string_t, ku_string_t, RegexpFullMatch>,
-        false /* isVarLength */));
+        ScalarFunction::BinaryExecWithBindDataFunction<ku_string_t, ku_string_t, uint8_t,
+            RegexpFullMatch>,
+        nullptr, bindFunc, false /* isVarLength */));
     return functionSet;
 }
 
@@ -256,9 +304,9 @@ function_set RegexpMatchesFunction::getFunctionSet() {
     functionSet.emplace_back(make_unique<ScalarFunction>(REGEXP_MATCHES_FUNC_NAME,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
         LogicalTypeID::BOOL,
-        ScalarFunction::BinaryExecFunction<ku_string_t, ku_string_t, uint8_t, RegexpMatches>,
-        ScalarFunction::BinarySelectFunction<ku_string_t, ku_string_t, RegexpMatches>,
-        false /* isVarLength */));
+        ScalarFunction::BinaryExecWithBindDataFunction<ku_string_t, ku_string_t, uint8_t,
+            RegexpMatches>,
+        nullptr, bindFunc, false /* isVarLength */));
     return functionSet;
 }
 
@@ -270,9 +318,9 @@ function_set RegexpReplaceFunction::getFunctionSet() {
         std::vector<LogicalTypeID>{
             LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING},
         LogicalTypeID::STRING,
-        ScalarFunction::TernaryStringExecFunction<ku_string_t, ku_string_t, ku_string_t,
+        ScalarFunction::TernaryExecWithBindDataFunction<ku_string_t, ku_string_t, ku_string_t,
             ku_string_t, RegexpReplace>,
-        false /* isVarLength */));
+        nullptr, bindFunc, false /* isVarLength */));
     return functionSet;
 }
 
@@ -281,16 +329,16 @@ function_set RegexpExtractFunction::getFunctionSet() {
     functionSet.emplace_back(make_unique<ScalarFunction>(REGEXP_EXTRACT_FUNC_NAME,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
         LogicalTypeID::STRING,
-        ScalarFunction::BinaryStringExecFunction<ku_string_t, ku_string_t, ku_string_t,
+        ScalarFunction::BinaryExecWithBindDataFunction<ku_string_t, ku_string_t, ku_string_t,
             RegexpExtract>,
-        false /* isVarLength */));
+        nullptr, bindFunc, false /* isVarLength */));
     functionSet.emplace_back(make_unique<ScalarFunction>(REGEXP_EXTRACT_FUNC_NAME,
         std::vector<LogicalTypeID>{
             LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::INT64},
         LogicalTypeID::STRING,
-        ScalarFunction::TernaryStringExecFunction<ku_string_t, ku_string_t, int64_t, ku_string_t,
-            RegexpExtract>,
-        false /* isVarLength */));
+        ScalarFunction::TernaryExecWithBindDataFunction<ku_string_t, ku_string_t, int64_t,
+            ku_string_t, RegexpExtract>,
+        nullptr, bindFunc, false /* isVarLength */));
     return functionSet;
 }
 
@@ -299,22 +347,22 @@ function_set RegexpExtractAllFunction::getFunctionSet() {
     functionSet.emplace_back(make_unique<ScalarFunction>(REGEXP_EXTRACT_FUNC_NAME,
         std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
         LogicalTypeID::VAR_LIST,
-        ScalarFunction::BinaryStringExecFunction<ku_string_t, ku_string_t, list_entry_t,
+        ScalarFunction::BinaryExecWithBindDataFunction<ku_string_t, ku_string_t, list_entry_t,
             RegexpExtractAll>,
         nullptr, bindFunc, false /* isVarLength */));
     functionSet.emplace_back(make_unique<ScalarFunction>(REGEXP_EXTRACT_FUNC_NAME,
         std::vector<LogicalTypeID>{
             LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::INT64},
         LogicalTypeID::VAR_LIST,
-        ScalarFunction::TernaryStringExecFunction<ku_string_t, ku_string_t, int64_t, list_entry_t,
-            RegexpExtractAll>,
+        ScalarFunction::TernaryExecWithBindDataFunction<ku_string_t, ku_string_t, int64_t,
+            list_entry_t, RegexpExtractAll>,
         nullptr, bindFunc, false /* isVarLength */));
     return functionSet;
 }
 
 std::unique_ptr<FunctionBindData> RegexpExtractAllFunction::bindFunc(
-    const binder::expression_vector& /*arguments*/, Function* /*definition*/) {
-    return std::make_unique<FunctionBindData>(LogicalType::VAR_LIST(LogicalType::STRING()));
+    const binder::expression_vector& arguments, Function* /*definition*/) {
+    return bindRegexp(arguments, LogicalType::VAR_LIST(LogicalType::STRING()));
 }
 
 } // namespace function
@@ -237,6 +237,8 @@ private:
     std::shared_ptr<RelExpression> createRecursiveQueryRel(const parser::RelPattern& relPattern,
         const std::vector<common::table_id_t>& tableIDs, std::shared_ptr<NodeExpression> srcNode,
         std::shared_ptr<NodeExpression> dstNode, RelDirectionType directionType);
+    std::shared_ptr<Expression> bindRecursiveRelWeightProperty(const parser::RelPattern& relPattern,
+        const RelExpression& rel, const parser::ParsedExpression& parsedWeight);
     std::pair<uint64_t, uint64_t> bindVariableLengthRelBound(const parser::RelPattern& relPattern);
     void bindQueryRelProperties(RelExpression& rel);
 
@@ -40,6 +40,8 @@ struct RecursiveInfo {
     std::shared_ptr<Expression> nodePredicateExecFlag;
     std::shared_ptr<Expression> nodePredicate;
     std::shared_ptr<Expression> relPredicate;
+    // Numeric rel property whose sum a weighted shortest path minimizes.
+    std::shared_ptr<Expression> weightProperty;
     // Projection list
     expression_vector nodeProjectionList;
     expression_vector relProjectionList;
@@ -32,6 +32,7 @@ struct InternalKeyword {
     static constexpr char SRC[] = "_SRC";
     static constexpr char DST[] = "_DST";
     static constexpr char LENGTH[] = "_LENGTH";
+    static constexpr char WEIGHT[] = "_WEIGHT";
     static constexpr char NODES[] = "_NODES";
     static constexpr char RELS[] = "_RELS";
     static constexpr char STAR[] = "*";
@@ -67,10 +68,19 @@ struct BufferPoolConstants {
     // If a user does not specify a max size for BM, we by default set the max size of BM to
     // maxPhyMemSize * DEFAULT_PHY_MEM_SIZE_RATIO_FOR_BM.
     static constexpr double DEFAULT_PHY_MEM_SIZE_RATIO_FOR_BM = 0.8;
-    // For each PURGE_EVICTION_QUEUE_INTERVAL candidates added to the eviction queue, we will call
-    // `removeNonEvictableCandidates` to remove candidates that are not evictable. See
-    // `EvictionQueue::removeNonEvictableCandidates()` for more details.
+    // For each PURGE_EVICTION_QUEUE_INTERVAL candidates added to a shard of the eviction queue, we
+    // will call `removeNonEvictableCandidates` to remove candidates that are not evictable from
+    // the shard. See `EvictionQueue::Shard::removeNonEvictableCandidates()` for more details.
     static constexpr uint64_t EVICTION_QUEUE_PURGING_INTERVAL = 1024;
+    // Number of threads the BM uses to serve asynchronous page reads issued by prefetches.
+    static constexpr uint64_t NUM_IO_THREADS = 2;
+    // Pages being prefetched are locked until their reads complete, so we cap the memory they can
+    // hold to leave the rest of the buffer pool to pins.
+    static constexpr double MAX_PREFETCH_MEM_RATIO = 0.125;
+    // Operators that can spill, i.e., hash joins and hash aggregates, spill their data once the
+    // memory manager holds more than this ratio of the buffer pool. The rest of the buffer pool is
+    // left to the data they keep in memory, e.g., hash slots.
+    static constexpr double SPILL_MEMORY_RATIO = 0.25;
     // The default max size for a VMRegion.
     static constexpr uint64_t DEFAULT_VM_REGION_MAX_SIZE = (uint64_t)1 << 43; // (8TB)
 
@@ -92,6 +102,7 @@ struct StorageConstants {
     static constexpr char DATA_FILE_NAME[] = "data.kz";
     static constexpr char METADATA_FILE_NAME[] = "metadata.kz";
     static constexpr char LOCK_FILE_NAME[] = ".lock";
+    static constexpr char MEMORY_SPILL_FILE_NAME_PREFIX[] = "kuzu_memory_spill_";
 
     // The number of pages that we add at one time when we need to grow a file.
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
@@ -100,6 +111,8 @@ struct StorageConstants {
 
     static constexpr uint64_t NODE_GROUP_SIZE_LOG2 = 17; // 64 * 2048 nodes per group
     static constexpr uint64_t NODE_GROUP_SIZE = (uint64_t)1 << NODE_GROUP_SIZE_LOG2;
+    // Number of pages of a column chunk that scans ask the BM to read ahead of their cursor.
+    static constexpr uint64_t NUM_PAGES_TO_PREFETCH = 32;
 };
 
 // Hash Index Configurations
@@ -158,6 +171,9 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // Only build a Bloom filter over the join keys if the probe side is much bigger than the build
+    // side. Otherwise, most probe tuples find a match and the filter only adds work.
+    static constexpr uint64_t BLOOM_FILTER_RATIO = 8;
 };
 
 struct ClientContextConstants {
@@ -165,12 +181,53 @@ struct ClientContextConstants {
     static constexpr uint64_t TIMEOUT_IN_MS = 0;
 };
 
+struct QueryAdmissionConstants {
+    // Bytes that a hash table, an aggregate or a sort holds for each tuple next to its columns,
+    // e.g. for hash slots, chain pointers and sort key indices.
+    static constexpr uint64_t TUPLE_OVERHEAD_IN_BYTES = 16;
+    // Memory-heavy queries running at the same time together reserve at most this ratio of the
+    // buffer pool, leaving the rest to cached pages and to the other queries.
+    static constexpr double MEMORY_BUDGET_RATIO = 0.75;
+    // A query is memory-heavy if it is estimated to use more than 1 / RATIO of the budget.
+    static constexpr uint64_t MEMORY_HEAVY_QUERY_RATIO = 64;
+    // Waiting queries check whether they are interrupted or timed out at this interval.
+    static constexpr uint64_t WAIT_INTERVAL_IN_MS = 10;
+    // NORMAL priority queries that the planner estimates to join and output at most this many
+    // tuples are scheduled as HIGH priority, so that they don't queue behind long queries.
+    static constexpr uint64_t SHORT_QUERY_MAX_NUM_TUPLES = DEFAULT_VECTOR_CAPACITY;
+};
+
 struct OrderByConstants {
     static constexpr uint64_t NUM_BYTES_FOR_PAYLOAD_IDX = 8;
     static constexpr uint64_t MIN_SIZE_TO_REDUCE = common::DEFAULT_VECTOR_CAPACITY * 5;
     static constexpr uint64_t MIN_LIMIT_RATIO_TO_REDUCE = 2;
 };
 
+struct HashAggregateConstants {
+    // Groups are radix partitioned by the top bits of their hash, so that the hash tables of
+    // different threads can be merged and finalized one partition at a time, in parallel.
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 5;
+    static constexpr uint64_t NUM_PARTITIONS = (uint64_t)1 << NUM_PARTITIONS_LOG2;
+    // Each partition of a spilled local hash table is written to blocks of its own, so local hash
+    // tables are only spilled once their partitions hold this many entries on average.
+    static constexpr uint64_t MIN_NUM_ENTRIES_TO_SPILL = 256;
+};
+
+struct HashJoinConstants {
+    // Build and probe tuples that are spilled are radix partitioned by the top bits of the hash of
+    // their keys, so that each partition of the build side can be joined on its own.
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 3;
+    static constexpr uint64_t NUM_PARTITIONS = (uint64_t)1 << NUM_PARTITIONS_LOG2;
+    // Bits of the Bloom filter over the build keys per key, which gives a false positive rate of
+    // about 1%. The filter is capped at MAX_BLOOM_FILTER_SIZE bytes.
+    static constexpr uint64_t BLOOM_FILTER_BITS_PER_KEY = 16;
+    static constexpr uint64_t MAX_BLOOM_FILTER_SIZE = (uint64_t)1 << 27;
+    // Probe threads stop checking probe keys against the Bloom filter if more than this ratio of
+    // the first BLOOM_FILTER_NUM_KEYS_TO_SAMPLE keys pass it.
+    static constexpr uint64_t BLOOM_FILTER_NUM_KEYS_TO_SAMPLE = 16 * DEFAULT_VECTOR_CAPACITY;
+    static constexpr double BLOOM_FILTER_MAX_PASS_RATIO = 0.9;
+};
+
 struct ParquetConstants {
     static constexpr uint64_t PARQUET_DEFINE_VALID = 65535;
     static constexpr const char* PARQUET_MAGIC_WORDS = "PAR1";
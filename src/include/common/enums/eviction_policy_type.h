@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace common {
+
+// Replacement policy used by the buffer manager to pick pages to evict.
+enum class EvictionPolicyType : uint8_t {
+    // A single FIFO queue of unpinned pages. Pages that were read since they were enqueued are
+    // given a second chance.
+    FIFO = 0,
+    // A 2Q-style policy: newly loaded pages enter a small FIFO queue, and only pages that are
+    // accessed again shortly after being evicted from it are admitted to the main queue. Large
+    // scans thus only churn the small queue, leaving frequently accessed pages cached.
+    TWO_QUEUE = 1,
+};
+
+} // namespace common
+} // namespace kuzu
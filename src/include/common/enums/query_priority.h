@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace kuzu {
+namespace common {
+
+// Priority class of the queries of a connection, used by the TaskScheduler to pick tasks.
+enum class QueryPriority : uint8_t {
+    // Batch queries, e.g. large analytical scans. Their tasks are picked up last, and a query
+    // leaves at least one worker to queries of other priorities.
+    LOW = 0,
+    // The default. Queries that the planner estimates to be short are scheduled as HIGH.
+    NORMAL = 1,
+    // Latency-sensitive queries, e.g. point lookups. Their tasks are picked up first.
+    HIGH = 2,
+};
+
+struct QueryPriorityUtils {
+    static QueryPriority fromString(const std::string& str);
+    static std::string toString(QueryPriority priority);
+};
+
+} // namespace common
+} // namespace kuzu
@@ -40,6 +40,10 @@ public:
 
     bool fileOrPathExists(const std::string& path) override;
 
+    // Returns a new path in the system temp directory for a file that only lives as long as the
+    // process, e.g., a spill file. The name is unique across processes and within the process.
+    static std::string getTempFilePath(const std::string& fileNamePrefix);
+
 protected:
     void readFromFile(
         FileInfo* fileInfo, void* buffer, uint64_t numBytes, uint64_t position) override;
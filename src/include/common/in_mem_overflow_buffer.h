@@ -41,6 +41,17 @@ public:
         currentBlock = other.currentBlock;
     }
 
+    inline void spill() {
+        for (auto& block : blocks) {
+            block->block->spill();
+        }
+    }
+    inline void reload() {
+        for (auto& block : blocks) {
+            block->block->reload();
+        }
+    }
+
     // Releases all memory accumulated for string overflows so far and re-initializes its state to
     // an empty buffer. If there is a large string that used point to any of these overflow buffers
     // they will error.
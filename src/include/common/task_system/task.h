@@ -42,6 +42,10 @@ public:
         children.push_back(std::move(child));
     }
 
+    // Adds a task that has to complete before this one starts, in addition to its children. The
+    // dependency must belong to the same task DAG and must not depend on this task.
+    inline void addDependency(Task* dependency) { dependencies.push_back(dependency); }
+
     inline bool isCompletedSuccessfully() {
         lock_t lck{mtx};
         return isCompletedNoLock() && !hasExceptionNoLock();
@@ -55,7 +59,14 @@ public:
 
     bool registerThread();
 
-    void deRegisterThreadAndFinalizeTask();
+    // Returns true if another thread can register itself to the task.
+    inline bool canRegister() {
+        lock_t lck{mtx};
+        return !hasExceptionNoLock() && canRegisterNoLock();
+    }
+
+    // Returns true if the calling thread is the last one to finish and completes the task.
+    bool deRegisterThreadAndFinalizeTask();
 
     inline void setException(std::exception_ptr exceptionPtr) {
         lock_t lck{mtx};
@@ -89,6 +100,8 @@ public:
     Task* parent = nullptr;
     std::vector<std::shared_ptr<Task>>
         children; // Dependency tasks that needs to be executed first.
+    // Other tasks of the DAG that need to be executed first, e.g. sibling pipelines.
+    std::vector<Task*> dependencies;
 
 protected:
     std::mutex mtx;
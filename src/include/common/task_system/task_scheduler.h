@@ -1,70 +1,141 @@
 #pragma once
-#include <condition_variable>
+#include <array>
+#include <atomic>
 #include <deque>
 #include <thread>
+#include <unordered_map>
 
+#include "common/enums/query_priority.h"
 #include "common/task_system/task.h"
+#include "common/task_system/work_stealing_deque.h"
 #include "processor/execution_context.h"
 
 namespace kuzu {
 namespace common {
 
+struct ScheduledTask;
+
+// A task DAG, i.e. a query, that is scheduled.
+struct ScheduledQuery {
+    ScheduledQuery(std::shared_ptr<Task> root, QueryPriority priority, uint64_t maxNumThreads)
+        : root{std::move(root)}, priority{priority}, maxNumThreads{maxNumThreads}, numThreads{0} {}
+    std::shared_ptr<Task> root;
+    QueryPriority priority;
+    // Quota of workers that may work on the tasks of the DAG at the same time.
+    uint64_t maxNumThreads;
+    std::mutex mtx;
+    uint64_t numThreads;
+    // Tasks taken by workers while the quota was used up. They are pushed again once a worker of
+    // the DAG leaves its task.
+    std::vector<std::shared_ptr<ScheduledTask>> deferredTasks;
+};
+
 struct ScheduledTask {
-    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID) : task{std::move(task)}, ID{ID} {};
+    ScheduledTask(std::shared_ptr<Task> task, std::shared_ptr<ScheduledQuery> query)
+        : task{std::move(task)}, query{std::move(query)}, numPendingDependencies{0} {};
     std::shared_ptr<Task> task;
-    uint64_t ID;
+    std::shared_ptr<ScheduledQuery> query;
+    std::atomic<uint64_t> numPendingDependencies;
+    std::vector<std::shared_ptr<ScheduledTask>> dependents;
 };
 
 /**
- * TaskScheduler is a library that manages a set of worker threads that can execute tasks that are
- * put into a task queue. Each task accepts a maximum number of threads. Users of TaskScheduler
- * schedule tasks to be executed by calling schedule functions, e.g., pushTaskIntoQueue or
- * scheduleTaskAndWaitOrError. New tasks are put at the end of the queue. Workers grab the first
- * task from the beginning of the queue that they can register themselves to work on. Any task that
- * is completed is removed automatically from the queue. If there is a task that raises an
- * exception, the worker threads catch it and store it with the tasks. The user thread that is
- * waiting on the completion of the task (or tasks) will throw the exception (the user thread could
- * be waiting on a tasks through a function that waits, e.g., scheduleTaskAndWaitOrError.
+ * TaskScheduler is a library that manages a set of worker threads that can execute tasks. Each
+ * task accepts a maximum number of threads. Users of TaskScheduler schedule a DAG of tasks by
+ * calling scheduleTaskAndWaitOrError on its root. A task depends on its children and on the tasks
+ * in its dependencies. Tasks whose dependencies are all completed are ready and are put into the
+ * submission queue of the priority of their query. Once a task completes, the worker that
+ * completes it pushes the dependents that become ready into its own deque, and runs them next
+ * unless another worker steals them first.
+ *
+ * Each worker takes a task from the bottom of its own deque, then from the submission queues, and
+ * otherwise steals one from the top of another worker's deque, so workers only contend with each
+ * other when they run out of work. After registering itself to a task that accepts more threads,
+ * a worker pushes the task back into its deque, where idle workers can steal it and join. A task
+ * that a worker cannot register itself to, because it is completed, full or errored, is dropped
+ * from the deque. Workers without work park and are unparked one at a time as tasks are pushed.
+ *
+ * Queries have a priority class and a quota of workers. Tasks of HIGH priority queries always go
+ * to their own submission queue, which workers check before anything else, and tasks of LOW
+ * priority queries submitted by user threads are only taken by workers that find no other work.
+ * Since a worker runs a task until the task runs out of work, priorities alone cannot keep a large
+ * query from occupying every worker. Hence a query is limited to the number of threads of its
+ * connection across all of its tasks, and a LOW priority query always leaves one worker to others.
+ *
+ * If there is a task that raises an exception, the worker threads catch it and store it with the
+ * task and the root of its DAG. The user thread that is waiting on the completion of the root will
+ * throw the exception.
  *
  * Currently there is one way the TaskScheduler can be used:
- * Schedule one task T and wait for T to finish or error if there was an exception raised by
- * one of the threads working on T that errored. This is simply done by the call:
+ * Schedule the DAG of a task T and wait for T to finish or error if there was an exception raised
+ * by one of the threads working on T or on a task T depends on. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
- * completion.
+ * TaskScheduler does not guarantee that tasks start in the order they become ready: a worker runs
+ * the most recently pushed task of its own deque first, which favors finishing a query over
+ * starting the tasks of others.
  */
 class TaskScheduler {
 public:
     explicit TaskScheduler(uint64_t numThreads);
     ~TaskScheduler();
 
-    // Schedules the dependencies of the given task and finally the task one after another (so
-    // not concurrently), and throws an exception if any of the tasks errors. Regardless of
-    // whether or not the given task or one of its dependencies errors, when this function
-    // returns, no task related to the given task will be in the task queue. Further no worker
-    // thread will be working on the given task.
-    void scheduleTaskAndWaitOrError(
-        const std::shared_ptr<Task>& task, processor::ExecutionContext* context);
+    // Schedules the given task and its dependencies, running independent tasks concurrently, and
+    // throws an exception if any of the tasks errors. Regardless of whether or not the given task
+    // or one of its dependencies errors, when this function returns, no task related to the given
+    // task will be in the task queue. Further no worker thread will be working on any of them.
+    // The tasks are scheduled with the given priority.
+    void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task, QueryPriority priority,
+        processor::ExecutionContext* context);
 
 private:
-    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    using task_ref_t = std::shared_ptr<ScheduledTask>*;
+
+    struct Worker {
+        // Owns a reference to each task in it.
+        WorkStealingDeque<task_ref_t> deque;
+        std::thread thread;
+    };
+
+    // Creates a scheduled task for the given task and its descendants, in post order.
+    void createScheduledTasks(const std::shared_ptr<Task>& task,
+        const std::shared_ptr<ScheduledQuery>& query,
+        std::unordered_map<Task*, std::shared_ptr<ScheduledTask>>& scheduledTasks,
+        std::vector<std::shared_ptr<ScheduledTask>>& scheduledTasksInOrder);
 
-    void removeErroringTask(uint64_t scheduledTaskID);
+    // Pushes the tasks that depend on the completed task and are now ready into the worker's
+    // deque. If the task errored, the exception is passed to the root instead and no more tasks of
+    // the DAG run.
+    void finishTask(const std::shared_ptr<ScheduledTask>& scheduledTask, uint64_t workerIdx);
 
-    // Functions to launch worker threads and for the worker threads to use to grab task from queue.
-    void runWorkerThread();
-    std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    // Prevents workers from registering to tasks of the DAG and waits for them to leave its
+    // running tasks. Tasks of the DAG left in deques are dropped when workers take them.
+    void removeErroringTasks(const std::vector<std::shared_ptr<ScheduledTask>>& scheduledTasks);
+
+    void runWorkerThread(uint64_t workerIdx);
+    // Takes a task from the submission queues, the worker's deque or another worker's deque.
+    std::shared_ptr<ScheduledTask> getTask(uint64_t workerIdx);
+    std::shared_ptr<ScheduledTask> getSubmittedTask(QueryPriority priority);
+    // Pushes the task into the worker's deque. Tasks of HIGH priority queries and tasks pushed by
+    // user threads, i.e. with an invalid worker index, go to the submission queues instead.
+    void pushTask(const std::shared_ptr<ScheduledTask>& scheduledTask, uint64_t workerIdx);
+    // Returns false and defers the task if the quota of its query is used up.
+    bool tryAcquireThread(const std::shared_ptr<ScheduledTask>& scheduledTask);
+    void releaseThread(ScheduledQuery& query, uint64_t workerIdx);
+    // Parks the calling worker until a task is pushed after the given epoch.
+    void park(uint64_t epoch);
+    void unparkOne();
 
 private:
-    std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
-    bool stopThreads;
-    std::vector<std::thread> threads;
-    std::mutex mtx;
-    std::condition_variable cv;
-    uint64_t nextScheduledTaskID;
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::mutex submissionMtx;
+    // Indexed by query priority.
+    std::array<std::deque<std::shared_ptr<ScheduledTask>>, 3> submissionQueues;
+    std::array<std::atomic<uint64_t>, 3> numSubmittedTasks;
+    // Bumped whenever a task is pushed, and waited on by parked workers.
+    std::atomic<uint64_t> pushEpoch;
+    std::atomic<uint64_t> numParkedWorkers;
+    std::atomic<bool> stopThreads;
 };
 
 } // namespace common
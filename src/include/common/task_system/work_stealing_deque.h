@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+
+/**
+ * WorkStealingDeque is a Chase-Lev deque of pointers (Lê et al., "Correct and Efficient
+ * Work-Stealing for Weak Memory Models"). Only the owner thread pushes and pops, at the bottom, and
+ * any other thread steals from the top without taking a lock. The buffer grows when full. Replaced
+ * buffers are kept until the deque is destructed, because a thief may still read from them.
+ */
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_pointer_v<T>);
+
+    struct Buffer {
+        explicit Buffer(int64_t capacity)
+            : capacity{capacity}, items{std::make_unique<std::atomic<T>[]>(capacity)} {}
+
+        inline T get(int64_t idx) const {
+            return items[idx & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+        inline void put(int64_t idx, T item) {
+            items[idx & (capacity - 1)].store(item, std::memory_order_relaxed);
+        }
+
+        int64_t capacity; // Power of 2.
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+public:
+    explicit WorkStealingDeque(int64_t capacity = 64) : top{0}, bottom{0} {
+        buffers.push_back(std::make_unique<Buffer>(capacity));
+        buffer.store(buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    // Owner only.
+    void push(T item) {
+        auto b = bottom.load(std::memory_order_relaxed);
+        auto t = top.load(std::memory_order_acquire);
+        auto currentBuffer = buffer.load(std::memory_order_relaxed);
+        if (b - t > currentBuffer->capacity - 1) {
+            currentBuffer = grow(currentBuffer, t, b);
+        }
+        currentBuffer->put(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only. Returns the most recently pushed item, or nullptr if the deque is empty.
+    T pop() {
+        auto b = bottom.load(std::memory_order_relaxed) - 1;
+        auto currentBuffer = buffer.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        auto item = currentBuffer->get(b);
+        if (t == b) {
+            // Last item, which a thief may be stealing at the same time.
+            if (!top.compare_exchange_strong(
+                    t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // Any thread. Returns the least recently pushed item, or nullptr if the deque is empty or
+    // another thread took the item first.
+    T steal() {
+        auto t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+        auto item = buffer.load(std::memory_order_acquire)->get(t);
+        if (!top.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    inline bool isEmpty() const {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+
+private:
+    Buffer* grow(Buffer* currentBuffer, int64_t t, int64_t b) {
+        auto newBuffer = std::make_unique<Buffer>(currentBuffer->capacity * 2);
+        for (auto i = t; i < b; ++i) {
+            newBuffer->put(i, currentBuffer->get(i));
+        }
+        buffers.push_back(std::move(newBuffer));
+        buffer.store(buffers.back().get(), std::memory_order_release);
+        return buffers.back().get();
+    }
+
+private:
+    std::atomic<int64_t> top;
+    std::atomic<int64_t> bottom;
+    std::atomic<Buffer*> buffer;
+    // Owner only.
+    std::vector<std::unique_ptr<Buffer>> buffers;
+};
+
+} // namespace common
+} // namespace kuzu
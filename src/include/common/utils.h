@@ -45,6 +45,16 @@ inline uint64_t nextPowerOfTwo(uint64_t v) {
     return v;
 }
 
+// Hints the CPU to load the cache line holding `addr`, so that a following read of it doesn't stall
+// on a cache miss.
+inline void prefetchForRead(const void* addr) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr, 0 /* read */);
+#else
+    (void)addr;
+#endif
+}
+
 inline bool isLittleEndian() {
     // Little endian arch stores the least significant value in the lower bytes.
     int testNumber = 1;
@@ -26,6 +26,10 @@ protected:
     void resolveResultVector(
         const processor::ResultSet& resultSet, storage::MemoryManager* memoryManager) override;
 
+private:
+    // Bind data of the function, which may hold state prepared once for all threads.
+    function::FunctionBindData* getBindData() const;
+
 private:
     std::shared_ptr<binder::Expression> expression;
     function::scalar_exec_func execFunc;
@@ -47,6 +47,15 @@ struct BinaryStringFunctionWrapper {
     }
 };
 
+struct BinaryBindDataFunctionWrapper {
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename OP>
+    static inline void operation(LEFT_TYPE& left, RIGHT_TYPE& right, RESULT_TYPE& result,
+        common::ValueVector* /*leftValueVector*/, common::ValueVector* /*rightValueVector*/,
+        common::ValueVector* resultValueVector, uint64_t /*resultPos*/, void* dataPtr) {
+        OP::operation(left, right, result, *resultValueVector, dataPtr);
+    }
+};
+
 struct BinaryComparisonFunctionWrapper {
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename OP>
     static inline void operation(LEFT_TYPE& left, RIGHT_TYPE& right, RESULT_TYPE& result,
@@ -251,6 +260,14 @@ struct BinaryFunctionExecutor {
             left, right, result, nullptr /* dataPtr */);
     }
 
+    // The function reads state prepared at bind time from the bind data.
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC>
+    static void executeWithBindData(common::ValueVector& left, common::ValueVector& right,
+        common::ValueVector& result, void* dataPtr) {
+        executeSwitch<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, BinaryBindDataFunctionWrapper>(
+            left, right, result, dataPtr);
+    }
+
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC>
     static void executeListStruct(
         common::ValueVector& left, common::ValueVector& right, common::ValueVector& result) {
@@ -66,6 +66,15 @@ struct ScalarFunction final : public BaseScalarFunction {
             *params[0], *params[1], *params[2], result);
     }
 
+    template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename FUNC>
+    static void TernaryExecWithBindDataFunction(
+        const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::ValueVector& result, void* dataPtr) {
+        KU_ASSERT(params.size() == 3);
+        TernaryFunctionExecutor::executeWithBindData<A_TYPE, B_TYPE, C_TYPE, RESULT_TYPE, FUNC>(
+            *params[0], *params[1], *params[2], result, dataPtr);
+    }
+
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC>
     static void BinaryExecFunction(const std::vector<std::shared_ptr<common::ValueVector>>& params,
         common::ValueVector& result, void* /*dataPtr*/ = nullptr) {
@@ -83,6 +92,15 @@ struct ScalarFunction final : public BaseScalarFunction {
             *params[0], *params[1], result);
     }
 
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC>
+    static void BinaryExecWithBindDataFunction(
+        const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::ValueVector& result, void* dataPtr) {
+        KU_ASSERT(params.size() == 2);
+        BinaryFunctionExecutor::executeWithBindData<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC>(
+            *params[0], *params[1], result, dataPtr);
+    }
+
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename FUNC>
     static bool BinarySelectFunction(
         const std::vector<std::shared_ptr<common::ValueVector>>& params,
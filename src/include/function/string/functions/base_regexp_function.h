@@ -1,18 +1,67 @@
 #pragma once
 
-#include <regex>
+#include <list>
+#include <mutex>
 
 #include "common/vector/value_vector.h"
+#include "function/function.h"
+#include "re2.h"
 
 namespace kuzu {
 namespace function {
 
+// Compiled regexes of non-constant patterns, shared by all threads evaluating a regexp function.
+// The least recently used pattern is evicted once the cache is full.
+class RegexCache {
+    using entry_t = std::pair<std::string, std::shared_ptr<RE2>>;
+
+public:
+    static constexpr uint64_t CAPACITY = 64;
+
+    // The regex stays valid after eviction as long as the caller holds it.
+    std::shared_ptr<RE2> getRegex(const std::string& pattern);
+
+private:
+    std::mutex mtx;
+    std::list<entry_t> entries; // Most recently used first.
+    std::unordered_map<std::string, std::list<entry_t>::iterator> patternToEntry;
+};
+
+struct RegexpBindData : public FunctionBindData {
+    // Compiled at bind time if the pattern is a constant.
+    std::unique_ptr<RE2> constantRegex;
+    RegexCache regexCache;
+
+    explicit RegexpBindData(std::unique_ptr<common::LogicalType> dataType)
+        : FunctionBindData{std::move(dataType)} {}
+};
+
 struct BaseRegexpOperation {
     static inline std::string parseCypherPatten(const std::string& pattern) {
         // Cypher parses escape characters with 2 backslash eg. for expressing '.' requires '\\.'
         // Since Regular Expression requires only 1 backslash '\.' we need to replace double slash
         // with single
-        return std::regex_replace(pattern, std::regex(R"(\\\\)"), "\\");
+        std::string result;
+        result.reserve(pattern.size());
+        for (auto i = 0u; i < pattern.size(); ++i) {
+            result += pattern[i];
+            if (pattern[i] == '\\' && i + 1 < pattern.size() && pattern[i + 1] == '\\') {
+                i++;
+            }
+        }
+        return result;
+    }
+
+    // Reuses the regex compiled at bind time, or compiles the pattern through the cache.
+    template<typename FUNC>
+    static inline auto applyRegex(
+        const common::ku_string_t& pattern, void* dataPtr, const FUNC& func) {
+        auto bindData = reinterpret_cast<RegexpBindData*>(dataPtr);
+        if (bindData->constantRegex != nullptr) {
+            return func(*bindData->constantRegex);
+        }
+        auto regex = bindData->regexCache.getRegex(pattern.getAsString());
+        return func(*regex);
     }
 
     static inline void copyToKuzuString(
@@ -2,16 +2,17 @@
 
 #include "base_regexp_function.h"
 #include "common/vector/value_vector.h"
-#include "re2.h"
 
 namespace kuzu {
 namespace function {
 
 struct RegexpExtractAll : BaseRegexpOperation {
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
-        std::int64_t& group, common::list_entry_t& result, common::ValueVector& resultVector) {
-        std::vector<std::string> matches =
-            regexExtractAll(value.getAsString(), pattern.getAsString(), group);
+        std::int64_t& group, common::list_entry_t& result, common::ValueVector& resultVector,
+        void* dataPtr) {
+        auto matches = applyRegex(pattern, dataPtr, [&](const RE2& regex) {
+            return regexExtractAll(value.getAsStringView(), regex, group);
+        });
         result = common::ListVector::addList(&resultVector, matches.size());
         auto resultValues = common::ListVector::getListValues(&resultVector, result);
         auto resultDataVector = common::ListVector::getDataVector(&resultVector);
@@ -26,14 +27,13 @@ struct RegexpExtractAll : BaseRegexpOperation {
     }
 
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
-        common::list_entry_t& result, common::ValueVector& resultVector) {
+        common::list_entry_t& result, common::ValueVector& resultVector, void* dataPtr) {
         int64_t defaultGroup = 0;
-        operation(value, pattern, defaultGroup, result, resultVector);
+        operation(value, pattern, defaultGroup, result, resultVector, dataPtr);
     }
 
     static std::vector<std::string> regexExtractAll(
-        const std::string& value, const std::string& pattern, std::int64_t& group) {
-        RE2 regex(parseCypherPatten(pattern));
+        std::string_view value, const RE2& regex, std::int64_t& group) {
         auto submatchCount = regex.NumberOfCapturingGroups() + 1;
         if (group >= submatchCount) {
             throw common::RuntimeException("Regex match group index is out of range");
@@ -3,27 +3,27 @@
 #include "common/types/ku_string.h"
 #include "common/vector/value_vector.h"
 #include "function/string/functions/base_regexp_function.h"
-#include "re2.h"
 
 namespace kuzu {
 namespace function {
 
 struct RegexpExtract : BaseRegexpOperation {
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
-        std::int64_t& group, common::ku_string_t& result, common::ValueVector& resultValueVector) {
-        regexExtract(value.getAsString(), pattern.getAsString(), group, result, resultValueVector);
+        std::int64_t& group, common::ku_string_t& result, common::ValueVector& resultValueVector,
+        void* dataPtr) {
+        applyRegex(pattern, dataPtr, [&](const RE2& regex) {
+            regexExtract(value.getAsStringView(), regex, group, result, resultValueVector);
+        });
     }
 
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
-        common::ku_string_t& result, common::ValueVector& resultValueVector) {
+        common::ku_string_t& result, common::ValueVector& resultValueVector, void* dataPtr) {
         int64_t defaultGroup = 0;
-        regexExtract(
-            value.getAsString(), pattern.getAsString(), defaultGroup, result, resultValueVector);
+        operation(value, pattern, defaultGroup, result, resultValueVector, dataPtr);
     }
 
-    static void regexExtract(const std::string& input, const std::string& pattern,
-        std::int64_t& group, common::ku_string_t& result, common::ValueVector& resultValueVector) {
-        RE2 regex(parseCypherPatten(pattern));
+    static void regexExtract(std::string_view input, const RE2& regex, std::int64_t& group,
+        common::ku_string_t& result, common::ValueVector& resultValueVector) {
         auto submatchCount = regex.NumberOfCapturingGroups() + 1;
         if (group >= submatchCount) {
             throw common::RuntimeException("Regex match group index is out of range");
@@ -2,15 +2,15 @@
 
 #include "common/types/ku_string.h"
 #include "function/string/functions/base_regexp_function.h"
-#include "re2.h"
 
 namespace kuzu {
 namespace function {
 
 struct RegexpFullMatch : BaseRegexpOperation {
-    static inline void operation(
-        common::ku_string_t& left, common::ku_string_t& right, uint8_t& result) {
-        result = RE2::FullMatch(left.getAsString(), parseCypherPatten(right.getAsString()));
+    static inline void operation(common::ku_string_t& left, common::ku_string_t& right,
+        uint8_t& result, common::ValueVector& /*resultValueVector*/, void* dataPtr) {
+        result = applyRegex(right, dataPtr,
+            [&](const RE2& regex) { return RE2::FullMatch(left.getAsStringView(), regex); });
     }
 };
 
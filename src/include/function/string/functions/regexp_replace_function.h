@@ -2,7 +2,6 @@
 
 #include "common/types/ku_string.h"
 #include "function/string/functions/base_regexp_function.h"
-#include "re2.h"
 
 namespace kuzu {
 namespace function {
@@ -10,10 +9,11 @@ namespace function {
 struct RegexpReplace : BaseRegexpOperation {
     static inline void operation(common::ku_string_t& value, common::ku_string_t& pattern,
         common::ku_string_t& replacement, common::ku_string_t& result,
-        common::ValueVector& resultValueVector) {
+        common::ValueVector& resultValueVector, void* dataPtr) {
         std::string resultStr = value.getAsString();
-        RE2::Replace(
-            &resultStr, parseCypherPatten(pattern.getAsString()), replacement.getAsString());
+        applyRegex(pattern, dataPtr, [&](const RE2& regex) {
+            return RE2::Replace(&resultStr, regex, replacement.getAsStringView());
+        });
         copyToKuzuString(resultStr, result, resultValueVector);
     }
 };
@@ -105,23 +105,33 @@ struct UpperFunction : public VectorStringFunction {
     }
 };
 
-struct RegexpFullMatchFunction : public VectorStringFunction {
+// Regexp functions compile a constant pattern once at bind time. Other patterns are compiled
+// through a cache shared by the threads evaluating the function.
+struct BaseRegexpFunction : public VectorStringFunction {
+    static std::unique_ptr<FunctionBindData> bindFunc(
+        const binder::expression_vector& arguments, Function* definition);
+
+    static std::unique_ptr<FunctionBindData> bindRegexp(
+        const binder::expression_vector& arguments, std::unique_ptr<common::LogicalType> dataType);
+};
+
+struct RegexpFullMatchFunction : public BaseRegexpFunction {
     static function_set getFunctionSet();
 };
 
-struct RegexpMatchesFunction : public VectorStringFunction {
+struct RegexpMatchesFunction : public BaseRegexpFunction {
     static function_set getFunctionSet();
 };
 
-struct RegexpReplaceFunction : public VectorStringFunction {
+struct RegexpReplaceFunction : public BaseRegexpFunction {
     static function_set getFunctionSet();
 };
 
-struct RegexpExtractFunction : public VectorStringFunction {
+struct RegexpExtractFunction : public BaseRegexpFunction {
     static function_set getFunctionSet();
 };
 
-struct RegexpExtractAllFunction : public VectorStringFunction {
+struct RegexpExtractAllFunction : public BaseRegexpFunction {
     static function_set getFunctionSet();
     static std::unique_ptr<FunctionBindData> bindFunc(
         const binder::expression_vector& arguments, Function* function);
@@ -21,6 +21,14 @@ struct TernaryStringFunctionWrapper {
     }
 };
 
+struct TernaryBindDataFunctionWrapper {
+    template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename OP>
+    static inline void operation(A_TYPE& a, B_TYPE& b, C_TYPE& c, RESULT_TYPE& result,
+        void* /*aValueVector*/, void* resultValueVector, void* dataPtr) {
+        OP::operation(a, b, c, result, *(common::ValueVector*)resultValueVector, dataPtr);
+    }
+};
+
 struct TernaryListFunctionWrapper {
     template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename OP>
     static inline void operation(A_TYPE& a, B_TYPE& b, C_TYPE& c, RESULT_TYPE& result,
@@ -411,6 +419,14 @@ struct TernaryFunctionExecutor {
             a, b, c, result, nullptr /* dataPtr */);
     }
 
+    // The function reads state prepared at bind time from the bind data.
+    template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename FUNC>
+    static void executeWithBindData(common::ValueVector& a, common::ValueVector& b,
+        common::ValueVector& c, common::ValueVector& result, void* dataPtr) {
+        executeSwitch<A_TYPE, B_TYPE, C_TYPE, RESULT_TYPE, FUNC, TernaryBindDataFunctionWrapper>(
+            a, b, c, result, dataPtr);
+    }
+
     template<typename A_TYPE, typename B_TYPE, typename C_TYPE, typename RESULT_TYPE, typename FUNC>
     static void executeListStruct(common::ValueVector& a, common::ValueVector& b,
         common::ValueVector& c, common::ValueVector& result) {
@@ -5,6 +5,7 @@
 #include <functional>
 #include <memory>
 
+#include "common/enums/query_priority.h"
 #include "common/timer.h"
 #include "common/types/value/value.h"
 #include "main/kuzu_fwd.h"
@@ -42,6 +43,7 @@ class ClientContext {
     friend struct TimeoutSetting;
     friend struct VarLengthExtendMaxDepthSetting;
     friend struct EnableSemiMaskSetting;
+    friend struct QueryPrioritySetting;
 
 public:
     explicit ClientContext(Database* database);
@@ -60,6 +62,8 @@ public:
 
     inline bool isEnableSemiMask() const { return enableSemiMask; }
 
+    inline common::QueryPriority getQueryPriority() const { return queryPriority; }
+
     void startTimingIfEnabled();
 
     std::string getCurrentSetting(const std::string& optionName);
@@ -82,6 +86,7 @@ private:
     uint32_t varLengthExtendMaxDepth;
     std::unique_ptr<transaction::TransactionContext> transactionContext;
     bool enableSemiMask;
+    common::QueryPriority queryPriority;
     replace_func_t replaceFunc;
     std::unordered_map<std::string, common::Value> extensionOptionValues;
 };
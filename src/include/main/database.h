@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "common/api.h"
+#include "common/enums/eviction_policy_type.h"
 #include "kuzu_fwd.h"
 
 namespace kuzu {
@@ -40,14 +41,18 @@ struct KUZU_API SystemConfig {
      * allowed on the `Database` object. Multiple read-only `Database` objects can be created with
      * the same database path. If false, the database is opened read-write. Under this mode,
      * there must not be multiple `Database` objects created with the same database path.
+     * @param evictionPolicy The replacement policy of the buffer pool. TWO_QUEUE keeps frequently
+     * accessed pages cached while large scans run.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
-        bool enableCompression = true, bool readOnly = false);
+        bool enableCompression = true, bool readOnly = false,
+        common::EvictionPolicyType evictionPolicy = common::EvictionPolicyType::FIFO);
 
     uint64_t bufferPoolSize;
     uint64_t maxNumThreads;
     bool enableCompression;
     bool readOnly;
+    common::EvictionPolicyType evictionPolicy;
 };
 
 /**
@@ -95,6 +100,8 @@ public:
 
     ExtensionOption* getExtensionOption(std::string name);
 
+    inline const std::string& getDatabasePath() const { return databasePath; }
+
 private:
     void openLockFile();
     void initDBDirAndCoreFilesIfNecessary();
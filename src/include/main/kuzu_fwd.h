@@ -11,6 +11,7 @@ class TestHelper;
 class TestRunner;
 class TinySnbDDLTest;
 class TinySnbCopyCSVTransactionTest;
+class PipelineSchedulingTest;
 } // namespace testing
 
 namespace benchmark {
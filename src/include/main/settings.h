@@ -55,5 +55,18 @@ struct EnableSemiMaskSetting {
     }
 };
 
+struct QueryPrioritySetting {
+    static constexpr const char* name = "query_priority";
+    static constexpr const common::LogicalTypeID inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        KU_ASSERT(parameter.getDataType()->getLogicalTypeID() == common::LogicalTypeID::STRING);
+        context->queryPriority =
+            common::QueryPriorityUtils::fromString(parameter.getValue<std::string>());
+    }
+    static std::string getSetting(ClientContext* context) {
+        return common::QueryPriorityUtils::toString(context->queryPriority);
+    }
+};
+
 } // namespace main
 } // namespace kuzu
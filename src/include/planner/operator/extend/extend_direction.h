@@ -23,6 +23,17 @@ struct ExtendDirectionUtils {
         }
     }
 
+    static inline ExtendDirection getOppositeDirection(ExtendDirection extendDirection) {
+        switch (extendDirection) {
+        case ExtendDirection::FWD:
+            return ExtendDirection::BWD;
+        case ExtendDirection::BWD:
+            return ExtendDirection::FWD;
+        default:
+            return ExtendDirection::BOTH;
+        }
+    }
+
     static inline common::RelDataDirection getRelDataDirection(ExtendDirection extendDirection) {
         KU_ASSERT(extendDirection != ExtendDirection::BOTH);
         return extendDirection == ExtendDirection::FWD ? common::RelDataDirection::FWD :
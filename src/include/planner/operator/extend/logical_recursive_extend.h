@@ -25,15 +25,28 @@ public:
     inline void setJoinType(RecursiveJoinType joinType_) { joinType = joinType_; }
     inline RecursiveJoinType getJoinType() const { return joinType; }
     inline std::shared_ptr<LogicalOperator> getRecursiveChild() const { return recursiveChild; }
+    // Recursive plan that extends in the opposite direction, for searching a shortest path from
+    // both ends. Null if the rel can't be searched backward.
+    inline void setBwdRecursiveChild(std::shared_ptr<LogicalOperator> bwdRecursiveChild_) {
+        bwdRecursiveChild = std::move(bwdRecursiveChild_);
+    }
+    inline std::shared_ptr<LogicalOperator> getBwdRecursiveChild() const {
+        return bwdRecursiveChild;
+    }
 
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
+        auto extend = std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
             joinType, children[0]->copy(), recursiveChild->copy());
+        if (bwdRecursiveChild != nullptr) {
+            extend->setBwdRecursiveChild(bwdRecursiveChild->copy());
+        }
+        return extend;
     }
 
 private:
     RecursiveJoinType joinType;
     std::shared_ptr<LogicalOperator> recursiveChild;
+    std::shared_ptr<LogicalOperator> bwdRecursiveChild;
 };
 
 class LogicalPathPropertyProbe : public LogicalOperator {
@@ -49,9 +49,15 @@ public:
         return aggregateExpressions;
     }
 
+    // Cardinality of the input estimated by the planner, which bounds the number of groups.
+    inline void setInputCardinality(uint64_t cardinality) { inputCardinality = cardinality; }
+    inline uint64_t getInputCardinality() const { return inputCardinality; }
+
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalAggregate>(
+        auto aggregate = make_unique<LogicalAggregate>(
             keyExpressions, dependentKeyExpressions, aggregateExpressions, children[0]->copy());
+        aggregate->setInputCardinality(inputCardinality);
+        return aggregate;
     }
 
 private:
@@ -64,6 +70,7 @@ private:
     // be treated as a hash key during hash aggregation.
     binder::expression_vector dependentKeyExpressions;
     binder::expression_vector aggregateExpressions;
+    uint64_t inputCardinality = 0;
 };
 
 } // namespace planner
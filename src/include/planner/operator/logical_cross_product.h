@@ -12,7 +12,7 @@ public:
         std::shared_ptr<LogicalOperator> probeChild, std::shared_ptr<LogicalOperator> buildChild)
         : LogicalOperator{LogicalOperatorType::CROSS_PRODUCT, std::move(probeChild),
               std::move(buildChild)},
-          accumulateType{accumulateType} {}
+          accumulateType{accumulateType}, probeSideCardinality{0}, buildSideCardinality{0} {}
 
     void computeFactorizedSchema() override;
     void computeFlatSchema() override;
@@ -21,13 +21,27 @@ public:
 
     inline common::AccumulateType getAccumulateType() const { return accumulateType; }
 
+    // Cardinalities estimated by the planner for both sides, kept for the hash join the optimizer
+    // may rewrite this cross product into. Zero if unknown.
+    inline void setSideCardinalities(
+        uint64_t probeSideCardinality_, uint64_t buildSideCardinality_) {
+        probeSideCardinality = probeSideCardinality_;
+        buildSideCardinality = buildSideCardinality_;
+    }
+    inline uint64_t getProbeSideCardinality() const { return probeSideCardinality; }
+    inline uint64_t getBuildSideCardinality() const { return buildSideCardinality; }
+
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalCrossProduct>(
+        auto crossProduct = make_unique<LogicalCrossProduct>(
             accumulateType, children[0]->copy(), children[1]->copy());
+        crossProduct->setSideCardinalities(probeSideCardinality, buildSideCardinality);
+        return crossProduct;
     }
 
 private:
     common::AccumulateType accumulateType;
+    uint64_t probeSideCardinality;
+    uint64_t buildSideCardinality;
 };
 
 } // namespace planner
@@ -42,15 +42,22 @@ public:
         return result;
     }
 
+    // Cardinality of the input estimated by the planner, which bounds the number of groups.
+    inline void setInputCardinality(uint64_t cardinality) { inputCardinality = cardinality; }
+    inline uint64_t getInputCardinality() const { return inputCardinality; }
+
     std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalDistinct>(
+        auto distinct = make_unique<LogicalDistinct>(
             keyExpressions, dependentKeyExpressions, children[0]->copy());
+        distinct->setInputCardinality(inputCardinality);
+        return distinct;
     }
 
 private:
     binder::expression_vector keyExpressions;
     // See logical_aggregate.h for details.
     binder::expression_vector dependentKeyExpressions;
+    uint64_t inputCardinality = 0;
 };
 
 } // namespace planner
@@ -40,7 +40,8 @@ public:
         : LogicalOperator{LogicalOperatorType::HASH_JOIN, std::move(probeSideChild),
               std::move(buildSideChild)},
           joinConditions(std::move(joinConditions)), joinType{joinType}, mark{std::move(mark)},
-          sip{SidewaysInfoPassing::NONE}, order{JoinSubPlanSolveOrder::ANY} {}
+          sip{SidewaysInfoPassing::NONE}, order{JoinSubPlanSolveOrder::ANY},
+          probeSideCardinality{0}, buildSideCardinality{0} {}
 
     f_group_pos_set getGroupsPosToFlattenOnProbeSide();
     f_group_pos_set getGroupsPosToFlattenOnBuildSide();
@@ -69,9 +70,20 @@ public:
     inline void setJoinSubPlanSolveOrder(JoinSubPlanSolveOrder order_) { order = order_; }
     inline JoinSubPlanSolveOrder getJoinSubPlanSolveOrder() const { return order; }
 
+    // Cardinalities estimated by the planner for both sides. Zero if unknown.
+    inline void setSideCardinalities(
+        uint64_t probeSideCardinality_, uint64_t buildSideCardinality_) {
+        probeSideCardinality = probeSideCardinality_;
+        buildSideCardinality = buildSideCardinality_;
+    }
+    inline uint64_t getProbeSideCardinality() const { return probeSideCardinality; }
+    inline uint64_t getBuildSideCardinality() const { return buildSideCardinality; }
+
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalHashJoin>(
+        auto hashJoin = make_unique<LogicalHashJoin>(
             joinConditions, joinType, mark, children[0]->copy(), children[1]->copy());
+        hashJoin->setSideCardinalities(probeSideCardinality, buildSideCardinality);
+        return hashJoin;
     }
 
     // Flat probe side key group in either of the following two cases:
@@ -93,6 +105,8 @@ private:
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark
     SidewaysInfoPassing sip;
     JoinSubPlanSolveOrder order; // sip introduce join dependency
+    uint64_t probeSideCardinality;
+    uint64_t buildSideCardinality;
 };
 
 } // namespace planner
@@ -38,12 +38,19 @@ public:
     inline void setSIP(SidewaysInfoPassing sip_) { sip = sip_; }
     inline SidewaysInfoPassing getSIP() const { return sip; }
 
+    // Total cardinality of the build sides estimated by the planner.
+    inline void setBuildSideCardinality(uint64_t cardinality) {
+        buildSideCardinality = cardinality;
+    }
+    inline uint64_t getBuildSideCardinality() const { return buildSideCardinality; }
+
     std::unique_ptr<LogicalOperator> copy() override;
 
 private:
     std::shared_ptr<binder::Expression> intersectNodeID;
     binder::expression_vector keyNodeIDs;
     SidewaysInfoPassing sip;
+    uint64_t buildSideCardinality = 0;
 };
 
 } // namespace planner
@@ -32,8 +32,15 @@ public:
     inline bool hasLimitNum() const { return limitNum != UINT64_MAX; }
     inline uint64_t getLimitNum() const { return limitNum; }
 
+    // Cardinality of the input estimated by the planner.
+    inline void setInputCardinality(uint64_t cardinality) { inputCardinality = cardinality; }
+    inline uint64_t getInputCardinality() const { return inputCardinality; }
+
     inline std::unique_ptr<LogicalOperator> copy() final {
-        return make_unique<LogicalOrderBy>(expressionsToOrderBy, isAscOrders, children[0]->copy());
+        auto orderBy =
+            make_unique<LogicalOrderBy>(expressionsToOrderBy, isAscOrders, children[0]->copy());
+        orderBy->setInputCardinality(inputCardinality);
+        return orderBy;
     }
 
 private:
@@ -41,6 +48,7 @@ private:
     std::vector<bool> isAscOrders;
     uint64_t skipNum = UINT64_MAX;
     uint64_t limitNum = UINT64_MAX;
+    uint64_t inputCardinality = 0;
 };
 
 } // namespace planner
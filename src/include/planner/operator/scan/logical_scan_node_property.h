@@ -25,16 +25,25 @@ public:
     inline std::shared_ptr<binder::Expression> getNodeID() const { return nodeID; }
     inline std::vector<common::table_id_t> getTableIDs() const { return nodeTableIDs; }
     inline binder::expression_vector getProperties() const { return properties; }
+    inline void setPredicates(binder::expression_vector predicates_) {
+        predicates = std::move(predicates_);
+    }
+    inline binder::expression_vector getPredicates() const { return predicates; }
 
     inline std::unique_ptr<LogicalOperator> copy() final {
-        return make_unique<LogicalScanNodeProperty>(
+        auto op = make_unique<LogicalScanNodeProperty>(
             nodeID, nodeTableIDs, properties, children[0]->copy());
+        op->setPredicates(predicates);
+        return op;
     }
 
 private:
     std::shared_ptr<binder::Expression> nodeID;
     std::vector<common::table_id_t> nodeTableIDs;
     binder::expression_vector properties;
+    // Predicates which are evaluated by a filter directly on top of this scan. The scan may use
+    // them to skip node groups whose zone maps rule out any match; the filter still evaluates them.
+    binder::expression_vector predicates;
 };
 
 } // namespace planner
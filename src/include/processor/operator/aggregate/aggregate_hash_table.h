@@ -59,6 +59,38 @@ public:
 
     inline uint64_t getNumEntries() const { return factorizedTable->getNumTuples(); }
 
+    inline const std::vector<common::LogicalType>& getKeyDataTypes() const { return keyDataTypes; }
+    inline const std::vector<common::LogicalType>& getDependentKeyDataTypes() const {
+        return dependentKeyDataTypes;
+    }
+
+    // Makes the hash table record the entries of each radix partition as they are created.
+    inline void enablePartitioning() {
+        partitionedEntries.resize(common::HashAggregateConstants::NUM_PARTITIONS);
+    }
+    inline const std::vector<uint8_t*>& getPartitionEntries(uint64_t partitionIdx) const {
+        KU_ASSERT(partitionIdx < partitionedEntries.size());
+        return partitionedEntries[partitionIdx];
+    }
+    static inline uint64_t getPartitionIdx(common::hash_t hash) {
+        // The low bits of the hash are used for the slot idx, so partition by the high bits.
+        return hash >> (64 - common::HashAggregateConstants::NUM_PARTITIONS_LOG2);
+    }
+
+    // Memory held by the entries and hash slots. Overflow data of keys and aggregate states, e.g.,
+    // strings, is not counted.
+    inline uint64_t getMemoryUsage() const {
+        return getNumEntries() * factorizedTable->getTableSchema()->getNumBytesPerTuple() +
+               maxNumHashSlots * sizeof(HashSlot);
+    }
+    // Spills the entries of the table, see FactorizedTable::spill(), and frees its hash slots.
+    // Once reloaded, the table can only be merged into another hash table. Data that aggregate
+    // states hold outside of the entries, e.g., the lists of COLLECT, stays in memory.
+    void spill();
+    inline void reload() { factorizedTable->reload(); }
+
+    std::unique_ptr<AggregateHashTable> createEmptyCopy() const;
+
     inline void append(const std::vector<common::ValueVector*>& flatKeyVectors,
         const std::vector<common::ValueVector*>& unFlatKeyVectors,
         common::DataChunkState* leadingState,
@@ -80,7 +112,10 @@ public:
         const std::vector<common::ValueVector*>& groupByKeyVectors,
         common::ValueVector* aggregateVector);
 
-    //! merge aggregate hash table by combining aggregate states under the same key
+    //! merge one radix partition of a partitioned aggregate hash table by combining aggregate
+    //! states under the same key
+    void merge(AggregateHashTable& other, uint64_t partitionIdx);
+    //! merge all entries of a hash table with the same schema
     void merge(AggregateHashTable& other);
 
     void finalizeAggregateStates();
@@ -88,6 +123,9 @@ public:
     void resize(uint64_t newSize);
 
 private:
+    void merge(const FactorizedTable& tableToRead, uint8_t** entriesToMerge,
+        uint64_t numEntriesToMerge);
+
     void initializeFT(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions);
 
@@ -221,6 +259,8 @@ private:
 
     //! special handling of distinct aggregate
     std::vector<std::unique_ptr<AggregateHashTable>> distinctHashTables;
+    //! entries grouped by radix partition, empty if partitioning is not enabled
+    std::vector<std::vector<uint8_t*>> partitionedEntries;
     uint32_t hashColIdxInFT;
     uint32_t hashColOffsetInFT;
     uint32_t aggStateColOffsetInFT;
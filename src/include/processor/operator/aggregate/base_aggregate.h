@@ -12,8 +12,6 @@ protected:
     explicit BaseAggregateSharedState(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions);
 
-    virtual std::pair<uint64_t, uint64_t> getNextRangeToRead() = 0;
-
     ~BaseAggregateSharedState() = default;
 
 protected:
@@ -43,10 +41,9 @@ protected:
     std::vector<std::unique_ptr<AggregateInputInfo>> cloneAggInputInfos();
     std::unique_ptr<PhysicalOperator> clone() override = 0;
 
-private:
+protected:
     bool containDistinctAggregate() const;
 
-protected:
     std::vector<std::unique_ptr<function::AggregateFunction>> aggregateFunctions;
     std::vector<std::unique_ptr<AggregateInputInfo>> aggregateInputInfos;
     std::vector<std::unique_ptr<AggregateInput>> aggregateInputs;
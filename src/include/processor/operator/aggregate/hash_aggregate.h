@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "aggregate_hash_table.h"
 #include "processor/operator/aggregate/base_aggregate.h"
 
@@ -12,23 +14,77 @@ class HashAggregateSharedState final : public BaseAggregateSharedState {
 public:
     explicit HashAggregateSharedState(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions)
-        : BaseAggregateSharedState{aggregateFunctions} {}
-
-    void appendAggregateHashTable(std::unique_ptr<AggregateHashTable> aggregateHashTable);
-
+        : BaseAggregateSharedState{aggregateFunctions}, hasSpilled{false}, numSpilledEntries{0},
+          nextPartitionIdxToRead{0}, nextPartitionIdxToLoad{0} {}
+
+    // Whether a thread should spill its local hash table. A thread may hold its share of the spill
+    // memory limit of the memory manager in its local hash table, unless the memory manager is
+    // over the limit already. Tables are only spilled once their partitions have a minimum size.
+    static bool shouldSpill(const AggregateHashTable& localHashTable,
+        storage::MemoryManager& memoryManager, uint64_t numThreads);
+    // Moves the entries of each partition of a local hash table into a table that is spilled, see
+    // FactorizedTable::spill(), after which the local hash table can be freed. Once anything is
+    // spilled, partitions are merged lazily by getNextRangeToRead().
+    void spill(AggregateHashTable& localHashTable, storage::MemoryManager& memoryManager);
+
+    // Appends the local hash table of a thread that has consumed all of its input, and merges the
+    // local hash tables appended before it into the global partitions. Threads merge different
+    // partitions at the same time, and while other threads are still building.
+    void appendAggregateHashTable(
+        std::unique_ptr<AggregateHashTable> aggregateHashTable, ExecutionContext* context);
+
+    // Merges the local hash tables that are not merged yet. Called once all threads are done.
     void combineAggregateHashTable(storage::MemoryManager& memoryManager);
 
-    void finalizeAggregateHashTable();
-
-    std::pair<uint64_t, uint64_t> getNextRangeToRead() override;
+    // The number of groups, or an upper bound of it if the hash tables are spilled.
+    uint64_t getNumTuples() const;
+
+    // Returns a partition and the range of its entries to read next. Ranges rotate over the
+    // partitions that are loaded. When none of them has entries left, the caller loads the next
+    // partition, i.e., finalizes its aggregate states, after merging the local hash tables and
+    // spilled entries of it if the hash tables are spilled. So concurrent readers load different
+    // partitions in parallel, and only the partitions being read are held in memory.
+    std::tuple<uint64_t, uint64_t, uint64_t> getNextRangeToRead(
+        storage::MemoryManager& memoryManager);
+    inline AggregateHashTable* getPartitionHashTable(uint64_t partitionIdx) {
+        return partitions[partitionIdx].hashTable.get();
+    }
+    // Frees the partition once all of its entries are read, if the hash tables are spilled.
+    void finishReadingRange(uint64_t partitionIdx);
 
-    inline uint8_t* getRow(uint64_t idx) { return globalAggregateHashTable->getEntry(idx); }
+    inline uint64_t getNumSpilledEntries() const { return numSpilledEntries; }
 
-    FactorizedTable* getFactorizedTable() { return globalAggregateHashTable->getFactorizedTable(); }
+private:
+    struct Partition {
+        std::mutex mtx;
+        std::unique_ptr<AggregateHashTable> hashTable;
+        // Local hash tables are merged into the partition in the order that they are appended.
+        uint64_t numLocalHashTablesMerged = 0;
+        // Spilled tables of the entries of the partition, which are merged when it is loaded.
+        std::vector<std::unique_ptr<AggregateHashTable>> spilledHashTables;
+        bool isLoaded = false;
+        uint64_t numEntriesRead = 0;
+        uint64_t numReaders = 0;
+    };
+
+    void setDataTypesIfNecessary(const AggregateHashTable& hashTable);
+    void createPartitionHashTableIfNecessary(
+        Partition& partition, uint64_t numEntries, storage::MemoryManager& memoryManager);
+    void mergeLocalHashTables(const std::vector<AggregateHashTable*>& localHashTables,
+        uint64_t startPartitionIdx, storage::MemoryManager& memoryManager);
+    void mergeLocalHashTables(const std::vector<AggregateHashTable*>& localHashTables,
+        uint64_t partitionIdx, Partition& partition, storage::MemoryManager& memoryManager);
+    void loadPartition(uint64_t partitionIdx, storage::MemoryManager& memoryManager);
 
 private:
     std::vector<std::unique_ptr<AggregateHashTable>> localAggregateHashTables;
-    std::unique_ptr<AggregateHashTable> globalAggregateHashTable;
+    std::vector<common::LogicalType> keyDataTypes;
+    std::vector<common::LogicalType> dependentKeyDataTypes;
+    std::atomic<bool> hasSpilled;
+    std::atomic<uint64_t> numSpilledEntries;
+    std::array<Partition, common::HashAggregateConstants::NUM_PARTITIONS> partitions;
+    uint64_t nextPartitionIdxToRead;
+    uint64_t nextPartitionIdxToLoad;
 };
 
 class HashAggregate : public BaseAggregate {
@@ -50,6 +106,9 @@ public:
 
     void finalize(ExecutionContext* context) override;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     inline std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<HashAggregate>(resultSetDescriptor->copy(), sharedState, flatKeysPos,
             unFlatKeysPos, dependentKeysPos, cloneAggFunctions(), cloneAggInputInfos(),
@@ -29,6 +29,7 @@ public:
 
     inline bool isSource() const override { return true; }
     inline bool canParallel() const final { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
@@ -15,6 +15,7 @@ public:
 
     inline bool isSource() const final { return true; }
     inline bool canParallel() const final { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/constants.h"
+#include "common/types/types.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+namespace kuzu {
+namespace processor {
+
+// A blocked Bloom filter over key hashes. All bits of a key are set in a single 64-bit block, so
+// that a lookup touches one cache line. The block is picked by the low bits of the hash and the
+// bits within the block by its high bits. The blocks are stored in memory manager buffers.
+class BloomFilter {
+public:
+    BloomFilter(storage::MemoryManager& memoryManager, uint64_t numKeys);
+
+    void insert(common::hash_t hash) { getBlock(hash) |= getBitMask(hash); }
+    bool mayContain(common::hash_t hash) const {
+        auto bitMask = getBitMask(hash);
+        return (getBlock(hash) & bitMask) == bitMask;
+    }
+
+private:
+    static constexpr uint64_t NUM_BLOCKS_PER_BUFFER_LOG2 =
+        common::BufferPoolConstants::PAGE_256KB_SIZE_LOG2 - 3;
+    static constexpr uint64_t BLOCK_IDX_IN_BUFFER_MASK = (1ull << NUM_BLOCKS_PER_BUFFER_LOG2) - 1;
+
+    inline uint64_t& getBlock(common::hash_t hash) const {
+        auto blockIdx = hash & blockIdxMask;
+        return ((uint64_t*)buffers[blockIdx >> NUM_BLOCKS_PER_BUFFER_LOG2]
+                    ->buffer)[blockIdx & BLOCK_IDX_IN_BUFFER_MASK];
+    }
+    static uint64_t getBitMask(common::hash_t hash);
+
+private:
+    std::vector<std::unique_ptr<storage::MemoryBuffer>> buffers;
+    uint64_t blockIdxMask;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "join_hash_table.h"
+#include "processor/operator/hash_join/hash_join_partitioner.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
@@ -17,10 +18,16 @@ class HashJoinBuild;
 // HashJoinBuild thread when they finished materializing thread-local tuples. Also, the state holds
 // a global htDirectory, which will be updated by the last thread in the hash join build side
 // task/pipeline, and probed by the HashJoinProbe operators.
+//
+// If the join can spill, build tuples that arrive after the memory manager runs low on memory are
+// written to radix partitions that are spilled to disk, instead of the in-memory hash table. The
+// probe joins each probe tuple with the in-memory hash table right away, and spills it to the
+// partition it hashes to as well. Once the probe side is exhausted, each spilled partition is
+// reloaded and joined with the probe tuples of the partition.
 class HashJoinSharedState {
 public:
-    explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
-        : hashTable{std::move(hashTable)} {};
+    explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable, bool canSpill = false)
+        : hashTable{std::move(hashTable)}, canSpill{canSpill}, isSpilling{false} {};
 
     virtual ~HashJoinSharedState() = default;
 
@@ -28,9 +35,59 @@ public:
 
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    // The Bloom filter over the keys of the hash table lets the probe side drop tuples that can't
+    // match right after they are scanned, see JoinKeyFilter. It is only created if it is enabled,
+    // and if the build side didn't spill, since the keys of spilled tuples aren't inserted. Keys
+    // are inserted while the hash slots are built.
+    inline void enableBloomFilter() { isBloomFilterEnabled = true; }
+    BloomFilter* createBloomFilterIfNecessary(storage::MemoryManager& memoryManager);
+    inline const BloomFilter* getBloomFilter() const { return bloomFilter.get(); }
+
+    // Whether build tuples should go to the spilled partitions. Once it returns true, it keeps
+    // returning true.
+    bool shouldSpill(storage::MemoryManager& memoryManager);
+    inline bool hasSpilled() const { return isSpilling; }
+    // Threads spill the table they append the tuples of a partition to once it holds a block of
+    // tuples, so that a spilled partition is made of full blocks, however many tables it has.
+    static inline bool shouldSpillPartition(const FactorizedTable& table) {
+        return table.getNumTuples() >= table.getNumTuplesPerBlock();
+    }
+
+    // Appends a spilled table of the tuples of a partition. Called by build threads only.
+    void appendSpilledPartition(uint64_t partitionIdx, std::unique_ptr<JoinHashTable> table);
+    inline bool hasSpilledPartition(uint64_t partitionIdx) const {
+        return spilledPartitions[partitionIdx].hasTuples;
+    }
+    // Reloads a spilled partition for a probe to join with, merging its tables and building its
+    // hash slots the first time. A partition stays in memory once no probe holds it, since other
+    // probes may still join with it. It is only spilled again when memory runs low as another
+    // partition is reloaded.
+    JoinHashTable* acquireSpilledPartition(
+        uint64_t partitionIdx, storage::MemoryManager& memoryManager);
+    void releaseSpilledPartition(uint64_t partitionIdx);
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+
+private:
+    struct SpilledPartition {
+        std::mutex mtx;
+        std::vector<std::unique_ptr<JoinHashTable>> tables;
+        bool hasTuples = false;
+        bool areHashSlotsBuilt = false;
+        bool isInMemory = false;
+        uint64_t numProbes = 0;
+    };
+
+    void spillUnusedPartitionsIfNecessary(
+        uint64_t partitionIdxToReload, storage::MemoryManager& memoryManager);
+
+    bool isBloomFilterEnabled = false;
+    std::unique_ptr<BloomFilter> bloomFilter;
+    bool canSpill;
+    std::atomic<bool> isSpilling;
+    std::array<SpilledPartition, common::HashJoinConstants::NUM_PARTITIONS> spilledPartitions;
 };
 
 class HashJoinBuildInfo {
@@ -94,6 +151,10 @@ protected:
 private:
     void setKeyState(common::DataChunkState* state);
 
+    void appendVectorsToSpilledPartitions(ExecutionContext* context);
+    void spillPartition(uint64_t partitionIdx);
+    void spillPartitions();
+
 protected:
     std::shared_ptr<HashJoinSharedState> sharedState;
     std::unique_ptr<HashJoinBuildInfo> info;
@@ -104,6 +165,10 @@ protected:
     std::vector<common::ValueVector*> payloadVectors;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
+    std::unique_ptr<HashJoinPartitioner> partitioner;
+    // Tables of the tuples appended to each partition since the partition was last spilled.
+    std::array<std::unique_ptr<JoinHashTable>, common::HashJoinConstants::NUM_PARTITIONS>
+        partitionTables;
 };
 
 } // namespace processor
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <functional>
+
+#include "common/constants.h"
+#include "common/vector/value_vector.h"
+
+namespace kuzu {
+namespace processor {
+
+// Splits the tuples that hash joins spill into radix partitions, by the top bits of the hash of
+// their keys.
+class HashJoinPartitioner {
+public:
+    explicit HashJoinPartitioner(storage::MemoryManager* memoryManager);
+
+    // Calls `func` for each partition that the selected keys of `keyState` hash to, with the state
+    // selecting only the keys of the partition in the meantime. Tuples with null keys are
+    // discarded.
+    void partition(const std::vector<common::ValueVector*>& keyVectors,
+        common::DataChunkState* keyState, const std::function<void(uint64_t)>& func);
+
+    static inline uint64_t getPartitionIdx(common::hash_t hash) {
+        return hash >> (64 - common::HashJoinConstants::NUM_PARTITIONS_LOG2);
+    }
+
+private:
+    std::unique_ptr<common::ValueVector> hashVector;
+    std::unique_ptr<common::ValueVector> tmpHashVector;
+    std::unique_ptr<uint8_t[]> partitionIdxes;
+    std::shared_ptr<common::SelectionVector> partitionSelVector;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -36,6 +36,10 @@ public:
     ProbeDataInfo(const ProbeDataInfo& other)
         : ProbeDataInfo{other.keysDataPos, other.payloadsOutPos} {
         markDataPos = other.markDataPos;
+        spilledVectorsPos = other.spilledVectorsPos;
+        if (other.spilledTableSchema != nullptr) {
+            spilledTableSchema = other.spilledTableSchema->copy();
+        }
     }
 
     inline uint32_t getNumPayloads() const { return payloadsOutPos.size(); }
@@ -44,6 +48,35 @@ public:
     std::vector<DataPos> keysDataPos;
     std::vector<DataPos> payloadsOutPos;
     DataPos markDataPos;
+    // The probe side vectors, which are spilled along with the spilled partitions of the build
+    // side. Only set if the join can spill.
+    std::vector<DataPos> spilledVectorsPos;
+    std::unique_ptr<FactorizedTableSchema> spilledTableSchema;
+};
+
+// Probe tuples of the partitions that the build side spilled, see HashJoinSharedState.
+struct ProbeSpillState {
+    std::unique_ptr<HashJoinPartitioner> partitioner;
+    std::vector<common::ValueVector*> vectors;
+    std::vector<ft_col_idx_t> colIdxes;
+    // Tables of the probe tuples appended to each partition since the partition was last spilled.
+    std::array<std::unique_ptr<FactorizedTable>, common::HashJoinConstants::NUM_PARTITIONS>
+        tablesToAppend;
+    std::array<std::vector<std::unique_ptr<FactorizedTable>>,
+        common::HashJoinConstants::NUM_PARTITIONS>
+        spilledTables;
+    // Set once the probe side is exhausted. Probe tuples are then read back from the spilled
+    // tables, one partition at a time.
+    bool isJoiningSpilledPartitions = false;
+    uint64_t partitionIdx = 0;
+    uint64_t tableIdx = 0;
+    uint64_t tupleIdx = 0;
+    // If all probe side vectors are flat, each spilled tuple is a single row. Rows are then read
+    // back a vector at a time, and handed to the join one at a time by moving the flat positions.
+    bool canScanBatches = false;
+    std::vector<common::DataChunkState*> flatStates;
+    uint64_t numTuplesInBatch = 0;
+    uint64_t nextTupleIdxInBatch = 0;
 };
 
 // Probe side on left, i.e. children[0] and build side on right, i.e. children[1]
@@ -77,6 +110,14 @@ public:
     }
 
 private:
+    bool getNextProbeTuple(ExecutionContext* context);
+    void appendToSpilledPartitions(ExecutionContext* context);
+    void spillPartition(uint64_t partitionIdx);
+    void spillPartitions();
+    bool scanNextSpilledProbeTuple(ExecutionContext* context);
+    void scanSpilledProbeTuples(FactorizedTable& table);
+    void selectSpilledProbeTupleInBatch();
+
     inline bool getMatchedTuples(ExecutionContext* context) {
         return flatProbe ? getMatchedTuplesForFlatKey(context) :
                            getMatchedTuplesForUnFlatKey(context);
@@ -99,6 +140,9 @@ private:
     std::shared_ptr<HashJoinSharedState> sharedState;
     common::JoinType joinType;
     bool flatProbe;
+    // The in-memory hash table, or the spilled partition that is being joined.
+    JoinHashTable* hashTable = nullptr;
+    std::unique_ptr<ProbeSpillState> spillState;
 
     ProbeDataInfo probeDataInfo;
     std::vector<common::ValueVector*> vectorsToReadInto;
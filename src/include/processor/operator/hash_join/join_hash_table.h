@@ -3,6 +3,7 @@
 #include <functional>
 
 #include "processor/operator/base_hash_table.h"
+#include "processor/operator/hash_join/bloom_filter.h"
 #include "storage/buffer_manager/memory_manager.h"
 
 namespace kuzu {
@@ -27,9 +28,24 @@ public:
     void appendVectorWithSorting(
         common::ValueVector* keyVector, std::vector<common::ValueVector*> payloadVectors);
 
-    void allocateHashSlots(uint64_t numTuples);
-    void buildHashSlots();
+    // Returns an empty hash table with the same key types and table schema.
+    std::unique_ptr<JoinHashTable> createEmptyCopy() const;
 
+    void allocateHashSlots(uint64_t numTuples);
+    // Inserts all tuples into the hash slots. Tuples are radix-partitioned by the slot block they
+    // hash to first, if the hash slots span more than one block. The key hashes are inserted into
+    // the Bloom filter as well, if one is given.
+    void buildHashSlots(BloomFilter* bloomFilter = nullptr);
+    // Inserts the tuples into the hash slots in the order they are stored in the table.
+    void buildHashSlotsSequentially(BloomFilter* bloomFilter = nullptr);
+    // Inserts the tuples into the hash slots one slot block at a time. Each block is small enough
+    // to stay in cache while its tuples are inserted, while inserting tuples in the order they are
+    // stored takes a cache miss on almost every slot once the slots outgrow the cache. The tuples
+    // are scattered by partition into an array allocated through the memory manager.
+    void buildHashSlotsByPartition(BloomFilter* bloomFilter = nullptr);
+
+    // Looks up the first tuple of the chain of each key. The slots of all keys are looked up (and
+    // prefetched) before any of them are read, so that their cache misses overlap.
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector* hashVector,
         common::ValueVector* tmpHashVector, uint8_t** probedTuples);
     // All key vectors must be flat. Thus input is a tuple, multiple matches can be found for the
@@ -50,20 +66,30 @@ public:
     inline uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
-    inline uint8_t* getTupleForHash(common::hash_t hash) {
-        auto slotIdx = getSlotIdxForHash(hash);
-        return ((uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]
-                                ->getData()))[slotIdx & slotIdxInBlockMask];
-    }
+    inline uint8_t* getTupleForHash(common::hash_t hash) { return *getHashSlot(hash); }
+    // Spills the tuples and hash slots of the table, see MemoryBuffer::spill().
+    void spill();
+    void reload();
+
+    // Returns false if all keys are discarded.
+    static bool discardNullFromKeys(const std::vector<common::ValueVector*>& vectors);
+    static void computeVectorHashes(const std::vector<common::ValueVector*>& keyVectors,
+        common::ValueVector* hashVector, common::ValueVector* tmpHashVector);
+
     inline FactorizedTable* getFactorizedTable() { return factorizedTable.get(); }
     inline const FactorizedTableSchema* getTableSchema() {
         return factorizedTable->getTableSchema();
     }
 
 private:
-    uint8_t** findHashSlot(uint8_t* tuple) const;
+    inline uint8_t** getHashSlot(common::hash_t hash) const {
+        auto slotIdx = getSlotIdxForHash(hash);
+        return (uint8_t**)hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
+               (slotIdx & slotIdxInBlockMask);
+    }
+    common::hash_t computeTupleHash(const uint8_t* tuple) const;
     // This function returns the pointer that previously stored in the same slot.
-    uint8_t* insertEntry(uint8_t* tuple) const;
+    uint8_t* insertEntry(uint8_t* tuple, common::hash_t hash) const;
 
     bool compareFlatKeys(const std::vector<common::ValueVector*>& keyVectors, const uint8_t* tuple);
 
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "processor/operator/filtering_operator.h"
+#include "processor/operator/hash_join/hash_join_build.h"
+#include "processor/operator/physical_operator.h"
+
+namespace kuzu {
+namespace processor {
+
+// Drops the probe side tuples of a hash join whose key isn't in the Bloom filter over the build
+// keys. It is placed right above the lowest probe side operator that the key is in scope of, so
+// that tuples that can't match are dropped before they are flattened or extended. Threads stop
+// checking keys if nearly all keys they check pass the filter.
+class JoinKeyFilter : public PhysicalOperator, public SelVectorOverWriter {
+public:
+    JoinKeyFilter(std::shared_ptr<HashJoinSharedState> sharedState, const DataPos& keyPos,
+        std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString)
+        : PhysicalOperator{
+              PhysicalOperatorType::JOIN_KEY_FILTER, std::move(child), id, paramsString},
+          sharedState{std::move(sharedState)}, keyPos{keyPos} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
+    inline std::unique_ptr<PhysicalOperator> clone() override {
+        return std::make_unique<JoinKeyFilter>(
+            sharedState, keyPos, children[0]->clone(), id, paramsString);
+    }
+
+private:
+    // Returns the number of selected keys that pass the filter, and selects only them.
+    common::sel_t filterKeys();
+
+    inline std::string getNumFilteredTupleMetricKey() const {
+        return "numFilteredTuple-" + std::to_string(id);
+    }
+
+private:
+    std::shared_ptr<HashJoinSharedState> sharedState;
+    DataPos keyPos;
+    const BloomFilter* bloomFilter = nullptr;
+    common::ValueVector* keyVector = nullptr;
+    std::unique_ptr<common::ValueVector> hashVector;
+    uint64_t numKeysChecked = 0;
+    uint64_t numKeysPassed = 0;
+    common::NumericMetric* numFilteredTuples = nullptr;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -13,6 +13,7 @@ public:
 
     inline bool isSource() const override { return true; }
     inline bool canParallel() const override { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "common/types/internal_id_t.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace processor {
+
+/**
+ * Kernels that intersect two lists of node IDs sorted by offset. Equal offsets are matched one to
+ * one in order, as a merge of the two lists would do, so duplicated offsets in both lists match as
+ * many times as they occur in the list with fewer of them. Each kernel writes the positions of the
+ * matched elements in the left and right list, and returns the number of matches.
+ *
+ * The block kernels compare blocks of 4 (AVX2) or 8 (AVX-512) offsets of both lists against each
+ * other with SIMD instructions, which replaces most of the unpredictable branches of a merge. If
+ * the right list is much longer than the left one, galloping (exponential search) skips over most
+ * of the right list instead.
+ */
+struct IntersectKernels {
+    using intersect_func_t = uint64_t (*)(const common::nodeID_t* left, uint64_t leftSize,
+        const common::nodeID_t* right, uint64_t rightSize, common::sel_t* leftPositions,
+        common::sel_t* rightPositions);
+
+    // Gallop over the right list if it is at least this many times longer than the left one.
+    static constexpr uint64_t GALLOPING_SIZE_RATIO = 32;
+
+    // Picks galloping or the block kernel of the widest instruction set the CPU supports.
+    static uint64_t intersect(const common::nodeID_t* left, uint64_t leftSize,
+        const common::nodeID_t* right, uint64_t rightSize, common::sel_t* leftPositions,
+        common::sel_t* rightPositions);
+
+    static uint64_t mergeIntersect(const common::nodeID_t* left, uint64_t leftSize,
+        const common::nodeID_t* right, uint64_t rightSize, common::sel_t* leftPositions,
+        common::sel_t* rightPositions);
+    static uint64_t gallopingIntersect(const common::nodeID_t* left, uint64_t leftSize,
+        const common::nodeID_t* right, uint64_t rightSize, common::sel_t* leftPositions,
+        common::sel_t* rightPositions);
+    // Return nullptr if the compiler or the CPU does not support the instruction set.
+    static intersect_func_t getAVX2Kernel();
+    static intersect_func_t getAVX512Kernel();
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -13,6 +13,7 @@ public:
 
     bool isSource() const override { return true; }
     bool canParallel() const override { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionContext* /*context*/) override {
         hasExecuted = false;
@@ -32,6 +32,7 @@ public:
 
     inline bool isSource() const override { return true; }
     inline bool canParallel() const final { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     inline void initLocalStateInternal(
         ResultSet* resultSet, ExecutionContext* /*context*/) override {
@@ -89,6 +89,9 @@ public:
         std::shared_ptr<PartitionerSharedState> sharedState,
         std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString);
 
+    // The partitions are read by the copy.
+    inline bool hasSideEffects() const final { return true; }
+
     void initGlobalStateInternal(ExecutionContext* context) final;
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
     void executeInternal(ExecutionContext* context) final;
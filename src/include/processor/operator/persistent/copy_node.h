@@ -102,6 +102,7 @@ public:
     inline std::shared_ptr<CopyNodeSharedState> getSharedState() const { return sharedState; }
 
     inline bool canParallel() const final { return !info->containsSerial; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initGlobalStateInternal(ExecutionContext* context) final;
 
@@ -18,6 +18,7 @@ public:
           sharedState{std::move(sharedState)} {}
 
     bool isSource() const override { return true; }
+    inline bool hasSideEffects() const final { return true; }
 
     void executeInternal(ExecutionContext*) override {}
 
@@ -74,6 +74,7 @@ public:
     inline std::shared_ptr<CopyRelSharedState> getSharedState() const { return sharedState; }
 
     inline bool isSource() const final { return true; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet_, ExecutionContext* context) final;
     void initGlobalStateInternal(ExecutionContext* context) final;
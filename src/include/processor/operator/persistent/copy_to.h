@@ -52,6 +52,8 @@ public:
           info{std::move(info)}, localState{std::move(localState)}, sharedState{
                                                                         std::move(sharedState)} {}
 
+    inline bool hasSideEffects() const final { return true; }
+
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
     void initGlobalStateInternal(ExecutionContext* context) final;
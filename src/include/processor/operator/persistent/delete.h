@@ -14,6 +14,7 @@ public:
           executors{std::move(executors)} {}
 
     inline bool canParallel() const final { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
@@ -33,6 +34,7 @@ public:
           executors{std::move(executors)} {}
 
     inline bool canParallel() const final { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
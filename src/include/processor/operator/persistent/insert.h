@@ -15,6 +15,7 @@ public:
           nodeExecutors{std::move(nodeExecutors)}, relExecutors{std::move(relExecutors)} {}
 
     inline bool canParallel() const final { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
@@ -25,6 +25,7 @@ public:
           onMatchRelSetExecutors{std::move(onMatchRelSetExecutors)} {}
 
     inline bool canParallel() const final { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet_, ExecutionContext* context) final;
 
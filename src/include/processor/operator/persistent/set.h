@@ -15,6 +15,7 @@ public:
           executors{std::move(executors)} {}
 
     inline bool canParallel() const final { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
@@ -38,6 +39,7 @@ public:
           executors{std::move(executors)} {}
 
     inline bool canParallel() const final { return false; }
+    inline bool hasSideEffects() const final { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
@@ -40,6 +40,7 @@ enum class PhysicalOperatorType : uint8_t {
     INTERSECT_BUILD,
     INTERSECT,
     INSTALL_EXTENSION,
+    JOIN_KEY_FILTER,
     LIMIT,
     LOAD_EXTENSION,
     MERGE,
@@ -117,6 +118,9 @@ public:
     inline virtual bool isSource() const { return false; }
     inline virtual bool isSink() const { return false; }
     inline virtual bool canParallel() const { return true; }
+    // Whether the operator changes state that other pipelines of the query may read, e.g. by
+    // updating the database or a semi mask. Pipelines are ordered around such operators.
+    inline virtual bool hasSideEffects() const { return false; }
 
     inline void addChild(std::unique_ptr<PhysicalOperator> op) {
         children.push_back(std::move(op));
@@ -142,7 +146,7 @@ public:
         return result;
     }
 
-    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+    virtual std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
         common::Profiler& profiler) const;
     std::vector<std::string> getProfilerAttributes(common::Profiler& profiler) const;
 
@@ -30,6 +30,8 @@ public:
     }
 
     inline uint64_t getNumNodes() const { return numNodes; }
+    // Empty if any node of the dst tables is a target.
+    inline const frontier::node_id_set_t& getNodeIDs() const { return nodeIDs; }
 
 private:
     uint64_t numNodes;
@@ -45,7 +47,7 @@ public:
     virtual ~BaseBFSState() = default;
 
     // Get next node offset to extend from current level.
-    common::nodeID_t getNextNodeID() {
+    virtual common::nodeID_t getNextNodeID() {
         if (nextNodeIdxToExtend == currentFrontier->nodeIDs.size()) {
             return common::nodeID_t{common::INVALID_OFFSET, common::INVALID_TABLE_ID};
         }
@@ -68,7 +70,7 @@ public:
         return currentFrontier->getMultiplicity(nodeID);
     }
 
-    inline void finalizeCurrentLevel() { moveNextLevelAsCurrentLevel(); }
+    virtual void finalizeCurrentLevel() { moveNextLevelAsCurrentLevel(); }
     inline size_t getNumFrontiers() const { return frontiers.size(); }
     inline Frontier* getFrontier(common::vector_idx_t idx) const { return frontiers[idx].get(); }
 
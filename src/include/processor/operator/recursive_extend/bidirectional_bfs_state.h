@@ -0,0 +1,72 @@
+#pragma once
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * Shortest path BFS from a src node to a single target dst node that searches from both ends. Each
+ * step extends one level of the side with the smaller frontier: the forward side follows rels out
+ * of the src node and the backward side follows rels into the dst node, which the recursive join
+ * scans with a second recursive plan in the opposite direction. The search stops as soon as one
+ * side reaches a node visited by the other. No node was visited by both sides before that, so the
+ * first meeting already gives a shortest path.
+ *
+ * The path found is regrouped into frontiers, one node per level with the previous node as its
+ * only backward edge, so that frontier scanners output it as for a forward BFS.
+ */
+class BidirectionalBFSState : public BaseBFSState {
+    struct Parent {
+        common::nodeID_t nodeID;
+        common::relID_t relID;
+    };
+
+    struct Side {
+        frontier::node_id_map_t<Parent> parents; // of all nodes visited by this side.
+        std::vector<common::nodeID_t> frontier;
+        std::vector<common::nodeID_t> nextFrontier;
+        uint8_t level = 0;
+
+        void reset(common::nodeID_t nodeID);
+    };
+
+public:
+    BidirectionalBFSState(uint8_t upperBound, TargetDstNodes* targetDstNodes,
+        common::nodeID_t dstNodeID, bool trackPath)
+        : BaseBFSState{upperBound, targetDstNodes}, dstNodeID{dstNodeID}, trackPath{trackPath},
+          isForward{true}, isFinalized{false}, pathLength{0} {}
+
+    inline bool isComplete() final { return isFinalized; }
+    void resetState() final;
+
+    // Whether the next node to extend belongs to the forward side and should be scanned with the
+    // forward recursive plan.
+    inline bool isExtendingForward() const { return isForward; }
+    // Number of rels on the shortest path found, or 0 if there is none within the upper bound.
+    inline uint8_t getPathLength() const { return pathLength; }
+    inline common::nodeID_t getDstNodeID() const { return dstNodeID; }
+
+    void markSrc(common::nodeID_t nodeID) final;
+    common::nodeID_t getNextNodeID() final;
+    void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
+        common::relID_t relID, uint64_t multiplicity) final;
+    void finalizeCurrentLevel() final;
+
+private:
+    inline Side& getExtendingSide() { return isForward ? fwdSide : bwdSide; }
+    inline Side& getOtherSide() { return isForward ? bwdSide : fwdSide; }
+    void populateFrontiers(common::nodeID_t meetNodeID);
+
+private:
+    common::nodeID_t dstNodeID;
+    bool trackPath;
+    bool isForward;
+    bool isFinalized;
+    uint8_t pathLength;
+    Side fwdSide;
+    Side bwdSide;
+};
+
+} // namespace processor
+} // namespace kuzu
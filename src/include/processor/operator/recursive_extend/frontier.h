@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <unordered_map>
 
 #include "function/hash/hash_functions.h"
@@ -24,6 +25,11 @@ using node_id_map_t = std::unordered_map<common::nodeID_t, T, function::Internal
  * Shortest path NOT track path  |  nodeIDs
  * Var length track path         |  nodeIDs & bwdEdges
  * Var length NOT track path     |  nodeIDs & nodeIDToMultiplicity
+ *
+ * A shortest path BFS over a single node table may switch to dense frontiers, which avoid hashing
+ * by relying on each node being visited once. A dense frontier appends the only bwd edge of each
+ * node to an array, and finds it through the node's position in that array, which the BFS state
+ * keeps in an array indexed by node offset. Multiplicities of a dense frontier are 1.
  */
 class Frontier {
 public:
@@ -31,20 +37,49 @@ public:
         nodeIDs.clear();
         bwdEdges.clear();
         nodeIDToMultiplicity.clear();
+        denseBwdEdges.clear();
+        densePositions = nullptr;
     }
 
     void addEdge(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID, common::nodeID_t relID);
+    // Adds a bwd edge of a node that is only an intermediate node of paths scanned from later
+    // frontiers, so it is not added to nodeIDs.
+    inline void addBwdEdge(
+        common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID, common::nodeID_t relID) {
+        bwdEdges[nbrNodeID].emplace_back(boundNodeID, relID);
+    }
 
     void addNodeWithMultiplicity(common::nodeID_t nodeID, uint64_t multiplicity);
 
+    inline void setDense(std::vector<uint32_t>* positions) { densePositions = positions; }
+    inline bool isDense() const { return densePositions != nullptr; }
+    // The nbr node must not be visited before.
+    inline void addDenseEdge(
+        common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID, common::nodeID_t relID) {
+        (*densePositions)[nbrNodeID.offset] = denseBwdEdges.size();
+        denseBwdEdges.emplace_back(boundNodeID, relID);
+        nodeIDs.push_back(nbrNodeID);
+    }
+    inline void addDenseNode(common::nodeID_t nodeID) { nodeIDs.push_back(nodeID); }
+
     inline uint64_t getMultiplicity(common::nodeID_t nodeID) const {
         return nodeIDToMultiplicity.empty() ? 1 : nodeIDToMultiplicity.at(nodeID);
     }
+    inline std::span<const frontier::node_rel_id_t> getBwdEdges(common::nodeID_t nodeID) const {
+        if (isDense()) {
+            return {&denseBwdEdges[(*densePositions)[nodeID.offset]], 1};
+        }
+        return bwdEdges.at(nodeID);
+    }
 
 public:
     std::vector<common::nodeID_t> nodeIDs;
     frontier::node_id_map_t<std::vector<frontier::node_rel_id_t>> bwdEdges;
     frontier::node_id_map_t<uint64_t> nodeIDToMultiplicity;
+
+private:
+    std::vector<frontier::node_rel_id_t> denseBwdEdges;
+    std::vector<uint32_t>* densePositions = nullptr;
 };
 
 } // namespace processor
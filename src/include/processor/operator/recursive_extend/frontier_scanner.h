@@ -55,7 +55,7 @@ protected:
  * operator.
  */
 class PathScanner : public BaseFrontierScanner {
-    using nbrs_t = std::vector<frontier::node_rel_id_t>*;
+    using nbrs_t = std::span<const frontier::node_rel_id_t>;
 
 public:
     PathScanner(TargetDstNodes* targetDstNodes, size_t k,
@@ -96,12 +96,17 @@ private:
 class DstNodeWithMultiplicityScanner : public BaseFrontierScanner {
 public:
     DstNodeWithMultiplicityScanner(TargetDstNodes* targetDstNodes, size_t k)
-        : BaseFrontierScanner{targetDstNodes, k} {}
+        : BaseFrontierScanner{targetDstNodes, k}, multiplicityToScan{0} {}
 
 private:
-    inline void initScanFromDstOffset() final {}
+    inline void initScanFromDstOffset() final {
+        multiplicityToScan = frontiers[k]->getMultiplicity(currentDstNodeID);
+    }
     void scanFromDstOffset(RecursiveJoinVectors* vectors, common::sel_t& vectorPos,
         common::sel_t& nodeIDDataVectorPos, common::sel_t& relIDDataVectorPos) final;
+
+private:
+    uint64_t multiplicityToScan;
 };
 
 /*
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * Computes shortest path lengths from a batch of up to 64 source nodes at once (MS-BFS). Each
+ * visited node carries a bitset of the sources that have reached it and a bitset of the sources
+ * whose frontier it is in, so the neighbours of a node are scanned once per level for all sources
+ * instead of once per source. Sources whose BFS overlap share most of their scans.
+ *
+ * The interface mirrors BaseBFSState so that RecursiveJoin drives both the same way: extend the
+ * node returned by getNextNodeID(), mark its neighbours through markVisited() and call
+ * finalizeCurrentLevel() once getNextNodeID() returns an invalid node ID.
+ */
+class MultiSourceBFSState {
+public:
+    static constexpr uint64_t MAX_NUM_SOURCES = 64;
+
+    // A node first reached by a source at the given level.
+    struct VisitedNode {
+        common::nodeID_t nodeID;
+        uint8_t level;
+    };
+
+    MultiSourceBFSState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
+        : upperBound{upperBound}, currentLevel{0}, nextNodeIdxToExtend{0},
+          currentSourceMask{0}, completedSourceMask{0}, targetDstNodes{targetDstNodes} {}
+
+    void resetState();
+
+    void markSrc(common::nodeID_t nodeID);
+    inline uint64_t getNumSources() const { return visitedNodesPerSource.size(); }
+
+    inline bool isComplete() const {
+        return currentFrontier.empty() || currentLevel == upperBound ||
+               completedSourceMask == getAllSourcesMask();
+    }
+    // Get next node to extend from current level, skipping nodes whose sources have all
+    // completed.
+    common::nodeID_t getNextNodeID();
+    // Marks nbrNodeID as reached by every source that reached the last node returned by
+    // getNextNodeID().
+    void markVisited(common::nodeID_t nbrNodeID);
+    void finalizeCurrentLevel();
+
+    inline const std::vector<VisitedNode>& getVisitedNodes(uint64_t sourceIdx) const {
+        return visitedNodesPerSource[sourceIdx];
+    }
+
+private:
+    inline uint64_t getAllSourcesMask() const {
+        return getNumSources() == MAX_NUM_SOURCES ? UINT64_MAX :
+                                                    ((uint64_t)1 << getNumSources()) - 1;
+    }
+    uint32_t getOrInsertNodeIdx(common::nodeID_t nodeID);
+    void markNodeVisitedBySources(uint32_t nodeIdx, uint64_t sourceMask, uint8_t level);
+
+private:
+    // Static information
+    uint8_t upperBound;
+    // Level state
+    uint8_t currentLevel;
+    uint64_t nextNodeIdxToExtend;
+    uint64_t currentSourceMask; // sources to extend from the last returned node.
+    uint64_t completedSourceMask;
+    std::vector<uint32_t> currentFrontier;
+    std::vector<uint32_t> nextFrontier;
+    // Per node state. Node indices are assigned on first visit.
+    frontier::node_id_map_t<uint32_t> nodeIDToIdx;
+    std::vector<common::nodeID_t> nodeIDs;
+    std::vector<uint64_t> seen;
+    std::vector<uint64_t> currentVisit;
+    std::vector<uint64_t> nextVisit;
+    // Per source state.
+    std::vector<std::vector<VisitedNode>> visitedNodesPerSource;
+    std::vector<uint64_t> numVisitedDstNodesPerSource;
+    // Target information.
+    TargetDstNodes* targetDstNodes;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "common/types/internal_id_t.h"
+
+namespace kuzu {
+namespace processor {
+
+// A range of nodes of the current frontier to extend top-down, or a range of node offsets whose
+// unvisited nodes are checked for a parent in the current frontier bottom-up.
+struct ParallelBFSMorsel {
+    uint64_t startIdx = 0;
+    uint64_t endIdx = 0;
+    uint8_t level = 0;
+    bool isBottomUp = false;
+};
+
+/*
+ * Shared state of a level synchronous shortest path BFS from a single src node that all threads
+ * of a recursive join extend together. The thread that reads the src node (owner) starts the BFS
+ * and the other threads, once their own input is exhausted, help extending it. Each level is split
+ * into morsels of frontier nodes; the next level starts once all morsels of a level are extended.
+ *
+ * Only single node table recursive patterns are supported so that the visited state can be kept
+ * in an atomic bitmap indexed by node offset. Only one BFS uses the state at a time; a src node
+ * that finds the state in use is computed by its thread alone.
+ *
+ * If a recursive plan in the opposite direction is available, a level whose frontier is larger
+ * than the set of unvisited nodes is extended bottom-up: each unvisited node scans its backward
+ * edges for a parent in the frontier, which is kept in a bitmap for the level. Since a scan of
+ * the recursive plan can't be stopped early, the backward edges of an unvisited node are scanned
+ * completely, so the choice compares frontier nodes with unvisited nodes rather than edges.
+ */
+class ParallelBFSSharedState {
+public:
+    static constexpr uint64_t MORSEL_SIZE = 256;
+    static constexpr uint64_t BOTTOM_UP_MORSEL_SIZE = 2048;
+
+    ParallelBFSSharedState(common::table_id_t tableID, uint8_t upperBound, bool canExtendBottomUp)
+        : tableID{tableID}, upperBound{upperBound}, canExtendBottomUp{canExtendBottomUp},
+          numThreadsFetchingSrcNodes{0}, isInUse{false}, isExtending{false}, isBottomUp{false},
+          currentLevel{0}, nextMorselIdx{0}, numActiveMorsels{0}, numBitmapWords{0}, numNodes{0},
+          numTargetNodes{0}, numVisitedDstNodes{0}, numBFSs{0}, numBottomUpLevels{0} {}
+
+    inline common::table_id_t getTableID() const { return tableID; }
+
+    // Number of BFSs and of levels extended bottom-up, reported by the profiler.
+    inline uint64_t getNumBFSs() const { return numBFSs.load(); }
+    inline uint64_t getNumBottomUpLevels() const { return numBottomUpLevels.load(); }
+
+    // Helper threads keep waiting for work while another thread is reading src nodes, since it may
+    // start a BFS. A thread that reads a single src node ends fetching only after trying to start
+    // a BFS from it. Threads are never waited for outside of reading, so a parent operator that
+    // stops pulling (e.g. LIMIT) can't block helpers.
+    void beginFetchingSrcNodes();
+    void endFetchingSrcNodes();
+
+    // Owner interface. Returns false if another BFS is using the state.
+    bool tryStart(common::offset_t srcOffset, common::offset_t maxNodeOffset, bool isSrcTarget,
+        uint64_t numTargetNodes);
+    // Blocks until a morsel is available. Returns false once the BFS is complete.
+    bool getOwnerMorsel(ParallelBFSMorsel& morsel);
+    inline const std::vector<common::offset_t>& getVisitedNodeOffsets() const {
+        return visitedNodeOffsets;
+    }
+    inline uint8_t getLevel(common::offset_t offset) const { return levels[offset]; }
+    void release();
+
+    // Helper interface. Blocks until a morsel is available. Returns false if there is no BFS to
+    // help with and no thread is reading src nodes.
+    bool getHelperMorsel(ParallelBFSMorsel& morsel);
+
+    // Morsel extension.
+    inline common::offset_t getFrontierNodeOffset(uint64_t idx) const {
+        return currentFrontier[idx];
+    }
+    inline bool isVisited(common::offset_t offset) const {
+        return visitedBitmap[offset >> 6].load(std::memory_order_relaxed) &
+               ((uint64_t)1 << (offset & 63));
+    }
+    inline bool isInFrontier(common::offset_t offset) const {
+        return frontierBitmap[offset >> 6] & ((uint64_t)1 << (offset & 63));
+    }
+    // Returns true if the node is visited for the first time.
+    inline bool markVisited(common::offset_t offset, uint8_t level) {
+        auto bit = (uint64_t)1 << (offset & 63);
+        if (visitedBitmap[offset >> 6].fetch_or(bit, std::memory_order_relaxed) & bit) {
+            return false;
+        }
+        levels[offset] = level;
+        return true;
+    }
+    void finishMorsel(const std::vector<common::offset_t>& nextFrontierNodes,
+        uint64_t numVisitedDstNodesInMorsel);
+    // Stops the BFS after an exception so that no thread waits for it.
+    void abort();
+
+private:
+    // Morsels of a top-down level split the frontier, those of a bottom-up level all nodes.
+    inline uint64_t getNumMorselUnits() const {
+        return isBottomUp ? numNodes : currentFrontier.size();
+    }
+    inline bool hasMorsel() const { return isExtending && nextMorselIdx < getNumMorselUnits(); }
+    void takeMorsel(ParallelBFSMorsel& morsel);
+    void finalizeCurrentLevel();
+    void updateIsExtending();
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    // Static information
+    common::table_id_t tableID;
+    uint8_t upperBound;
+    bool canExtendBottomUp;
+    uint64_t numThreadsFetchingSrcNodes;
+    bool isInUse;
+    // Level state
+    bool isExtending;
+    bool isBottomUp;
+    uint8_t currentLevel;
+    std::vector<common::offset_t> currentFrontier;
+    std::vector<common::offset_t> nextFrontier;
+    uint64_t nextMorselIdx;
+    uint64_t numActiveMorsels;
+    // Visited state, indexed by node offset.
+    std::unique_ptr<std::atomic<uint64_t>[]> visitedBitmap;
+    uint64_t numBitmapWords;
+    uint64_t numNodes;
+    std::vector<uint64_t> frontierBitmap; // Only filled for bottom-up levels.
+    std::vector<uint8_t> levels;
+    std::vector<common::offset_t> visitedNodeOffsets; // in level order.
+    // Target information.
+    uint64_t numTargetNodes;
+    uint64_t numVisitedDstNodes;
+    // Profiling information.
+    std::atomic<uint64_t> numBFSs;
+    std::atomic<uint64_t> numBottomUpLevels;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <vector>
+
+#include "common/assert.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * Monotone priority queue over uint64 keys: a pushed key must not be smaller than the last popped
+ * key, which holds for Dijkstra with non-negative weights. Bucket i > 0 holds the keys whose
+ * highest bit that differs from the last popped key is bit i - 1, and bucket 0 holds the keys
+ * equal to it. Popping from an empty bucket 0 redistributes the first non-empty bucket, so an
+ * entry moves at most 64 times instead of paying log(n) comparisons per operation.
+ */
+template<typename T>
+class RadixHeap {
+public:
+    RadixHeap() : lastKey{0}, numEntries{0} {}
+
+    inline bool empty() const { return numEntries == 0; }
+
+    inline void push(uint64_t key, T value) {
+        KU_ASSERT(key >= lastKey);
+        buckets[getBucketIdx(key)].emplace_back(key, std::move(value));
+        numEntries++;
+    }
+
+    std::pair<uint64_t, T> pop() {
+        KU_ASSERT(!empty());
+        if (buckets[0].empty()) {
+            auto bucketIdx = 1u;
+            while (buckets[bucketIdx].empty()) {
+                bucketIdx++;
+            }
+            auto& bucket = buckets[bucketIdx];
+            lastKey = bucket[0].first;
+            for (auto& entry : bucket) {
+                lastKey = std::min(lastKey, entry.first);
+            }
+            for (auto& entry : bucket) {
+                buckets[getBucketIdx(entry.first)].push_back(std::move(entry));
+            }
+            bucket.clear();
+        }
+        auto entry = std::move(buckets[0].back());
+        buckets[0].pop_back();
+        numEntries--;
+        return entry;
+    }
+
+    void clear() {
+        for (auto& bucket : buckets) {
+            bucket.clear();
+        }
+        lastKey = 0;
+        numEntries = 0;
+    }
+
+private:
+    inline uint32_t getBucketIdx(uint64_t key) const {
+        return key == lastKey ? 0 : 64 - std::countl_zero(key ^ lastKey);
+    }
+
+private:
+    std::array<std::vector<std::pair<uint64_t, T>>, 65> buckets;
+    uint64_t lastKey;
+    uint64_t numEntries;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -1,11 +1,17 @@
 #pragma once
 
+#include <atomic>
+
 #include "bfs_state.h"
 #include "common/enums/query_rel_type.h"
 #include "frontier_scanner.h"
+#include "multi_source_bfs.h"
+#include "parallel_bfs.h"
 #include "planner/operator/extend/recursive_join_type.h"
+#include "processor/operator/filtering_operator.h"
 #include "processor/operator/mask.h"
 #include "processor/operator/physical_operator.h"
+#include "shortest_path_state.h"
 
 namespace kuzu {
 namespace processor {
@@ -14,9 +20,14 @@ class ScanFrontier;
 
 struct RecursiveJoinSharedState {
     std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks;
-
-    explicit RecursiveJoinSharedState(std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks)
-        : semiMasks{std::move(semiMasks)} {}
+    // Set if a BFS from a single src node can be extended by all threads.
+    std::unique_ptr<ParallelBFSSharedState> parallelBFSState;
+    // Number of BFS batches computed from more than one src node, reported by the profiler.
+    std::atomic<uint64_t> numMultiSourceBatches{0};
+
+    RecursiveJoinSharedState(std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks,
+        std::unique_ptr<ParallelBFSSharedState> parallelBFSState)
+        : semiMasks{std::move(semiMasks)}, parallelBFSState{std::move(parallelBFSState)} {}
 };
 
 struct RecursiveJoinDataInfo {
@@ -31,6 +42,11 @@ struct RecursiveJoinDataInfo {
     DataPos recursiveDstNodeIDPos;
     std::unordered_set<common::table_id_t> recursiveDstNodeTableIDs;
     DataPos recursiveEdgeIDPos;
+    DataPos recursiveEdgeWeightPos; // Only valid for weighted shortest path.
+    // Recursive plan in the opposite direction, if any.
+    std::unique_ptr<ResultSetDescriptor> bwdLocalResultSetDescriptor;
+    DataPos bwdRecursiveDstNodeIDPos;
+    DataPos bwdRecursiveEdgeIDPos;
     // Path info
     DataPos pathPos;
     std::unordered_map<common::table_id_t, std::string> tableIDToName;
@@ -40,20 +56,27 @@ struct RecursiveJoinDataInfo {
         std::unique_ptr<ResultSetDescriptor> localResultSetDescriptor,
         const DataPos& recursiveDstNodeIDPos,
         std::unordered_set<common::table_id_t> recursiveDstNodeTableIDs,
-        const DataPos& recursiveEdgeIDPos, const DataPos& pathPos,
-        std::unordered_map<common::table_id_t, std::string> tableIDToName)
+        const DataPos& recursiveEdgeIDPos, const DataPos& recursiveEdgeWeightPos,
+        const DataPos& pathPos, std::unordered_map<common::table_id_t, std::string> tableIDToName)
         : srcNodePos{srcNodePos}, dstNodePos{dstNodePos},
           dstNodeTableIDs{std::move(dstNodeTableIDs)}, pathLengthPos{pathLengthPos},
           localResultSetDescriptor{std::move(localResultSetDescriptor)},
           recursiveDstNodeIDPos{recursiveDstNodeIDPos}, recursiveDstNodeTableIDs{std::move(
                                                             recursiveDstNodeTableIDs)},
-          recursiveEdgeIDPos{recursiveEdgeIDPos}, pathPos{pathPos}, tableIDToName{
-                                                                        std::move(tableIDToName)} {}
+          recursiveEdgeIDPos{recursiveEdgeIDPos}, recursiveEdgeWeightPos{recursiveEdgeWeightPos},
+          pathPos{pathPos}, tableIDToName{std::move(tableIDToName)} {}
 
     inline std::unique_ptr<RecursiveJoinDataInfo> copy() {
-        return std::make_unique<RecursiveJoinDataInfo>(srcNodePos, dstNodePos, dstNodeTableIDs,
-            pathLengthPos, localResultSetDescriptor->copy(), recursiveDstNodeIDPos,
-            recursiveDstNodeTableIDs, recursiveEdgeIDPos, pathPos, tableIDToName);
+        auto result = std::make_unique<RecursiveJoinDataInfo>(srcNodePos, dstNodePos,
+            dstNodeTableIDs, pathLengthPos, localResultSetDescriptor->copy(), recursiveDstNodeIDPos,
+            recursiveDstNodeTableIDs, recursiveEdgeIDPos, recursiveEdgeWeightPos, pathPos,
+            tableIDToName);
+        if (bwdLocalResultSetDescriptor != nullptr) {
+            result->bwdLocalResultSetDescriptor = bwdLocalResultSetDescriptor->copy();
+            result->bwdRecursiveDstNodeIDPos = bwdRecursiveDstNodeIDPos;
+            result->bwdRecursiveEdgeIDPos = bwdRecursiveEdgeIDPos;
+        }
+        return result;
     }
 };
 
@@ -72,21 +95,49 @@ struct RecursiveJoinVectors {
     common::ValueVector* pathRelsLabelDataVector = nullptr;  // STRING
 
     common::ValueVector* recursiveEdgeIDVector = nullptr;
+    common::ValueVector* recursiveEdgeWeightVector = nullptr;
     common::ValueVector* recursiveDstNodeIDVector = nullptr;
+    common::ValueVector* bwdRecursiveEdgeIDVector = nullptr;
+    common::ValueVector* bwdRecursiveDstNodeIDVector = nullptr;
 };
 
-class RecursiveJoin : public PhysicalOperator {
+// Local state of a recursive join that computes shortest paths from a batch of src nodes at once.
+// The src node chunk is read unflat from the child and flattened by the recursive join itself, so
+// that all src nodes of a chunk are available to the BFS.
+struct MultiSourceBFSLocalState {
+    std::unique_ptr<MultiSourceBFSState> bfsState;
+    common::DataChunkState* srcNodeChunkState = nullptr;
+    uint64_t numSrcNodes = 0;
+    uint64_t nextSrcNodeIdx = 0;    // next src node of the chunk to add to a batch.
+    uint64_t batchStartIdx = 0;     // first src node of the chunk in the current batch.
+    uint64_t numSourcesInBatch = 0; // number of src nodes in the current batch.
+    uint64_t outputSourceIdx = 0;   // source of the current batch whose results are output.
+    uint64_t outputCursor = 0;      // next visited node of the output source to scan.
+    // A batch of a single src node may be computed by all threads through the shared parallel
+    // BFS state, or searched from both ends if there is a single dst node. Its visited nodes are
+    // copied here, so that e.g. the shared state can be released before they are output.
+    bool isSingleSourceBatch = false;
+    std::vector<MultiSourceBFSState::VisitedNode> singleSourceVisitedNodes;
+    std::vector<common::offset_t> parallelBFSNextFrontier;
+    bool isFetchingSrcNodes = false;
+};
+
+class RecursiveJoin : public PhysicalOperator, SelVectorOverWriter {
 public:
     RecursiveJoin(uint8_t lowerBound, uint8_t upperBound, common::QueryRelType queryRelType,
-        planner::RecursiveJoinType joinType, std::shared_ptr<RecursiveJoinSharedState> sharedState,
+        planner::RecursiveJoinType joinType, bool isMultiSource,
+        std::shared_ptr<RecursiveJoinSharedState> sharedState,
         std::unique_ptr<RecursiveJoinDataInfo> dataInfo, std::unique_ptr<PhysicalOperator> child,
         uint32_t id, const std::string& paramsString,
-        std::unique_ptr<PhysicalOperator> recursiveRoot)
+        std::unique_ptr<PhysicalOperator> recursiveRoot,
+        std::unique_ptr<PhysicalOperator> bwdRecursiveRoot)
         : PhysicalOperator{PhysicalOperatorType::RECURSIVE_JOIN, std::move(child), id,
               paramsString},
           lowerBound{lowerBound}, upperBound{upperBound}, queryRelType{queryRelType},
-          joinType{joinType}, sharedState{std::move(sharedState)}, dataInfo{std::move(dataInfo)},
-          recursiveRoot{std::move(recursiveRoot)} {}
+          joinType{joinType}, isMultiSource{isMultiSource}, isBidirectional{false},
+          sharedState{std::move(sharedState)}, dataInfo{std::move(dataInfo)},
+          recursiveRoot{std::move(recursiveRoot)}, bwdRecursiveRoot{std::move(bwdRecursiveRoot)} {
+    }
 
     inline RecursiveJoinSharedState* getSharedState() const { return sharedState.get(); }
 
@@ -94,10 +145,15 @@ public:
 
     bool getNextTuplesInternal(ExecutionContext* context) final;
 
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const final;
+
     inline std::unique_ptr<PhysicalOperator> clone() final {
+        auto bwdRecursiveRootClone =
+            bwdRecursiveRoot == nullptr ? nullptr : bwdRecursiveRoot->clone();
         return std::make_unique<RecursiveJoin>(lowerBound, upperBound, queryRelType, joinType,
-            sharedState, dataInfo->copy(), children[0]->clone(), id, paramsString,
-            recursiveRoot->clone());
+            isMultiSource, sharedState, dataInfo->copy(), children[0]->clone(), id, paramsString,
+            recursiveRoot->clone(), std::move(bwdRecursiveRootClone));
     }
 
 private:
@@ -107,16 +163,55 @@ private:
 
     bool scanOutput();
 
+    // Let a single src shortest path BFS switch to dense frontiers if its nbr nodes are from a
+    // single node table.
+    template<bool TRACK_PATH>
+    void enableDenseFrontiers(ShortestPathState<TRACK_PATH>* shortestPathState);
+
     // Compute BFS for a given src node.
     void computeBFS(ExecutionContext* context);
 
+    // Compute shortest path from a given src node to the single target dst node from both ends.
+    void computeBidirectionalBFS(ExecutionContext* context, common::nodeID_t srcNodeID);
+
     void updateVisitedNodes(common::nodeID_t boundNodeID);
+    void updateVisitedNodesWithWeight(common::nodeID_t boundNodeID);
+
+    bool getNextTuplesMultiSource(ExecutionContext* context);
+
+    // Read the next chunk of src nodes from child and flatten it.
+    bool fetchSrcNodes(ExecutionContext* context);
+
+    // Compute BFS for the next batch of src nodes of the current chunk.
+    void computeMultiSourceBFS(ExecutionContext* context);
+
+    bool scanMultiSourceOutput();
+
+    // Compute BFS for a single src node together with the other threads. Returns false if the
+    // shared parallel BFS state is in use.
+    bool computeParallelBFS(ExecutionContext* context, common::nodeID_t srcNodeID);
+
+    // Help extending the parallel BFS of other threads until no more src node can be read.
+    void helpParallelBFS(ExecutionContext* context);
+
+    void extendParallelBFSMorsel(ExecutionContext* context, const ParallelBFSMorsel& morsel);
+
+    // Visit the unvisited nodes of the morsel that have a parent in the frontier, using the
+    // recursive plan in the opposite direction.
+    void extendParallelBFSMorselBottomUp(
+        ExecutionContext* context, const ParallelBFSMorsel& morsel);
+
+    void endFetchingSrcNodes();
+
+    void resetToCurrentSelVector(std::shared_ptr<common::SelectionVector>& selVector) final;
 
 private:
     uint8_t lowerBound;
     uint8_t upperBound;
     common::QueryRelType queryRelType;
     planner::RecursiveJoinType joinType;
+    bool isMultiSource;
+    bool isBidirectional;
 
     std::shared_ptr<RecursiveJoinSharedState> sharedState;
     std::unique_ptr<RecursiveJoinDataInfo> dataInfo;
@@ -125,11 +220,16 @@ private:
     std::unique_ptr<ResultSet> localResultSet;
     std::unique_ptr<PhysicalOperator> recursiveRoot;
     ScanFrontier* scanFrontier;
+    // Local recursive plan in the opposite direction
+    std::unique_ptr<ResultSet> bwdLocalResultSet;
+    std::unique_ptr<PhysicalOperator> bwdRecursiveRoot;
+    ScanFrontier* bwdScanFrontier = nullptr;
 
     std::unique_ptr<RecursiveJoinVectors> vectors;
     std::unique_ptr<BaseBFSState> bfsState;
     std::unique_ptr<FrontiersScanner> frontiersScanner;
     std::unique_ptr<TargetDstNodes> targetDstNodes;
+    std::unique_ptr<MultiSourceBFSLocalState> multiSourceState;
 };
 
 } // namespace processor
@@ -8,14 +8,34 @@ namespace processor {
 template<bool TRACK_PATH>
 class ShortestPathState : public BaseBFSState {
 public:
+    // A BFS over a single node table switches to dense frontiers once more than 1 / RATIO of the
+    // nodes of the table are visited, when a bitmap is cheaper than hashing visited nodes.
+    static constexpr uint64_t DENSE_FRONTIER_VISITED_NODES_RATIO = 32;
+
     ShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
-        : BaseBFSState{upperBound, targetDstNodes}, numVisitedDstNodes{0} {}
+        : BaseBFSState{upperBound, targetDstNodes}, numVisitedDstNodes{0},
+          denseTableID{common::INVALID_TABLE_ID}, numDenseNodes{0}, isDense{false} {}
     ~ShortestPathState() override = default;
 
+    // All nbr nodes must be from the given node table. The src node may be from another table.
+    inline void enableDenseFrontiers(common::table_id_t tableID, uint64_t numNodes) {
+        denseTableID = tableID;
+        numDenseNodes = numNodes;
+    }
+
     inline bool isComplete() final {
         return isCurrentFrontierEmpty() || isUpperBoundReached() || isAllDstReached();
     }
     inline void resetState() final {
+        if (isDense) {
+            // Every set bit belongs to a node of some frontier, so whole words can be cleared.
+            for (auto& frontier : frontiers) {
+                for (auto& nodeID : frontier->nodeIDs) {
+                    visitedBitmap[nodeID.offset >> 6] = 0;
+                }
+            }
+            isDense = false;
+        }
         BaseBFSState::resetState();
         numVisitedDstNodes = 0;
         visited.clear();
@@ -31,6 +51,23 @@ public:
 
     inline void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::nodeID_t relID, uint64_t /*multiplicity*/) final {
+        if (isDense) {
+            auto& word = visitedBitmap[nbrNodeID.offset >> 6];
+            auto bit = (uint64_t)1 << (nbrNodeID.offset & 63);
+            if (word & bit) {
+                return;
+            }
+            word |= bit;
+            if (targetDstNodes->contains(nbrNodeID)) {
+                numVisitedDstNodes++;
+            }
+            if constexpr (TRACK_PATH) {
+                nextFrontier->addDenseEdge(boundNodeID, nbrNodeID, relID);
+            } else {
+                nextFrontier->addDenseNode(nbrNodeID);
+            }
+            return;
+        }
         if (visited.contains(nbrNodeID)) {
             return;
         }
@@ -45,14 +82,50 @@ public:
         }
     }
 
+    inline void finalizeCurrentLevel() final {
+        if (!isDense && numDenseNodes != 0 &&
+            visited.size() * DENSE_FRONTIER_VISITED_NODES_RATIO > numDenseNodes) {
+            switchToDenseFrontiers();
+        }
+        moveNextLevelAsCurrentLevel();
+        if constexpr (TRACK_PATH) {
+            if (isDense && nextFrontier != currentFrontier) {
+                nextFrontier->setDense(&densePositions);
+            }
+        }
+    }
+
 private:
     inline bool isAllDstReached() const {
         return numVisitedDstNodes == targetDstNodes->getNumNodes();
     }
 
+    // Frontiers added from now on are dense. The bitmap and positions are sized to the node table
+    // once and reused by later BFSs.
+    void switchToDenseFrontiers() {
+        visitedBitmap.resize((numDenseNodes + 63) >> 6, 0);
+        if constexpr (TRACK_PATH) {
+            densePositions.resize(numDenseNodes);
+        }
+        for (auto& nodeID : visited) {
+            if (nodeID.tableID != denseTableID) {
+                continue; // Src node of another table is never reached again.
+            }
+            visitedBitmap[nodeID.offset >> 6] |= (uint64_t)1 << (nodeID.offset & 63);
+        }
+        visited.clear();
+        isDense = true;
+    }
+
 private:
     uint64_t numVisitedDstNodes;
     frontier::node_id_set_t visited;
+    // Dense frontier state, indexed by node offset.
+    common::table_id_t denseTableID;
+    uint64_t numDenseNodes; // 0 if dense frontiers are not enabled.
+    bool isDense;
+    std::vector<uint64_t> visitedBitmap;
+    std::vector<uint32_t> densePositions;
 };
 
 } // namespace processor
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "bfs_state.h"
+#include "radix_heap.h"
+
+namespace kuzu {
+namespace processor {
+
+/*
+ * Dijkstra from a single src node over rels weighted by a non-negative numeric rel property,
+ * bounded by the number of rels of a path.
+ *
+ * The cheapest path to a node within the upper bound may go through a node that is reached more
+ * cheaply by a longer path, so a node can be settled more than once: search states are keyed by
+ * a node and the number of rels of the path to it. A state is only kept if no state of the same
+ * node with at most as many rels is as cheap, and a state with as many rels as the upper bound is
+ * not extended. The first settled state of a node is its cheapest path within the upper bound.
+ *
+ * The state is driven like the BFS states: level 0 extends the src node and level 1 extends
+ * states in the order of their cost, as popped from a radix heap keyed by the bits of the cost.
+ * Once no state is left to extend (or all target dst nodes have their final cost),
+ * finalizeCurrentLevel() regroups the cheapest states into frontiers by their number of rels,
+ * with the last rel as the only backward edge. States of intermediate nodes only add backward
+ * edges to their frontiers. Frontier scanners then output dst nodes and paths exactly as for
+ * unweighted shortest paths.
+ */
+class WeightedShortestPathState : public BaseBFSState {
+    struct NodeState {
+        common::nodeID_t nodeID;
+        // Pareto front of the states of the node: no state is dominated by another one with at
+        // most as many rels that is as cheap. Sorted by numRels, and thus by decreasing cost.
+        std::vector<uint32_t> stateIdxs;
+        // Fewest rels of a settled state. Later states need fewer rels to be extended.
+        uint64_t minSettledNumRels;
+    };
+
+    struct PathState {
+        uint32_t nodeIdx;
+        double cost;
+        uint64_t numRels;
+        uint32_t parentStateIdx;
+        common::relID_t parentRelID;
+        bool isSettled;
+        bool isCheapest;   // First settled state of its node.
+        bool isInFrontier; // Added to the frontiers by populateFrontiers().
+    };
+
+public:
+    WeightedShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes, bool trackPath)
+        : BaseBFSState{upperBound, targetDstNodes}, trackPath{trackPath}, isFinalized{false},
+          numSettledDstNodes{0}, currentStateIdx{0} {}
+
+    inline bool isComplete() final { return isFinalized; }
+    void resetState() final;
+
+    void markSrc(common::nodeID_t nodeID) final;
+    common::nodeID_t getNextNodeID() final;
+    // Use markVisitedWithWeight instead.
+    inline void markVisited(common::nodeID_t /*boundNodeID*/, common::nodeID_t /*nbrNodeID*/,
+        common::relID_t /*relID*/, uint64_t /*multiplicity*/) final {
+        KU_UNREACHABLE;
+    }
+    void markVisitedWithWeight(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
+        common::relID_t relID, double weight);
+    void finalizeCurrentLevel() final;
+
+private:
+    uint32_t getOrInsertNodeIdx(common::nodeID_t nodeID);
+    // The state must not be dominated. States of the node it dominates leave the Pareto front.
+    uint32_t insertState(uint32_t nodeIdx, double cost, uint64_t numRels, uint32_t parentStateIdx,
+        common::relID_t parentRelID);
+    bool isDominated(const NodeState& nodeState, double cost, uint64_t numRels) const;
+    inline bool isAllDstSettled() const {
+        return numSettledDstNodes == targetDstNodes->getNumNodes();
+    }
+    void populateFrontiers();
+
+private:
+    bool trackPath;
+    bool isFinalized;
+    uint64_t numSettledDstNodes;
+    frontier::node_id_map_t<uint32_t> nodeIDToIdx;
+    std::vector<NodeState> nodeStates;
+    std::vector<PathState> pathStates;
+    std::vector<uint32_t> cheapestStateIdxs; // in the order of their cost.
+    uint32_t currentStateIdx;                // state being extended.
+    RadixHeap<uint32_t> heap;
+};
+
+} // namespace processor
+} // namespace kuzu
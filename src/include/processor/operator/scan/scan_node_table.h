@@ -11,11 +11,15 @@ namespace processor {
 struct ScanNodeTableInfo {
     storage::NodeTable* table;
     std::vector<common::column_id_t> columnIDs;
+    // Checks against the node group zone maps. Input vectors from node groups which fail any check
+    // are skipped without being scanned.
+    std::vector<storage::ZoneMapCheck> zoneMapChecks;
 
-    ScanNodeTableInfo(storage::NodeTable* table, std::vector<common::column_id_t> columnIDs)
-        : table{table}, columnIDs{std::move(columnIDs)} {}
+    ScanNodeTableInfo(storage::NodeTable* table, std::vector<common::column_id_t> columnIDs,
+        std::vector<storage::ZoneMapCheck> zoneMapChecks = {})
+        : table{table}, columnIDs{std::move(columnIDs)}, zoneMapChecks{std::move(zoneMapChecks)} {}
     ScanNodeTableInfo(const ScanNodeTableInfo& other)
-        : table{other.table}, columnIDs{other.columnIDs} {}
+        : table{other.table}, columnIDs{other.columnIDs}, zoneMapChecks{other.zoneMapChecks} {}
 
     inline std::unique_ptr<ScanNodeTableInfo> copy() const {
         return std::make_unique<ScanNodeTableInfo>(*this);
@@ -51,6 +55,9 @@ protected:
               paramsString},
           info{std::move(info)} {}
 
+private:
+    bool canSkipInput();
+
 private:
     std::unique_ptr<ScanNodeTableInfo> info;
     std::unique_ptr<storage::TableReadState> readState;
@@ -50,6 +50,9 @@ protected:
         : PhysicalOperator{PhysicalOperatorType::SEMI_MASKER, std::move(child), id, paramsString},
           info{std::move(info)} {}
 
+    // The mask filters the scans on the probe side of the join.
+    inline bool hasSideEffects() const final { return true; }
+
     void initGlobalStateInternal(ExecutionContext* context) override;
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
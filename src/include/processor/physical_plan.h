@@ -10,10 +10,16 @@ namespace processor {
 class PhysicalPlan {
 public:
     explicit PhysicalPlan(std::unique_ptr<PhysicalOperator> lastOperator)
-        : lastOperator{std::move(lastOperator)} {}
+        : lastOperator{std::move(lastOperator)}, estimatedMemoryUsage{0}, isShortQuery{false} {}
 
 public:
     std::unique_ptr<PhysicalOperator> lastOperator;
+    // Bytes estimated to be held by the hash tables, aggregates and sorts of the plan. Used to
+    // admit memory-heavy queries.
+    uint64_t estimatedMemoryUsage;
+    // Whether the planner estimates, from table statistics, that the query scans, joins and outputs
+    // few tuples. Short queries of NORMAL priority are scheduled as HIGH priority.
+    bool isShortQuery;
 };
 
 } // namespace processor
@@ -18,6 +18,7 @@ class LogicalCopyFrom;
 namespace processor {
 
 class HashJoinBuildInfo;
+class HashJoinSharedState;
 struct AggregateInputInfo;
 class NodeInsertExecutor;
 class RelInsertExecutor;
@@ -121,6 +122,11 @@ private:
         std::unique_ptr<PhysicalOperator> prevOperator);
     std::unique_ptr<HashJoinBuildInfo> createHashBuildInfo(const planner::Schema& buildSideSchema,
         const binder::expression_vector& keys, const binder::expression_vector& payloads);
+    // Places a JoinKeyFilter on the probe side of a hash join, right above the lowest operator
+    // that the probe key is in scope of. Returns false if the filter can't be placed.
+    bool appendJoinKeyFilter(planner::LogicalOperator* probeSideRoot,
+        const binder::Expression& probeKey, std::shared_ptr<HashJoinSharedState> sharedState,
+        std::unique_ptr<PhysicalOperator>& probeSidePrevOperator);
     std::unique_ptr<PhysicalOperator> createHashAggregate(
         const binder::expression_vector& keyExpressions,
         const binder::expression_vector& dependentKeyExpressions,
@@ -1,13 +1,16 @@
 #pragma once
 
 #include "common/task_system/task_scheduler.h"
+#include "main/kuzu_fwd.h"
 #include "processor/physical_plan.h"
+#include "processor/query_admission_controller.h"
 #include "processor/result/factorized_table.h"
 
 namespace kuzu {
 namespace processor {
 
 class QueryProcessor {
+    friend class kuzu::testing::PipelineSchedulingTest;
 
 public:
     explicit QueryProcessor(uint64_t numThreads);
@@ -16,11 +19,16 @@ public:
 
 private:
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
+    // Pipelines under different children of the operator are scheduled concurrently, unless one
+    // of them needs to see the side effects of another.
+    void decomposeChildrenIntoTask(
+        PhysicalOperator* op, common::Task* task, ExecutionContext* context);
 
     void initTask(common::Task* task);
 
 private:
     std::unique_ptr<common::TaskScheduler> taskScheduler;
+    QueryAdmissionController admissionController;
 };
 
 } // namespace processor
@@ -17,6 +17,8 @@ public:
     void run() override;
     void finalizeIfNecessary() override;
 
+    inline Sink* getSink() const { return sink; }
+
 private:
     static std::unique_ptr<ResultSet> populateResultSet(
         Sink* op, storage::MemoryManager* memoryManager);
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include "processor/execution_context.h"
+
+namespace kuzu {
+namespace processor {
+
+class QueryAdmissionController;
+
+// Releases the memory reserved for a query once the query finishes.
+class AdmittedQuery {
+public:
+    AdmittedQuery(QueryAdmissionController* controller, uint64_t reservedMemory)
+        : controller{controller}, reservedMemory{reservedMemory} {}
+    ~AdmittedQuery();
+
+private:
+    QueryAdmissionController* controller;
+    uint64_t reservedMemory;
+};
+
+/**
+ * QueryAdmissionController caps the memory-heavy queries that run at the same time, so that the
+ * memory they are estimated to need fits in the budget of the buffer manager, instead of all of
+ * them spilling or running out of memory together. A memory-heavy query reserves its estimated
+ * memory usage, capped at the budget, and waits until its reservation fits next to the ones of the
+ * running queries. A query is always admitted if no memory-heavy query is running, and waiting
+ * queries are admitted by priority. Other queries are admitted right away.
+ */
+class QueryAdmissionController {
+    friend class AdmittedQuery;
+
+public:
+    QueryAdmissionController() : reservedMemory{0}, numAdmittedQueries{0}, numWaitingQueries{} {}
+
+    // Blocks until the query of the given priority can run. Throws an InterruptException if the
+    // query is interrupted or times out while it waits.
+    std::unique_ptr<AdmittedQuery> admit(
+        uint64_t estimatedMemoryUsage, common::QueryPriority priority, ExecutionContext* context);
+
+private:
+    bool canAdmitNoLock(uint64_t memoryToReserve, uint64_t memoryBudget,
+        common::QueryPriority priority) const;
+    void release(uint64_t memoryToRelease);
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t reservedMemory;
+    uint64_t numAdmittedQueries;
+    // Indexed by query priority.
+    std::array<uint64_t, 3> numWaitingQueries;
+};
+
+} // namespace processor
+} // namespace kuzu
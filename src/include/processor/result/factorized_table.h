@@ -48,6 +48,8 @@ public:
     inline void resetToZero() {
         memset(block->buffer, 0, common::BufferPoolConstants::PAGE_256KB_SIZE);
     }
+    inline void spill() { block->spill(); }
+    inline void reload() { block->reload(); }
 
     static void copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxToCopyFrom,
         DataBlock* blockToCopyInto, ft_tuple_idx_t tupleIdxToCopyTo, uint32_t numTuplesToCopy,
@@ -84,6 +86,8 @@ public:
     inline DataBlock* getBlock(ft_block_idx_t blockIdx) { return blocks[blockIdx].get(); }
 
     void merge(DataBlockCollection& other);
+    void spill();
+    void reload();
 
 private:
     uint32_t numBytesPerTuple;
@@ -258,6 +262,11 @@ public:
     void setNonOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colIdx);
     void clear();
 
+    // Spills all memory blocks of the table, see MemoryBuffer::spill(). The table can't be accessed
+    // until it is reloaded.
+    void spill();
+    void reload();
+
 private:
     void setOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colIdx, ft_tuple_idx_t tupleIdx);
 
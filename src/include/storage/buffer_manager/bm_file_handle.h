@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <cmath>
+#include <thread>
 
 #include "storage/buffer_manager/vm_region.h"
 #include "storage/file_handle.h"
@@ -15,6 +16,7 @@ class BufferManager;
 // Keeps the state information of a page in a file.
 class PageState {
     static constexpr uint64_t DIRTY_MASK = 0x0080000000000000;
+    static constexpr uint64_t HOT_MASK = 0x0040000000000000;
     static constexpr uint64_t STATE_MASK = 0xFF00000000000000;
     static constexpr uint64_t VERSION_MASK = 0x00FFFFFFFFFFFFFF;
     static constexpr uint64_t NUM_BITS_TO_SHIFT_FOR_STATE = 56;
@@ -81,6 +83,12 @@ public:
         stateAndVersion &= ~DIRTY_MASK;
     }
     inline bool isDirty() const { return stateAndVersion & DIRTY_MASK; }
+    // The hot bit is used by the eviction policy, and is cleared when the page is evicted.
+    inline void setHot() {
+        KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
+        stateAndVersion |= HOT_MASK;
+    }
+    inline static bool isHot(uint64_t stateAndVersion) { return stateAndVersion & HOT_MASK; }
     uint64_t getStateAndVersion() const { return stateAndVersion.load(); }
 
     inline void resetToEvicted() {
@@ -88,8 +96,8 @@ public:
     }
 
 private:
-    // Highest 1 bit is dirty bit, and the rest are page state and version bits.
-    // In the rest bits, the lowest 1 byte is state, and the rest are version.
+    // Highest 1 byte is the page state. Next to it are the dirty and hot bits, and the rest are
+    // version bits.
     std::atomic<uint64_t> stateAndVersion;
 };
 
@@ -168,6 +176,17 @@ public:
     bool hasWALPageVersionNoWALPageIdxLock(common::page_idx_t originalPageIdx);
 
     void clearWALPageIdxIfNecessary(common::page_idx_t originalPageIdx);
+    // Read-only files are mapped into memory, and their pages are read directly from the mapping
+    // rather than cached in frames, so that the OS page cache is shared by all readers.
+    inline bool isPageMMapped(common::page_idx_t pageIdx) const {
+        return pageIdx < numMMappedPages;
+    }
+    inline uint8_t* getMMappedPage(common::page_idx_t pageIdx) const {
+        KU_ASSERT(isPageMMapped(pageIdx));
+        return mmappedData + (uint64_t)pageIdx * getPageSize();
+    }
+    // Number of pages read from disk into the BM, used to measure hit rates.
+    inline uint64_t getNumPagesRead() const { return numPagesRead.load(); }
     common::page_idx_t getWALPageIdxNoWALPageIdxLock(common::page_idx_t originalPageIdx);
     void setWALPageIdx(common::page_idx_t originalPageIdx, common::page_idx_t pageIdxInWAL);
     // This function assumes that the caller has already acquired the wal page idx lock.
@@ -185,8 +204,15 @@ private:
                (pageIdx & common::StorageConstants::PAGE_IDX_IN_GROUP_MASK);
     }
     inline common::PageSizeClass getPageSizeClass() const { return pageSizeClass; }
+    // Page states and frames must not go away underneath an in-flight prefetch.
+    inline void waitForPrefetchesToFinish() {
+        while (numPrefetchesInFlight.load() > 0) {
+            std::this_thread::yield();
+        }
+    }
 
     void initPageStatesAndGroups();
+    void mmapFileIfReadOnly();
     common::page_idx_t addNewPageWithoutLock() override;
     void addNewPageGroupWithoutLock();
     inline common::page_group_idx_t getNumPageGroups() {
@@ -200,6 +226,11 @@ private:
     std::vector<std::unique_ptr<PageState>> pageStates;
     // Each file page group corresponds to a frame group in the VMRegion.
     std::vector<common::page_group_idx_t> frameGroupIdxes;
+    // Number of prefetch reads of this file that are queued or running in the BM.
+    std::atomic<uint64_t> numPrefetchesInFlight;
+    std::atomic<uint64_t> numPagesRead;
+    uint8_t* mmappedData;
+    common::page_idx_t numMMappedPages;
     // For each page group, if it has any WAL page version, we keep a `WALPageIdxGroup` in this map.
     // `WALPageIdxGroup` records the WAL page idx for each page in the page group.
     // Accesses to this map is synchronized by `fhSharedMutex`.
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+#include "common/enums/eviction_policy_type.h"
 #include "storage/buffer_manager/bm_file_handle.h"
 #include "storage/buffer_manager/locked_queue.h"
 
@@ -38,31 +43,150 @@ struct EvictionCandidate {
     }
 };
 
+// The candidates are spread over shards, each with its own lock, so that concurrent unpins don't
+// contend on a single queue. A thread enqueues into, and first dequeues from, its own shard, and
+// steals from the other shards once its shard is empty. Candidates are thus only FIFO ordered
+// within a shard.
 class EvictionQueue {
+    // Shards are padded to avoid false sharing between threads.
+    static constexpr uint64_t SHARD_ALIGNMENT = 64;
+    static constexpr uint64_t MAX_NUM_SHARDS = 128;
+
+    struct alignas(SHARD_ALIGNMENT) Shard {
+        LockedQueue<EvictionCandidate> queue;
+        // Signed, since a candidate can be dequeued, and the size decremented, before the thread
+        // enqueueing it increments the size.
+        std::atomic<int64_t> size{0};
+        std::atomic<uint64_t> numInsertions{0};
+
+        void removeNonEvictableCandidates();
+    };
+
 public:
-    EvictionQueue() { queue = std::make_unique<LockedQueue<EvictionCandidate>>(); }
+    EvictionQueue();
 
-    inline void enqueue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        queue->enqueue(candidate);
-    }
+    inline void enqueue(EvictionCandidate& candidate) { enqueue(getLocalShard(), candidate); }
     inline void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState,
         uint64_t pageVersion) {
-        std::shared_lock sLck{mtx};
-        queue->enqueue(EvictionCandidate{fileHandle, pageIdx, pageState, pageVersion});
+        EvictionCandidate candidate{fileHandle, pageIdx, pageState, pageVersion};
+        enqueue(getLocalShard(), candidate);
+    }
+    bool dequeue(EvictionCandidate& candidate);
+    // Approximate, as shards are updated concurrently.
+    uint64_t getSize() const;
+
+    void removeCandidatesForFile(BMFileHandle& fileHandle);
+
+private:
+    void enqueue(Shard& shard, EvictionCandidate& candidate);
+    inline uint64_t getLocalShardIdx() const { return localShardIdx & (shards.size() - 1); }
+    inline Shard& getLocalShard() { return *shards[getLocalShardIdx()]; }
+
+private:
+    std::vector<std::unique_ptr<Shard>> shards;
+    // Threads are assigned to shards round-robin on their first use of any eviction queue.
+    static std::atomic<uint64_t> nextLocalShardIdx;
+    static thread_local uint64_t localShardIdx;
+};
+
+// Keeps the eviction candidates of unpinned pages, and decides which of them to evict next.
+class EvictionPolicy {
+public:
+    virtual ~EvictionPolicy() = default;
+
+    static std::unique_ptr<EvictionPolicy> create(
+        common::EvictionPolicyType policyType, uint64_t bufferPoolSize);
+
+    // Called when a page is cached into its frame. The page is LOCKED.
+    virtual void onPageCached(
+        BMFileHandle& /*fileHandle*/, common::page_idx_t /*pageIdx*/, PageState& /*pageState*/) {}
+    virtual void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx,
+        PageState* pageState, uint64_t pageVersion) = 0;
+    // Returns false if no candidate is evictable.
+    virtual bool getNextCandidateToEvict(EvictionCandidate& candidate) = 0;
+    // Called once the page of a candidate returned by getNextCandidateToEvict is evicted. The
+    // eviction can still fail after the candidate is returned, e.g. if the page is pinned again.
+    virtual void onPageEvicted(const EvictionCandidate& /*candidate*/) {}
+    virtual void removeCandidatesForFile(BMFileHandle& fileHandle) = 0;
+};
+
+class FIFOEvictionPolicy final : public EvictionPolicy {
+public:
+    FIFOEvictionPolicy() : queue{std::make_unique<EvictionQueue>()} {}
+
+    inline void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx,
+        PageState* pageState, uint64_t pageVersion) override {
+        queue->enqueue(fileHandle, pageIdx, pageState, pageVersion);
+    }
+    bool getNextCandidateToEvict(EvictionCandidate& candidate) override;
+    inline void removeCandidatesForFile(BMFileHandle& fileHandle) override {
+        queue->removeCandidatesForFile(fileHandle);
     }
-    inline bool dequeue(EvictionCandidate& candidate) {
-        std::shared_lock sLck{mtx};
-        return queue->try_dequeue(candidate);
+
+private:
+    std::unique_ptr<EvictionQueue> queue;
+};
+
+// A variant of the 2Q policy ("2Q: A Low Overhead High Performance Buffer Management Replacement
+// Algorithm", Johnson and Shasha). Pages are cold when cached, and their candidates go into the
+// small queue, from which they are evicted in FIFO order, without second chances. Pages evicted
+// from the small queue are remembered in a ghost table, and a page found in it when cached again
+// is marked hot, as it was accessed twice within a short time. Candidates of hot pages go into the
+// main queue, which behaves like the FIFO policy. The main queue is only evicted from when the
+// small queue is within its target size.
+class TwoQueueEvictionPolicy final : public EvictionPolicy {
+    // Target size of the small queue, and size of the ghost table, relative to the number of
+    // 4KB frames in the buffer pool.
+    static constexpr double SMALL_QUEUE_SIZE_RATIO = 0.25;
+    static constexpr double GHOST_TABLE_SIZE_RATIO = 0.5;
+
+public:
+    explicit TwoQueueEvictionPolicy(uint64_t bufferPoolSize);
+
+    void onPageCached(
+        BMFileHandle& fileHandle, common::page_idx_t pageIdx, PageState& pageState) override;
+    void enqueue(BMFileHandle* fileHandle, common::page_idx_t pageIdx, PageState* pageState,
+        uint64_t pageVersion) override;
+    bool getNextCandidateToEvict(EvictionCandidate& candidate) override;
+    void onPageEvicted(const EvictionCandidate& candidate) override;
+    void removeCandidatesForFile(BMFileHandle& fileHandle) override;
+
+private:
+    bool getNextCandidateFromSmallQueue(EvictionCandidate& candidate);
+    bool getNextCandidateFromMainQueue(EvictionCandidate& candidate);
+
+    // The ghost table is a lossy hash set of recently evicted pages, storing one fingerprint per
+    // slot. Collisions only cost us some accuracy.
+    static uint64_t getGhostFingerprint(BMFileHandle* fileHandle, common::page_idx_t pageIdx);
+    inline std::atomic<uint64_t>& getGhostSlot(uint64_t fingerprint) {
+        return ghostTable[fingerprint & (ghostTable.size() - 1)];
     }
 
-    void removeNonEvictableCandidates();
+private:
+    uint64_t smallQueueTargetSize;
+    std::unique_ptr<EvictionQueue> smallQueue;
+    std::unique_ptr<EvictionQueue> mainQueue;
+    std::vector<std::atomic<uint64_t>> ghostTable;
+};
 
-    void removeCandidatesForFile(BMFileHandle& fileHandle);
+// A small pool of I/O threads serving the asynchronous page reads issued by
+// `BufferManager::prefetch`. Tasks left in the queue are still run when the pool is destroyed.
+class PrefetchThreadPool {
+public:
+    explicit PrefetchThreadPool(uint64_t numThreads);
+    ~PrefetchThreadPool();
+
+    void submit(std::function<void()> task);
+
+private:
+    void runWorker();
 
 private:
-    std::shared_mutex mtx;
-    std::unique_ptr<LockedQueue<EvictionCandidate>> queue;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+    bool stopped;
+    std::vector<std::thread> workers;
 };
 
 /**
@@ -112,7 +236,8 @@ private:
  * region. Both disk pages and memory buffers are all managed by the BM to make sure that actually
  * used physical memory doesn't go beyond max size specified by users. Currently, the BM uses a
  * queue based replacement policy and the MADV_DONTNEED hint to explicitly control evictions. See
- * comments above `claimAFrame()` for more details.
+ * comments above `claimAFrame()` for more details. The order in which unpinned pages are evicted is
+ * decided by the `EvictionPolicy`.
  *
  * Page states in BM:
  * A page can be in one of the four states: a) LOCKED, b) UNLOCKED, c) MARKED, d) EVICTED.
@@ -153,6 +278,13 @@ private:
  * 7. During eviction, if the page is in the MARKED state, it will be LOCKED first (7.1), then
  * removed from its frame, and set to EVICTED (7.2).
  *
+ * Pages of read-only files are not managed by the BM at all. The files are mapped into memory with
+ * mmap, and pin and optimisticRead return the mapped pages directly. See `BMFileHandle`.
+ *
+ * Pages can also be prefetched, which is a pin whose disk read is done asynchronously by an I/O
+ * thread, followed by an unpin once the read completes. While the read is in flight, the page is
+ * LOCKED, so pins and optimistic reads of it wait for the read to finish.
+ *
  * The design is inspired by vmcache in the paper "Virtual-Memory Assisted Buffer Management"
  * (https://www.cs.cit.tum.de/fileadmin/w00cfj/dis/_my_direct_uploads/vmcache.pdf).
  * We would also like to thank Fadhil Abubaker for doing the initial research and prototyping of
@@ -164,7 +296,12 @@ class BufferManager {
 public:
     enum class PageReadPolicy : uint8_t { READ_PAGE = 0, DONT_READ_PAGE = 1 };
 
-    explicit BufferManager(uint64_t bufferPoolSize);
+    // Spilled memory manager blocks keep their frames in the 256KB VMRegion, so that they are
+    // reloaded at the same address. So the region is reserved for the buffer pool plus
+    // `maxSpillSize`, which is the most that can be spilled.
+    explicit BufferManager(uint64_t bufferPoolSize,
+        common::EvictionPolicyType evictionPolicyType = common::EvictionPolicyType::FIFO,
+        uint64_t maxSpillSize = 0);
     ~BufferManager() = default;
 
     uint8_t* pin(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
@@ -173,6 +310,11 @@ public:
         const std::function<void(uint8_t*)>& func);
     // The function assumes that the requested page is already pinned.
     void unpin(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
+    // Asynchronously reads the EVICTED pages among [startPageIdx, startPageIdx + numPages) into
+    // their frames. Reads of consecutive pages are coalesced. This is only a hint: pages that
+    // cannot be claimed a frame, or are concurrently accessed, are skipped.
+    void prefetch(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, common::page_idx_t numPages);
 
     // Currently, these functions are specifically used only for WAL files.
     void removeFilePagesFromFrames(BMFileHandle& fileHandle);
@@ -191,14 +333,26 @@ public:
     inline common::frame_group_idx_t addNewFrameGroup(common::PageSizeClass pageSizeClass) {
         return vmRegions[pageSizeClass]->addNewFrameGroup();
     }
-    inline void clearEvictionQueue() { evictionQueue = std::make_unique<EvictionQueue>(); }
+    inline uint64_t getBufferPoolSize() const { return bufferPoolSize; }
+    inline void clearEvictionQueue() {
+        evictionPolicy = EvictionPolicy::create(evictionPolicyType, bufferPoolSize.load());
+    }
 
 private:
     bool claimAFrame(
         BMFileHandle& fileHandle, common::page_idx_t pageIdx, PageReadPolicy pageReadPolicy);
+    // Reserves the memory of a page of the file, evicting pages if necessary. Returns false if not
+    // enough memory can be freed.
+    bool reserveMemoryForPage(BMFileHandle& fileHandle);
     // Return number of bytes freed.
     uint64_t tryEvictPage(EvictionCandidate& candidate);
 
+    void prefetchMMappedPages(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, common::page_idx_t endPageIdx);
+    bool tryLockAndClaimFrameForPrefetch(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
+    void readPagesAsync(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, common::page_idx_t numPages);
+
     void cachePageIntoFrame(
         BMFileHandle& fileHandle, common::page_idx_t pageIdx, PageReadPolicy pageReadPolicy);
     void flushIfDirtyWithoutLock(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
@@ -221,11 +375,17 @@ private:
 private:
     std::atomic<uint64_t> usedMemory;
     std::atomic<uint64_t> bufferPoolSize;
-    std::atomic<uint64_t> numEvictionQueueInsertions;
+    // Memory held by pages whose prefetch reads haven't completed yet.
+    std::atomic<uint64_t> prefetchMemoryInFlight;
     // Each VMRegion corresponds to a virtual memory region of a specific page size. Currently, we
     // hold two sizes of PAGE_4KB and PAGE_256KB.
     std::vector<std::unique_ptr<VMRegion>> vmRegions;
-    std::unique_ptr<EvictionQueue> evictionQueue;
+    common::EvictionPolicyType evictionPolicyType;
+    std::unique_ptr<EvictionPolicy> evictionPolicy;
+    // Created on the first prefetch. Declared last so that in-flight reads finish before the rest
+    // of the BM is destroyed.
+    std::once_flag prefetchPoolInitFlag;
+    std::unique_ptr<PrefetchThreadPool> prefetchPool;
 };
 
 } // namespace storage
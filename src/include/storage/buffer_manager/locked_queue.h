@@ -1,29 +1,47 @@
 #pragma once
 
+#include <deque>
 #include <mutex>
-#include <queue>
 
 template<typename T>
 class LockedQueue {
     std::mutex mtx;
-    std::queue<T> q;
+    std::deque<T> q;
 
 public:
     void enqueue(T x) {
         std::scoped_lock lck{mtx};
-        q.push(std::move(x));
+        q.push_back(std::move(x));
     }
 
     bool try_dequeue(T& x) {
         std::scoped_lock lck{mtx};
         if (!q.empty()) {
             x = q.front();
-            q.pop();
+            q.pop_front();
             return true;
         }
         return false;
     }
 
+    // Dequeues the front element only if it satisfies the predicate.
+    template<typename Predicate>
+    bool try_dequeue_if(T& x, Predicate pred) {
+        std::scoped_lock lck{mtx};
+        if (!q.empty() && pred(q.front())) {
+            x = q.front();
+            q.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    template<typename Predicate>
+    void erase_if(Predicate pred) {
+        std::scoped_lock lck{mtx};
+        std::erase_if(q, pred);
+    }
+
     size_t size() {
         std::scoped_lock lck{mtx};
         return q.size();
@@ -1,16 +1,19 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <stack>
+#include <string>
 
 #include "common/types/types.h"
 
 namespace kuzu {
 namespace common {
+class FileInfo;
 class VirtualFileSystem;
-}
+} // namespace common
 
 namespace storage {
 
@@ -23,30 +26,47 @@ public:
     MemoryBuffer(MemoryAllocator* allocator, common::page_idx_t blockIdx, uint8_t* buffer);
     ~MemoryBuffer();
 
+    // Writes the buffer to the spill file of its allocator, and releases its memory. The buffer
+    // keeps its page, whose frame is at a fixed address in the buffer manager, so reload() reads
+    // the buffer back to the same address, and pointers into the buffer stay valid.
+    void spill();
+    void reload();
+
 public:
     uint8_t* buffer;
     common::page_idx_t pageIdx;
     MemoryAllocator* allocator;
+    bool isSpilled;
 };
 
 class MemoryAllocator {
     friend class MemoryBuffer;
 
 public:
-    explicit MemoryAllocator(BufferManager* bm, common::VirtualFileSystem* vfs);
+    MemoryAllocator(BufferManager* bm, common::VirtualFileSystem* vfs, std::string spillFilePath);
     ~MemoryAllocator();
 
     std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false);
     inline common::page_offset_t getPageSize() const { return pageSize; }
+    inline uint64_t getUsedMemory() const { return numUsedPages.load() * pageSize; }
+    inline bool canSpill() const { return !spillFilePath.empty(); }
 
 private:
-    void freeBlock(common::page_idx_t pageIdx);
+    void freeBlock(common::page_idx_t pageIdx, bool isSpilled);
+    void spillBlock(common::page_idx_t pageIdx, const uint8_t* buffer);
+    uint8_t* reloadBlock(common::page_idx_t pageIdx);
 
 private:
     std::unique_ptr<BMFileHandle> fh;
     BufferManager* bm;
+    common::VirtualFileSystem* vfs;
+    // The spill file is created the first time a buffer is spilled. Buffers are spilled at the
+    // offset of their pages in `fh`.
+    std::string spillFilePath;
+    std::unique_ptr<common::FileInfo> spillFileInfo;
     common::page_offset_t pageSize;
     std::stack<common::page_idx_t> freePages;
+    std::atomic<uint64_t> numUsedPages;
     std::mutex allocatorLock;
 };
 
@@ -64,17 +84,28 @@ private:
  *
  * MM will return a MemoryBuffer to the caller, which is a wrapper of the allocated memory block,
  * and it will automatically call its allocator to reclaim the memory block when it is destroyed.
+ *
+ * If the MM is given a spill file, operators that run low on memory can spill the memory buffers
+ * they won't access for a while to the file, and reload them later.
  */
 class MemoryManager {
 public:
-    explicit MemoryManager(BufferManager* bm, common::VirtualFileSystem* vfs) : bm{bm} {
-        allocator = std::make_unique<MemoryAllocator>(bm, vfs);
+    MemoryManager(
+        BufferManager* bm, common::VirtualFileSystem* vfs, std::string spillFilePath = "")
+        : bm{bm} {
+        allocator = std::make_unique<MemoryAllocator>(bm, vfs, std::move(spillFilePath));
     }
 
     inline std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false) {
         return allocator->allocateBuffer(initializeToZero);
     }
     inline BufferManager* getBufferManager() const { return bm; }
+    // Memory held by the buffers that are currently allocated.
+    inline uint64_t getUsedMemory() const { return allocator->getUsedMemory(); }
+    inline bool canSpill() const { return allocator->canSpill(); }
+    // Operators spill once the used memory exceeds this limit, see SPILL_MEMORY_RATIO.
+    uint64_t getSpillMemoryLimit() const;
+    inline bool isOverSpillMemoryLimit() const { return getUsedMemory() > getSpillMemoryLimit(); }
 
 private:
     BufferManager* bm;
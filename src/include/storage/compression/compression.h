@@ -5,6 +5,7 @@
 #include <cstring>
 #include <optional>
 
+#include "common/constants.h"
 #include "common/types/types.h"
 
 namespace kuzu {
@@ -17,6 +18,10 @@ class ColumnChunk;
 
 struct PageElementCursor;
 
+// Positions within a page are 16-bit integers (see PageElementCursor), so algorithms which can
+// store an arbitrary number of values in a page must still limit the number of values per page.
+constexpr uint64_t MAX_NUM_VALUES_PER_PAGE = (uint64_t)UINT16_MAX + 1;
+
 // Returns the size of the data type in bytes
 uint32_t getDataTypeSizeInChunk(const common::LogicalType& dataType);
 
@@ -27,6 +32,15 @@ enum class CompressionType : uint8_t {
     INTEGER_BITPACKING = 1,
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
+    FRAME_OF_REFERENCE = 4,
+    DELTA = 5,
+    ALP = 6,
+    // Only used for the data column of string columns, where each string is compressed
+    // separately (see fsst.h). The bytes are otherwise read and written as if uncompressed.
+    FSST = 7,
+    RLE = 8,
+    // Only used for the adj column of rel tables stored in CSR format.
+    NEIGHBOR_DELTA = 9,
 };
 
 struct CompressionMetadata {
@@ -55,6 +69,8 @@ class CompressionAlg {
 public:
     virtual ~CompressionAlg() = default;
 
+    virtual CompressionType getCompressionType() const = 0;
+
     // Takes a single uncompressed value from the srcBuffer and compresses it into the dstBuffer
     // Offsets refer to value offsets, not byte offsets
     virtual void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
@@ -100,6 +116,9 @@ public:
         : numBytesPerValue{static_cast<uint8_t>(getDataTypeSizeInChunk(logicalType))},
           dataType{logicalType.getPhysicalType()} {}
     static std::optional<CompressionMetadata> analyze(const ColumnChunk& chunk);
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::CONSTANT;
+    }
     template<typename T>
     static const T& getValue(const CompressionMetadata& metadata) {
         return *reinterpret_cast<const T*>(metadata.data.data());
@@ -142,6 +161,10 @@ public:
 
     Uncompressed(const Uncompressed&) = default;
 
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::UNCOMPRESSED;
+    }
+
     inline void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
         uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
         const CompressionMetadata& /*metadata*/) const final {
@@ -184,6 +207,74 @@ protected:
     const uint32_t numBytesPerValue;
 };
 
+// Serialized as nine bytes.
+// The first byte stores the bit width and the next two bytes store the number of exception slots
+// in each page. The remaining bytes are unused.
+struct NeighborListHeader {
+    uint8_t bitWidth;
+    uint16_t exceptionCapacity;
+
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> getData() const;
+
+    static NeighborListHeader readHeader(
+        const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data);
+};
+
+// Compression for the neighbour offsets in the adj column of CSR rel tables.
+// The neighbours in a CSR list are usually clustered (and often sorted), so each offset is stored
+// as the zigzag-encoded difference from the offset before it, bitpacked. Offsets whose difference
+// doesn't fit in the bit width are stored as exceptions, along with their position in the page;
+// this includes the first offset of most CSR lists, since the next list starts over from a small
+// offset. Every RESTART_INTERVAL-th offset is also stored as an exception, so a scan of one CSR
+// list starts decoding from the last exception before it and never decodes more than
+// RESTART_INTERVAL offsets which it doesn't return.
+// Each page starts with the number of exceptions and fixed-size arrays of exception values and
+// their (increasing) positions in the page, followed by the bitpacked differences.
+// Values cannot be updated in-place, since changing an offset changes the decoding of the next one.
+class NeighborListDelta final : public CompressionAlg {
+    static constexpr uint64_t CHUNK_SIZE = 32;
+    static constexpr uint64_t HEADER_SIZE = sizeof(uint64_t);
+
+public:
+    static constexpr uint64_t RESTART_INTERVAL = 128;
+
+    NeighborListDelta() = default;
+    NeighborListDelta(const NeighborListDelta&) = default;
+
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::NEIGHBOR_DELTA;
+    }
+
+    // Shouldn't be used, since values are never updated in-place.
+    void setValuesFromUncompressed(const uint8_t* /*srcBuffer*/, common::offset_t /*srcOffset*/,
+        uint8_t* /*dstBuffer*/, common::offset_t /*dstOffset*/, common::offset_t /*numValues*/,
+        const CompressionMetadata& /*metadata*/) const override {
+        KU_UNREACHABLE;
+    }
+
+    static uint64_t numValues(uint64_t dataSize, const NeighborListHeader& header);
+
+    // Returns uncompressed metadata if the offsets are not suitable for this compression.
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const override;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const override;
+
+private:
+    static inline uint64_t getPackedDataStart(const NeighborListHeader& header) {
+        auto size = HEADER_SIZE +
+                    header.exceptionCapacity * (sizeof(common::offset_t) + sizeof(uint16_t));
+        // Align to 8 bytes for fastpack
+        return (size + 7) / 8 * 8;
+    }
+};
+
 // Serialized as nine bytes.
 // In the first byte:
 //  Six bits are needed for the bit width (fewer for smaller types, but the header byte is the same
@@ -218,6 +309,10 @@ public:
     IntegerBitpacking() = default;
     IntegerBitpacking(const IntegerBitpacking&) = default;
 
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::INTEGER_BITPACKING;
+    }
+
     void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
         uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
         const CompressionMetadata& metadata) const final;
@@ -266,11 +361,217 @@ protected:
     }
 };
 
+// Frame of reference encoding for signed integers: values are stored bitpacked as unsigned
+// differences from the minimum value in the chunk. IntegerBitpacking only uses an offset when all
+// values have the same sign, and otherwise reserves a bit for the sign. This avoids the sign bit
+// for ranges which are negative or span zero (e.g. timestamps mixed with a small negative
+// sentinel).
+// The data layout is identical to IntegerBitpacking with a non-negative header, so reading and
+// writing is shared with it; only the choice of header and the in-place update check differ.
+template<typename T>
+class IntegerFrameOfReference final : public IntegerBitpacking<T> {
+    static_assert(std::is_signed_v<T>);
+    using U = std::make_unsigned_t<T>;
+
+public:
+    IntegerFrameOfReference() = default;
+    IntegerFrameOfReference(const IntegerFrameOfReference&) = default;
+
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::FRAME_OF_REFERENCE;
+    }
+
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override;
+
+    static bool canUpdateInPlace(T value, const BitpackHeader& header);
+};
+
+// Delta encoding for signed integers which change by a similar amount from one value to the next
+// (e.g. timestamps of regularly recorded events, or sorted keys).
+// Each page starts with its first value uncompressed, followed by the bitpacked differences between
+// consecutive values. The smallest difference in the chunk is stored as the header offset and
+// subtracted from each difference, so this is also a delta-of-delta encoding against a constant
+// stride: evenly spaced values have a bit width of zero and only take up the first value of the
+// page.
+// Values cannot be updated in-place, since changing a value would change every value after it in
+// the page.
+template<typename T>
+class IntegerDelta final : public CompressionAlg {
+    static_assert(std::is_signed_v<T>);
+    using U = std::make_unsigned_t<T>;
+    static constexpr uint64_t CHUNK_SIZE = 32;
+
+public:
+    IntegerDelta() = default;
+    IntegerDelta(const IntegerDelta&) = default;
+
+    inline CompressionType getCompressionType() const override { return CompressionType::DELTA; }
+
+    // Shouldn't be used, since values are never updated in-place.
+    void setValuesFromUncompressed(const uint8_t* /*srcBuffer*/, common::offset_t /*srcOffset*/,
+        uint8_t* /*dstBuffer*/, common::offset_t /*dstOffset*/, common::offset_t /*numValues*/,
+        const CompressionMetadata& /*metadata*/) const override {
+        KU_UNREACHABLE;
+    }
+
+    static inline uint64_t numValues(uint64_t dataSize, const BitpackHeader& header) {
+        if (header.bitWidth == 0) {
+            return MAX_NUM_VALUES_PER_PAGE;
+        }
+        auto numValues = (dataSize - sizeof(T)) * 8 / header.bitWidth;
+        numValues -= numValues % CHUNK_SIZE;
+        return numValues;
+    }
+
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const override;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const override;
+};
+
+// Run-length encoding for integers which come in long runs of equal values (e.g. low-cardinality
+// values sorted by key, or dictionary indices of repeated strings).
+// Since the position of a value has to be computable without reading the pages, every page holds
+// the same number of values, which is the largest power of two (up to MAX_NUM_VALUES_PER_PAGE)
+// such that no page has more runs than fit in it. It is stored in the metadata as its base-2
+// logarithm.
+// Each page starts with the number of runs, followed by the value of each run and then the
+// (exclusive) end position of each run within the page.
+// Values cannot be updated in-place, since doing so may split a run.
+template<typename T>
+class RunLengthEncoding final : public CompressionAlg {
+    static_assert(std::is_integral_v<T>);
+    static constexpr uint64_t HEADER_SIZE = sizeof(uint64_t);
+    using run_end_t = uint32_t;
+
+public:
+    RunLengthEncoding() = default;
+    RunLengthEncoding(const RunLengthEncoding&) = default;
+
+    inline CompressionType getCompressionType() const override { return CompressionType::RLE; }
+
+    // Shouldn't be used, since values are never updated in-place.
+    void setValuesFromUncompressed(const uint8_t* /*srcBuffer*/, common::offset_t /*srcOffset*/,
+        uint8_t* /*dstBuffer*/, common::offset_t /*dstOffset*/, common::offset_t /*numValues*/,
+        const CompressionMetadata& /*metadata*/) const override {
+        KU_UNREACHABLE;
+    }
+
+    // Pages are assumed to be BufferPoolConstants::PAGE_4KB_SIZE bytes.
+    static inline uint64_t numValues(const CompressionMetadata& metadata) {
+        return 1ull << metadata.data[0];
+    }
+
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const override;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const override;
+
+private:
+    static constexpr uint64_t MAX_RUNS_PER_PAGE =
+        (common::BufferPoolConstants::PAGE_4KB_SIZE - HEADER_SIZE - sizeof(run_end_t)) /
+        (sizeof(T) + sizeof(run_end_t));
+
+    static inline uint64_t getRunEndsStart(uint64_t numRuns) {
+        // Align to the size of the run ends
+        auto size = HEADER_SIZE + numRuns * sizeof(T);
+        return (size + sizeof(run_end_t) - 1) / sizeof(run_end_t) * sizeof(run_end_t);
+    }
+};
+
+// Serialized as nine bytes.
+// In the first byte:
+//  The lower five bits store the decimal exponent.
+//  The upper three bits store the number of exception slots in each page, as
+//  log2(exceptionCapacity) + 1 (or 0 if there is no space for exceptions).
+// The second byte stores the bit width.
+// The remaining seven bytes store the offset as a 56-bit signed integer.
+struct ALPHeader {
+    uint8_t exponent;
+    uint8_t bitWidth;
+    uint8_t exceptionCapacity;
+    // Offset to apply to all encoded values
+    int64_t offset;
+    static constexpr uint8_t EXPONENT_MASK = 0b00011111;
+    static constexpr uint8_t MAX_EXCEPTION_CAPACITY = 64;
+
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> getData() const;
+
+    static ALPHeader readHeader(const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data);
+};
+
+// Lossless compression for floating point values with few significant decimal digits, based on
+// ALP (Adaptive Lossless floating-Point compression).
+// Each value is multiplied by 10^exponent and rounded to an integer, which is then bitpacked
+// relative to the offset (frame of reference). The exponent is chosen per chunk using a sample of
+// the values. Values which don't convert back to exactly the same bits (e.g. NaN, -0.0, or values
+// with too many significant digits) are stored as exceptions.
+// Each page starts with the number of exceptions and fixed-size arrays of exception values and
+// their positions in the page, followed by the bitpacked integers.
+template<typename T>
+class FloatCompression final : public CompressionAlg {
+    static_assert(std::is_floating_point_v<T>);
+    static constexpr uint64_t CHUNK_SIZE = 32;
+    static constexpr uint64_t HEADER_SIZE = sizeof(uint64_t);
+
+public:
+    FloatCompression() = default;
+    FloatCompression(const FloatCompression&) = default;
+
+    inline CompressionType getCompressionType() const override { return CompressionType::ALP; }
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata) const override;
+
+    static uint64_t numValues(uint64_t dataSize, const ALPHeader& header);
+
+    // Returns uncompressed metadata if the values are not suitable for this compression
+    CompressionMetadata getCompressionMetadata(
+        const uint8_t* srcBuffer, uint64_t numValues) const override;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const override;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const override;
+
+    // Values which would need to be stored as exceptions are never updated in-place, since the
+    // page may not have space for them.
+    static bool canUpdateInPlace(T value, const ALPHeader& header);
+
+private:
+    static inline uint64_t getPackedDataStart(const ALPHeader& header) {
+        auto size = HEADER_SIZE + header.exceptionCapacity * (sizeof(T) + sizeof(uint16_t));
+        // Align to 8 bytes for fastpack
+        return (size + 7) / 8 * 8;
+    }
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
     BooleanBitpacking(const BooleanBitpacking&) = default;
 
+    inline CompressionType getCompressionType() const override {
+        return CompressionType::BOOLEAN_BITPACKING;
+    }
+
     void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
         uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
         const CompressionMetadata& metadata) const final;
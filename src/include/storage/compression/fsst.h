@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace kuzu {
+namespace storage {
+
+// Fast Static Symbol Table (FSST) string compression, as described by Boncz, Neumann and Leis
+// (VLDB 2020).
+// Strings are encoded as a sequence of one-byte codes, each of which stands for a symbol of
+// between 1 and 8 bytes from a table of at most 255 symbols. Bytes which are not covered by any
+// symbol are written as an escape code followed by the literal byte.
+// Since the table is static, any string can be decompressed independently given only the table.
+class FSSTSymbolTable {
+public:
+    static constexpr uint8_t MAX_SYMBOL_LENGTH = 8;
+    static constexpr uint16_t MAX_NUM_SYMBOLS = 255;
+    static constexpr uint8_t ESCAPE_CODE = 255;
+
+    FSSTSymbolTable()
+        : numSymbols{0}, symbols{}, symbolLengths{}, codeIdxByFirstByte{}, sortedCodes{} {}
+
+    // Builds a symbol table suited to compressing the given strings (or a sample of them).
+    static FSSTSymbolTable train(const std::vector<std::string_view>& strings);
+
+    // The serialized table consists of the number of symbols, followed by the length of each
+    // symbol and then the bytes of each symbol.
+    uint64_t getSerializedSize() const;
+    void serialize(uint8_t* buffer) const;
+    static FSSTSymbolTable deserialize(const uint8_t* buffer);
+
+    // Every input byte takes up at most two output bytes (an escape code and the literal).
+    static inline uint64_t getMaxCompressedSize(uint64_t length) { return 2 * length; }
+    // Returns the number of bytes written to out.
+    uint64_t compress(const uint8_t* in, uint64_t length, uint8_t* out) const;
+    uint64_t getDecompressedSize(const uint8_t* in, uint64_t length) const;
+    // out must have space for getDecompressedSize(in, length) bytes.
+    void decompress(const uint8_t* in, uint64_t length, uint8_t* out) const;
+
+    inline uint16_t getNumSymbols() const { return numSymbols; }
+
+private:
+    void addSymbol(std::string_view symbol);
+    // Sorts the codes by their first byte and then by decreasing length, so that the longest
+    // matching symbol can be found by checking the symbols starting with a given byte in order.
+    void buildIndex();
+    // Returns the code of the longest symbol which is a prefix of the input, or ESCAPE_CODE if
+    // there is none.
+    uint8_t findLongestSymbol(const uint8_t* in, uint64_t length) const;
+
+private:
+    uint16_t numSymbols;
+    std::array<std::array<uint8_t, MAX_SYMBOL_LENGTH>, MAX_NUM_SYMBOLS> symbols;
+    std::array<uint8_t, MAX_NUM_SYMBOLS> symbolLengths;
+    // The codes of the symbols starting with byte b are
+    // sortedCodes[codeIdxByFirstByte[b]..codeIdxByFirstByte[b + 1]).
+    std::array<uint16_t, 257> codeIdxByFirstByte;
+    std::array<uint8_t, MAX_NUM_SYMBOLS> sortedCodes;
+};
+
+} // namespace storage
+} // namespace kuzu
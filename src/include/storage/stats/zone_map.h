@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "common/enums/expression_type.h"
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace storage {
+
+// Min/max statistics of the non-null values within a column chunk. They are persisted as part of
+// ColumnChunkMetadata and used to skip whole node groups when a pushed-down comparison predicate
+// cannot match any value in the chunk.
+// Only maintained for fixed-sized numeric physical types (which covers DATE and TIMESTAMP). Values
+// are stored with the same in-memory representation as the physical type.
+struct ZoneMap {
+    static constexpr uint8_t VALUE_SIZE = 8;
+
+    // If false, nothing is known about the values in the chunk and it can never be skipped.
+    bool isValid;
+    // True if the chunk contains no non-null values, in which case min and max are meaningless.
+    bool isEmpty;
+    std::array<uint8_t, VALUE_SIZE> min;
+    std::array<uint8_t, VALUE_SIZE> max;
+
+    ZoneMap() : isValid{false}, isEmpty{true}, min{}, max{} {}
+
+    static bool isSupported(common::PhysicalTypeID physicalType);
+    // Computes the zone map over the first numValues values of buffer. nullMask follows the
+    // NullMask bit layout and may be nullptr if the chunk has no nulls.
+    static ZoneMap compute(common::PhysicalTypeID physicalType, const uint8_t* buffer,
+        const uint64_t* nullMask, uint64_t numValues);
+
+    // Widens the zone map to include the given value (in-place updates). Zone maps of unsupported
+    // types are invalidated instead. Returns true if the zone map changed.
+    bool update(common::PhysicalTypeID physicalType, const uint8_t* value);
+    inline void invalidate() { isValid = false; }
+};
+
+// A comparison between a column and a constant which can be checked against a zone map.
+struct ZoneMapCheck {
+    common::column_id_t columnID;
+    // One of EQUALS, GREATER_THAN, GREATER_THAN_EQUALS, LESS_THAN or LESS_THAN_EQUALS, with the
+    // column on the left hand side.
+    common::ExpressionType comparison;
+    std::array<uint8_t, ZoneMap::VALUE_SIZE> value;
+
+    ZoneMapCheck(common::column_id_t columnID, common::ExpressionType comparison,
+        const std::array<uint8_t, ZoneMap::VALUE_SIZE>& value)
+        : columnID{columnID}, comparison{comparison}, value{value} {}
+
+    static bool isSupportedComparison(common::ExpressionType comparison);
+    // Returns the comparison obtained by swapping the operands, e.g. `5 < a` becomes `a > 5`.
+    static common::ExpressionType flipComparison(common::ExpressionType comparison);
+
+    // Returns true if no value described by the zone map can satisfy the comparison.
+    bool canSkip(const ZoneMap& zoneMap, common::PhysicalTypeID physicalType) const;
+};
+
+} // namespace storage
+} // namespace kuzu
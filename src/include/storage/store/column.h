@@ -122,6 +122,12 @@ protected:
 
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
         const std::function<void(uint8_t*)>& func);
+    // Asynchronously reads the next NUM_PAGES_TO_PREFETCH pages of the chunk into the BM if pageIdx
+    // starts such a window of pages, counted from the first page of the chunk. Scans call this for
+    // each page they read, so each window is requested once per scan of the chunk, however many
+    // vectors the scan reads it in.
+    void prefetchPages(transaction::Transaction* transaction, const ColumnChunkMetadata& chunkMeta,
+        common::page_idx_t pageIdx);
 
     virtual void writeValue(const ColumnChunkMetadata& chunkMeta,
         common::node_group_idx_t nodeGroupIdx, common::offset_t offsetInChunk,
@@ -216,12 +222,17 @@ public:
 
     // TODO(Guodong): Should figure out a better way to set tableID, and remove this function.
     inline void setCommonTableID(common::table_id_t tableID) { commonTableID = tableID; }
+    // Set for the adj columns of CSR rel tables, whose chunks delta encode neighbour offsets.
+    inline void setCompressNbrLists(bool compressNbrLists_) { compressNbrLists = compressNbrLists_; }
 
 private:
     void populateCommonTableID(common::ValueVector* resultVector) const;
 
+    std::unique_ptr<ColumnChunk> getEmptyChunkForCommit() override;
+
 private:
     common::table_id_t commonTableID;
+    bool compressNbrLists;
 };
 
 struct ColumnFactory {
@@ -7,6 +7,7 @@
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/bm_file_handle.h"
 #include "storage/compression/compression.h"
+#include "storage/stats/zone_map.h"
 
 namespace kuzu {
 namespace storage {
@@ -19,11 +20,14 @@ struct ColumnChunkMetadata {
     common::page_idx_t numPages;
     uint64_t numValues;
     CompressionMetadata compMeta;
+    ZoneMap zoneMap;
 
     ColumnChunkMetadata() : pageIdx{common::INVALID_PAGE_IDX}, numPages{0}, numValues{UINT64_MAX} {}
     ColumnChunkMetadata(common::page_idx_t pageIdx, common::page_idx_t numPages,
-        uint64_t numNodesInChunk, const CompressionMetadata& compMeta)
-        : pageIdx(pageIdx), numPages(numPages), numValues(numNodesInChunk), compMeta(compMeta) {}
+        uint64_t numNodesInChunk, const CompressionMetadata& compMeta,
+        const ZoneMap& zoneMap = ZoneMap())
+        : pageIdx(pageIdx), numPages(numPages), numValues(numNodesInChunk), compMeta(compMeta),
+          zoneMap(zoneMap) {}
 };
 
 // Base data segment covers all fixed-sized data types.
@@ -52,6 +56,8 @@ public:
 
     // Note that the startPageIdx is not known, so it will always be common::INVALID_PAGE_IDX
     virtual ColumnChunkMetadata getMetadataToFlush() const;
+    // Min/max of the non-null values in the chunk. Invalid for types without zone map support.
+    ZoneMap getZoneMap() const;
 
     virtual void append(common::ValueVector* vector);
     virtual void append(
@@ -205,6 +211,11 @@ struct ColumnChunkFactory {
         std::unique_ptr<common::LogicalType> dataType, bool enableCompression,
         uint64_t capacity = common::StorageConstants::NODE_GROUP_SIZE);
 
+    // Chunks of the adj column of CSR rel tables, whose neighbour offsets are delta encoded (see
+    // NeighborListDelta) when compression is enabled.
+    static std::unique_ptr<ColumnChunk> createCSRAdjColumnChunk(bool enableCompression,
+        uint64_t capacity = common::StorageConstants::NODE_GROUP_SIZE);
+
     static std::unique_ptr<ColumnChunk> createNullColumnChunk(bool enableCompression) {
         return std::make_unique<NullColumnChunk>(
             common::StorageConstants::NODE_GROUP_SIZE, enableCompression);
@@ -47,6 +47,10 @@ public:
     void read(transaction::Transaction* transaction, TableReadState& readState,
         common::ValueVector* nodeIDVector,
         const std::vector<common::ValueVector*>& outputVectors) override;
+    inline bool canSkipNodeGroup(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx, const std::vector<ZoneMapCheck>& checks) {
+        return tableData->canSkipNodeGroup(transaction, nodeGroupIdx, checks);
+    }
 
     // Return the max node offset during insertions.
     common::offset_t validateUniquenessConstraint(
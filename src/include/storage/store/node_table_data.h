@@ -25,6 +25,10 @@ public:
     void lookup(transaction::Transaction* transaction, TableReadState& readState,
         common::ValueVector* nodeIDVector,
         const std::vector<common::ValueVector*>& outputVectors) override;
+    // Returns true if the zone maps of the node group prove that none of its nodes can satisfy
+    // all the given checks.
+    bool canSkipNodeGroup(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx, const std::vector<ZoneMapCheck>& checks);
 
     // These two interfaces are node table specific, as rel table requires also relIDVector.
     void insert(transaction::Transaction* transaction, common::ValueVector* nodeIDVector,
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <mutex>
+
+#include "storage/compression/fsst.h"
 #include "storage/store/column.h"
 
 namespace kuzu {
 namespace storage {
 
+class StringColumnChunk;
+
 class StringColumn final : public Column {
 public:
     using string_offset_t = uint64_t;
@@ -46,9 +51,12 @@ protected:
     void lookupInternal(transaction::Transaction* transaction, common::ValueVector* nodeIDVector,
         common::ValueVector* resultVector) override;
 
+    // If the data is FSST-compressed, the symbol table must be provided and the compressed string
+    // is first read into compressedBuffer before being decompressed into the result vector.
     void scanValueToVector(transaction::Transaction* transaction, const ReadState& dataState,
         uint64_t startOffset, uint64_t endOffset, common::ValueVector* resultVector,
-        uint64_t offsetInVector);
+        uint64_t offsetInVector, const FSSTSymbolTable* symbolTable,
+        std::vector<uint8_t>& compressedBuffer);
     void scanOffsets(transaction::Transaction* transaction, const ReadState& state,
         uint64_t* offsets, uint64_t index, uint64_t numValues, uint64_t dataSize);
     // Offsets to scan should be a sorted list of pairs mapping the index of the entry in the string
@@ -60,6 +68,18 @@ protected:
         common::ValueVector* resultVector, const ReadState& indexState);
 
 private:
+    // Returns the symbol table stored at the start of the data chunk, or nullptr if the data is not
+    // compressed. The tables of committed node groups are decoded once and then cached.
+    std::shared_ptr<const FSSTSymbolTable> getSymbolTable(transaction::Transaction* transaction,
+        common::node_group_idx_t nodeGroupIdx, const ReadState& dataState);
+    FSSTSymbolTable readSymbolTable(
+        transaction::Transaction* transaction, const ReadState& dataState);
+    // Flushes the data and offsets of the chunk with the strings compressed using FSST.
+    // Returns false, without writing anything, if compression would not reduce the number of
+    // pages used by the data.
+    bool appendCompressedData(
+        StringColumnChunk* stringColumnChunk, common::node_group_idx_t nodeGroupIdx);
+
     bool canCommitInPlace(transaction::Transaction* transaction,
         common::node_group_idx_t nodeGroupIdx, LocalVectorCollection* localChunk,
         const offset_to_row_idx_t& insertInfo, const offset_to_row_idx_t& updateInfo) override;
@@ -71,6 +91,14 @@ private:
     // the end.
     std::unique_ptr<Column> dataColumn;
     std::unique_ptr<Column> offsetColumn;
+
+    struct CachedSymbolTable {
+        // The first page of the data chunk the table was read from.
+        common::page_idx_t pageIdx = common::INVALID_PAGE_IDX;
+        std::shared_ptr<const FSSTSymbolTable> symbolTable;
+    };
+    std::mutex symbolTableCacheMtx;
+    std::vector<CachedSymbolTable> symbolTableCache;
 };
 
 } // namespace storage
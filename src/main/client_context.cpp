@@ -24,8 +24,8 @@ void ActiveQuery::reset() {
 ClientContext::ClientContext(Database* database)
     : numThreadsForExecution{database->systemConfig.maxNumThreads},
       timeoutInMS{ClientContextConstants::TIMEOUT_IN_MS},
-      varLengthExtendMaxDepth{DEFAULT_VAR_LENGTH_EXTEND_MAX_DEPTH}, enableSemiMask{
-                                                                        DEFAULT_ENABLE_SEMI_MASK} {
+      varLengthExtendMaxDepth{DEFAULT_VAR_LENGTH_EXTEND_MAX_DEPTH},
+      enableSemiMask{DEFAULT_ENABLE_SEMI_MASK}, queryPriority{QueryPriority::NORMAL} {
     transactionContext = std::make_unique<TransactionContext>(database);
     for (auto& [name, option] : database->extensionOptions->getExtensionOptions()) {
         StringUtils::toLower(option.name);
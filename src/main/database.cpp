@@ -8,6 +8,7 @@
 
 #include "common/exception/exception.h"
 #include "common/exception/extension.h"
+#include "common/file_system/local_file_system.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/logging_level_utils.h"
 #include "common/utils.h"
@@ -29,9 +30,10 @@ using namespace kuzu::transaction;
 namespace kuzu {
 namespace main {
 
-SystemConfig::SystemConfig(
-    uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression, bool readOnly)
-    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly) {
+SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads,
+    bool enableCompression, bool readOnly, EvictionPolicyType evictionPolicy)
+    : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly(readOnly),
+      evictionPolicy{evictionPolicy} {
     if (bufferPoolSize_ == -1u || bufferPoolSize_ == 0) {
 #if defined(_WIN32)
         MEMORYSTATUSEX status;
@@ -59,13 +61,27 @@ static void getLockFileFlagsAndType(bool readOnly, bool createNew, int& flags, F
     lock = readOnly ? FileLockType::READ_LOCK : FileLockType::WRITE_LOCK;
 }
 
+// Memory manager blocks are spilled to the system temp directory, so the space left on its disk
+// bounds how much can be spilled. No spilling happens if the space cannot be queried.
+static uint64_t getMaxSpillSize(const std::string& spillFilePath) {
+    std::error_code errorCode;
+    auto spaceInfo =
+        std::filesystem::space(std::filesystem::path{spillFilePath}.parent_path(), errorCode);
+    return errorCode ? 0 : spaceInfo.available;
+}
+
 Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     : databasePath{databasePath}, systemConfig{systemConfig} {
     initLoggers();
     logger = LoggerUtils::getLogger(LoggerConstants::LoggerEnum::DATABASE);
     vfs = std::make_unique<VirtualFileSystem>();
-    bufferManager = std::make_unique<BufferManager>(this->systemConfig.bufferPoolSize);
-    memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get());
+    auto spillFilePath =
+        LocalFileSystem::getTempFilePath(StorageConstants::MEMORY_SPILL_FILE_NAME_PREFIX);
+    auto maxSpillSize = getMaxSpillSize(spillFilePath);
+    bufferManager = std::make_unique<BufferManager>(this->systemConfig.bufferPoolSize,
+        this->systemConfig.evictionPolicy, maxSpillSize);
+    memoryManager = std::make_unique<MemoryManager>(
+        bufferManager.get(), vfs.get(), maxSpillSize > 0 ? spillFilePath : "");
     queryProcessor = std::make_unique<processor::QueryProcessor>(this->systemConfig.maxNumThreads);
     initDBDirAndCoreFilesIfNecessary();
     wal =
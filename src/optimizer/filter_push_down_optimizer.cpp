@@ -4,6 +4,7 @@
 #include "binder/expression/property_expression.h"
 #include "binder/expression_visitor.h"
 #include "common/cast.h"
+#include "planner/operator/logical_cross_product.h"
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
@@ -89,6 +90,9 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     auto hashJoin = std::make_shared<LogicalHashJoin>(
         joinConditions, JoinType::INNER, op->getChild(0), op->getChild(1));
     hashJoin->setSIP(planner::SidewaysInfoPassing::PROHIBIT);
+    auto crossProduct = (LogicalCrossProduct*)op.get();
+    hashJoin->setSideCardinalities(
+        crossProduct->getProbeSideCardinality(), crossProduct->getBuildSideCardinality());
     hashJoin->computeFlatSchema();
     return hashJoin;
 }
@@ -155,8 +159,15 @@ std::shared_ptr<planner::LogicalOperator> FilterPushDownOptimizer::pushDownToSca
                   ((PropertyExpression&)*nodeID).getVariableName());
         propertiesSet.insert(expression);
     }
-    auto scanNodeProperty = appendScanNodeProperty(std::move(nodeID), std::move(tableIDs),
-        expression_vector{propertiesSet.begin(), propertiesSet.end()}, std::move(child));
+    auto properties = expression_vector{propertiesSet.begin(), propertiesSet.end()};
+    auto hasPropertiesToScan = !properties.empty();
+    auto scanNodeProperty = appendScanNodeProperty(
+        std::move(nodeID), std::move(tableIDs), std::move(properties), std::move(child));
+    if (hasPropertiesToScan) {
+        auto scan = ku_dynamic_cast<LogicalOperator*, LogicalScanNodeProperty*>(
+            scanNodeProperty.get());
+        scan->setPredicates(expression_vector{predicate});
+    }
     return appendFilter(std::move(predicate), scanNodeProperty);
 }
 
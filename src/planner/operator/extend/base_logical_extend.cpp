@@ -14,6 +14,9 @@ static std::string relToString(const binder::RelExpression& rel) {
     case QueryRelType::ALL_SHORTEST: {
         result += "ALL SHORTEST";
     } break;
+    case QueryRelType::WEIGHTED_SHORTEST: {
+        result += "WEIGHTED SHORTEST";
+    } break;
     default:
         break;
     }
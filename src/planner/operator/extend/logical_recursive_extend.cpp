@@ -29,6 +29,9 @@ void LogicalRecursiveExtend::computeFlatSchema() {
     }
     auto rewriter = optimizer::RemoveFactorizationRewriter();
     rewriter.visitOperator(recursiveChild);
+    if (bwdRecursiveChild != nullptr) {
+        rewriter.visitOperator(bwdRecursiveChild);
+    }
 }
 
 void LogicalRecursiveExtend::computeFactorizedSchema() {
@@ -45,6 +48,9 @@ void LogicalRecursiveExtend::computeFactorizedSchema() {
     }
     auto rewriter = optimizer::FactorizationRewriter();
     rewriter.visitOperator(recursiveChild.get());
+    if (bwdRecursiveChild != nullptr) {
+        rewriter.visitOperator(bwdRecursiveChild.get());
+    }
 }
 
 void LogicalPathPropertyProbe::computeFactorizedSchema() {
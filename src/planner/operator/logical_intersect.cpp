@@ -61,8 +61,10 @@ std::unique_ptr<LogicalOperator> LogicalIntersect::copy() {
     for (auto i = 1u; i < children.size(); ++i) {
         buildChildren.push_back(children[i]->copy());
     }
-    return make_unique<LogicalIntersect>(
+    auto intersect = make_unique<LogicalIntersect>(
         intersectNodeID, keyNodeIDs, children[0]->copy(), std::move(buildChildren));
+    intersect->setBuildSideCardinality(buildSideCardinality);
+    return intersect;
 }
 
 } // namespace planner
@@ -11,6 +11,7 @@ void Planner::appendCrossProduct(
     auto crossProduct = make_shared<LogicalCrossProduct>(
         accumulateType, probePlan.getLastOperator(), buildPlan.getLastOperator());
     crossProduct->computeFactorizedSchema();
+    crossProduct->setSideCardinalities(probePlan.getCardinality(), buildPlan.getCardinality());
     // update cost
     probePlan.setCost(probePlan.getCardinality() + buildPlan.getCardinality());
     // update cardinality
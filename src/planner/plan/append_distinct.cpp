@@ -11,6 +11,7 @@ void Planner::appendDistinct(const expression_vector& expressionsToDistinct, Log
     appendFlattens(distinct->getGroupsPosToFlatten(), plan);
     distinct->setChild(0, plan.getLastOperator());
     distinct->computeFactorizedSchema();
+    distinct->setInputCardinality(plan.getCardinality());
     plan.setLastOperator(std::move(distinct));
 }
 
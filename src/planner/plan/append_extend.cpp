@@ -154,6 +154,14 @@ void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& bound
     }
     auto extend = std::make_shared<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
         RecursiveJoinType::TRACK_PATH, plan.getLastOperator(), recursivePlan->getLastOperator());
+    // A shortest path to a single dst node can be searched from both ends. Node predicates must
+    // hold for nodes where the two searches meet, which isn't checked, so they are not supported.
+    if (rel->getRelType() == QueryRelType::SHORTEST && recursiveInfo->nodePredicate == nullptr) {
+        auto bwdRecursivePlan = std::make_unique<LogicalPlan>();
+        createRecursivePlan(*recursiveInfo, ExtendDirectionUtils::getOppositeDirection(direction),
+            *bwdRecursivePlan);
+        extend->setBwdRecursiveChild(bwdRecursivePlan->getLastOperator());
+    }
     appendFlattens(extend->getGroupsPosToFlatten(), plan);
     extend->setChild(0, plan.getLastOperator());
     extend->computeFactorizedSchema();
@@ -225,6 +233,9 @@ void Planner::createRecursivePlan(
     }
     auto relProperties = collectPropertiesToRead(recursiveInfo.relPredicate);
     relProperties.push_back(rel->getInternalIDProperty());
+    if (recursiveInfo.weightProperty != nullptr) {
+        relProperties.push_back(recursiveInfo.weightProperty);
+    }
     appendNonRecursiveExtend(
         boundNode, nbrNode, rel, direction, ExpressionUtil::removeDuplication(relProperties), plan);
     if (recursiveInfo.relPredicate) {
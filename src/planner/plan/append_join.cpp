@@ -24,6 +24,7 @@ void Planner::appendHashJoin(const binder::expression_vector& joinNodeIDs, JoinT
     appendFlattens(hashJoin->getGroupsPosToFlattenOnBuildSide(), buildPlan);
     hashJoin->setChild(1, buildPlan.getLastOperator());
     hashJoin->computeFactorizedSchema();
+    hashJoin->setSideCardinalities(probePlan.getCardinality(), buildPlan.getCardinality());
     // Check for sip
     auto ratio = probePlan.getCardinality() / buildPlan.getCardinality();
     if (ratio > PlannerKnobs::SIP_RATIO) {
@@ -55,6 +56,7 @@ void Planner::appendMarkJoin(const binder::expression_vector& joinNodeIDs,
     appendFlattens(hashJoin->getGroupsPosToFlattenOnBuildSide(), buildPlan);
     hashJoin->setChild(1, buildPlan.getLastOperator());
     hashJoin->computeFactorizedSchema();
+    hashJoin->setSideCardinalities(probePlan.getCardinality(), buildPlan.getCardinality());
     // update cost. Mark join does not change cardinality.
     probePlan.setCost(CostModel::computeMarkJoinCost(joinNodeIDs, probePlan, buildPlan));
     probePlan.setLastOperator(std::move(hashJoin));
@@ -74,14 +76,17 @@ void Planner::appendIntersect(const std::shared_ptr<binder::Expression>& interse
         probePlan.getLastOperator(), std::move(buildChildren));
     appendFlattens(intersect->getGroupsPosToFlattenOnProbeSide(), probePlan);
     intersect->setChild(0, probePlan.getLastOperator());
+    uint64_t buildSideCardinality = 0;
     for (auto i = 0u; i < buildPlans.size(); ++i) {
         appendFlattens(intersect->getGroupsPosToFlattenOnBuildSide(i), *buildPlans[i]);
         intersect->setChild(i + 1, buildPlans[i]->getLastOperator());
+        buildSideCardinality += buildPlans[i]->getCardinality();
         auto ratio = probePlan.getCardinality() / buildPlans[i]->getCardinality();
         if (ratio > PlannerKnobs::SIP_RATIO) {
             intersect->setSIP(SidewaysInfoPassing::PROHIBIT_PROBE_TO_BUILD);
         }
     }
+    intersect->setBuildSideCardinality(buildSideCardinality);
     intersect->computeFactorizedSchema();
     // update cost
     probePlan.setCost(CostModel::computeIntersectCost(probePlan, buildPlans));
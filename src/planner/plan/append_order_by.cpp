@@ -12,6 +12,7 @@ void Planner::appendOrderBy(
     appendFlattens(orderBy->getGroupsPosToFlatten(), plan);
     orderBy->setChild(0, plan.getLastOperator());
     orderBy->computeFactorizedSchema();
+    orderBy->setInputCardinality(plan.getCardinality());
     plan.setLastOperator(std::move(orderBy));
 }
 
@@ -1,6 +1,7 @@
 #include "planner/operator/logical_hash_join.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/hash_join/join_key_filter.h"
 #include "processor/plan_mapper.h"
 
 using namespace kuzu::binder;
@@ -55,6 +56,54 @@ std::unique_ptr<HashJoinBuildInfo> PlanMapper::createHashBuildInfo(
         std::move(keysPos), std::move(fStateTypes), std::move(payloadsPos), std::move(tableSchema));
 }
 
+// Returns the lowest operator of the probe side pipeline that the key is in scope of. Only
+// operators whose output doesn't depend on the tuples that are dropped are gone through.
+static LogicalOperator* getJoinKeyFilterPosition(LogicalOperator* op, const Expression& key) {
+    while (true) {
+        switch (op->getOperatorType()) {
+        case LogicalOperatorType::EXTEND:
+        case LogicalOperatorType::FILTER:
+        case LogicalOperatorType::FLATTEN:
+        case LogicalOperatorType::NODE_LABEL_FILTER:
+        case LogicalOperatorType::PROJECTION:
+        case LogicalOperatorType::SCAN_NODE_PROPERTY:
+            break;
+        default:
+            return op;
+        }
+        auto child = op->getChild(0).get();
+        if (!child->getSchema()->isExpressionInScope(key)) {
+            return op;
+        }
+        op = child;
+    }
+}
+
+bool PlanMapper::appendJoinKeyFilter(LogicalOperator* probeSideRoot, const Expression& probeKey,
+    std::shared_ptr<HashJoinSharedState> sharedState,
+    std::unique_ptr<PhysicalOperator>& probeSidePrevOperator) {
+    auto logicalOperator = getJoinKeyFilterPosition(probeSideRoot, probeKey);
+    auto keyPos = DataPos(logicalOperator->getSchema()->getExpressionPos(probeKey));
+    auto physicalOperator = logicalOpToPhysicalOpMap.at(logicalOperator);
+    if (physicalOperator == probeSidePrevOperator.get()) {
+        probeSidePrevOperator = std::make_unique<JoinKeyFilter>(std::move(sharedState), keyPos,
+            std::move(probeSidePrevOperator), getOperatorID(), probeKey.toString());
+        return true;
+    }
+    // Finds the parent of the physical operator to place the filter under.
+    auto parent = probeSidePrevOperator.get();
+    while (parent->getNumChildren() == 1 && parent->getChild(0) != physicalOperator) {
+        parent = parent->getChild(0);
+    }
+    if (parent->getNumChildren() != 1) {
+        return false;
+    }
+    auto filter = std::make_unique<JoinKeyFilter>(std::move(sharedState), keyPos,
+        parent->moveUnaryChild(), getOperatorID(), probeKey.toString());
+    parent->addChild(std::move(filter));
+    return true;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logicalOperator) {
     auto hashJoin = (LogicalHashJoin*)logicalOperator;
     auto outSchema = hashJoin->getSchema();
@@ -83,10 +132,25 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     auto buildInfo = createHashBuildInfo(*buildSchema, buildKeys, payloads);
     auto globalHashTable = std::make_unique<JoinHashTable>(
         *memoryManager, LogicalType::copy(buildKeyTypes), buildInfo->getTableSchema()->copy());
-    auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    // Only inner joins can spill, since the other join types have to emit unmatched probe tuples
+    // before the spilled partitions are joined.
+    auto canSpill = hashJoin->getJoinType() == JoinType::INNER && memoryManager->canSpill();
+    auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable), canSpill);
     auto hashJoinBuild =
         make_unique<HashJoinBuild>(std::make_unique<ResultSetDescriptor>(buildSchema), sharedState,
             std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(), paramsString);
+    // Joins that pass a semi mask prune the probe side by node ID already, or run the probe side
+    // before the build side. The filter only pays off if most probe tuples don't find a match.
+    if (hashJoin->getJoinType() == JoinType::INNER && probeKeys.size() == 1 &&
+        hashJoin->getSIP() != planner::SidewaysInfoPassing::PROBE_TO_BUILD &&
+        hashJoin->getSIP() != planner::SidewaysInfoPassing::BUILD_TO_PROBE &&
+        hashJoin->getBuildSideCardinality() * PlannerKnobs::BLOOM_FILTER_RATIO <
+            hashJoin->getProbeSideCardinality()) {
+        if (appendJoinKeyFilter(
+                hashJoin->getChild(0).get(), *probeKeys[0], sharedState, probeSidePrevOperator)) {
+            sharedState->enableBloomFilter();
+        }
+    }
     // Create probe
     std::vector<DataPos> probeKeysDataPos;
     for (auto& probeKey : probeKeys) {
@@ -102,6 +166,24 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
         auto markOutputPos = DataPos(outSchema->getExpressionPos(*mark));
         probeDataInfo.markDataPos = markOutputPos;
     }
+    if (canSpill) {
+        auto probeSchema = hashJoin->getChild(0)->getSchema();
+        auto tableSchema = std::make_unique<FactorizedTableSchema>();
+        for (auto& expression : probeSchema->getExpressionsInScope()) {
+            auto pos = DataPos(outSchema->getExpressionPos(*expression));
+            std::unique_ptr<ColumnSchema> columnSchema;
+            if (probeSchema->getGroup(expression)->isFlat()) {
+                columnSchema = std::make_unique<ColumnSchema>(false /* isUnFlat */,
+                    pos.dataChunkPos, LogicalTypeUtils::getRowLayoutSize(expression->dataType));
+            } else {
+                columnSchema = std::make_unique<ColumnSchema>(
+                    true /* isUnFlat */, pos.dataChunkPos, (uint32_t)sizeof(overflow_value_t));
+            }
+            tableSchema->appendColumn(std::move(columnSchema));
+            probeDataInfo.spilledVectorsPos.push_back(pos);
+        }
+        probeDataInfo.spilledTableSchema = std::move(tableSchema);
+    }
     auto hashJoinProbe = make_unique<HashJoinProbe>(sharedState, hashJoin->getJoinType(),
         hashJoin->requireFlatProbeKeys(), probeDataInfo, std::move(probeSidePrevOperator),
         std::move(hashJoinBuild), getOperatorID(), paramsString);
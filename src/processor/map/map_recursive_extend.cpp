@@ -1,4 +1,5 @@
 #include "planner/operator/extend/logical_recursive_extend.h"
+#include "planner/operator/logical_flatten.h"
 #include "processor/operator/recursive_extend/recursive_join.h"
 #include "processor/plan_mapper.h"
 #include "transaction/transaction.h"
@@ -10,13 +11,32 @@ namespace kuzu {
 namespace processor {
 
 static std::shared_ptr<RecursiveJoinSharedState> createSharedState(
-    const binder::NodeExpression& nbrNode, const storage::StorageManager& storageManager) {
+    const binder::NodeExpression& nbrNode, const storage::StorageManager& storageManager,
+    std::unique_ptr<ParallelBFSSharedState> parallelBFSState) {
     std::vector<std::unique_ptr<NodeOffsetSemiMask>> semiMasks;
     for (auto tableID : nbrNode.getTableIDs()) {
         auto nodeTable = storageManager.getNodeTable(tableID);
         semiMasks.push_back(std::make_unique<NodeOffsetSemiMask>(nodeTable));
     }
-    return std::make_shared<RecursiveJoinSharedState>(std::move(semiMasks));
+    return std::make_shared<RecursiveJoinSharedState>(
+        std::move(semiMasks), std::move(parallelBFSState));
+}
+
+// A BFS from a single src node can be extended by all threads if the bound, nbr and intermediate
+// nodes are all from the same node table, whose offsets index the shared visited state. Levels
+// can be extended bottom-up if there is a recursive plan in the opposite direction.
+static std::unique_ptr<ParallelBFSSharedState> createParallelBFSSharedState(
+    const binder::NodeExpression& boundNode, const binder::NodeExpression& nbrNode,
+    const binder::NodeExpression& recursiveNode, uint8_t upperBound, bool canExtendBottomUp) {
+    if (boundNode.isMultiLabeled() || nbrNode.isMultiLabeled() ||
+        recursiveNode.isMultiLabeled()) {
+        return nullptr;
+    }
+    auto tableID = boundNode.getSingleTableID();
+    if (nbrNode.getSingleTableID() != tableID || recursiveNode.getSingleTableID() != tableID) {
+        return nullptr;
+    }
+    return std::make_unique<ParallelBFSSharedState>(tableID, upperBound, canExtendBottomUp);
 }
 
 std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(
@@ -37,13 +57,17 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(
         DataPos(recursivePlanSchema->getExpressionPos(*recursiveInfo->nodeCopy->getInternalID()));
     auto recursiveEdgeIDPos = DataPos(
         recursivePlanSchema->getExpressionPos(*recursiveInfo->rel->getInternalIDProperty()));
+    auto recursiveEdgeWeightPos = DataPos();
+    if (recursiveInfo->weightProperty != nullptr) {
+        recursiveEdgeWeightPos =
+            DataPos(recursivePlanSchema->getExpressionPos(*recursiveInfo->weightProperty));
+    }
     // Generate RecursiveJoin
     auto outSchema = extend->getSchema();
     auto inSchema = extend->getChild(0)->getSchema();
     auto boundNodeIDPos = DataPos(inSchema->getExpressionPos(*boundNode->getInternalID()));
     auto nbrNodeIDPos = DataPos(outSchema->getExpressionPos(*nbrNode->getInternalID()));
     auto lengthPos = DataPos(outSchema->getExpressionPos(*lengthExpression));
-    auto sharedState = createSharedState(*nbrNode, storageManager);
     auto pathPos = DataPos();
     if (extend->getJoinType() == planner::RecursiveJoinType::TRACK_PATH) {
         pathPos = DataPos(outSchema->getExpressionPos(*rel));
@@ -54,13 +78,46 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(
     }
     auto dataInfo = std::make_unique<RecursiveJoinDataInfo>(boundNodeIDPos, nbrNodeIDPos,
         nbrNode->getTableIDsSet(), lengthPos, std::move(recursivePlanResultSetDescriptor),
-        recursiveDstNodeIDPos, recursiveInfo->node->getTableIDsSet(), recursiveEdgeIDPos, pathPos,
-        std::move(tableIDToName));
-    auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
+        recursiveDstNodeIDPos, recursiveInfo->node->getTableIDsSet(), recursiveEdgeIDPos,
+        recursiveEdgeWeightPos, pathPos, std::move(tableIDToName));
+    // Map recursive plan in the opposite direction
+    std::unique_ptr<PhysicalOperator> bwdRecursiveRoot;
+    auto logicalBwdRecursiveRoot = extend->getBwdRecursiveChild();
+    if (logicalBwdRecursiveRoot != nullptr) {
+        bwdRecursiveRoot = mapOperator(logicalBwdRecursiveRoot.get());
+        auto bwdRecursivePlanSchema = logicalBwdRecursiveRoot->getSchema();
+        dataInfo->bwdLocalResultSetDescriptor =
+            std::make_unique<ResultSetDescriptor>(bwdRecursivePlanSchema);
+        dataInfo->bwdRecursiveDstNodeIDPos = DataPos(
+            bwdRecursivePlanSchema->getExpressionPos(*recursiveInfo->nodeCopy->getInternalID()));
+        dataInfo->bwdRecursiveEdgeIDPos = DataPos(bwdRecursivePlanSchema->getExpressionPos(
+            *recursiveInfo->rel->getInternalIDProperty()));
+    }
+    // Shortest path lengths can be computed from many src nodes at once. Instead of flattening the
+    // src nodes one at a time, hand the unflat chunk to the recursive join which batches them into
+    // a multi-source BFS. Variable length and path tracking need per source multiplicities or
+    // backward edges, so they are still computed one src node at a time.
+    auto logicalChild = logicalOperator->getChild(0).get();
+    auto isMultiSource = false;
+    if (rel->getRelType() == common::QueryRelType::SHORTEST &&
+        extend->getJoinType() == planner::RecursiveJoinType::TRACK_NONE &&
+        logicalChild->getOperatorType() == LogicalOperatorType::FLATTEN &&
+        ((LogicalFlatten*)logicalChild)->getGroupPos() ==
+            inSchema->getGroupPos(*boundNode->getInternalID())) {
+        logicalChild = logicalChild->getChild(0).get();
+        isMultiSource = true;
+    }
+    std::unique_ptr<ParallelBFSSharedState> parallelBFSState;
+    if (isMultiSource) {
+        parallelBFSState = createParallelBFSSharedState(*boundNode, *nbrNode,
+            *recursiveInfo->node, rel->getUpperBound(), bwdRecursiveRoot != nullptr);
+    }
+    auto sharedState = createSharedState(*nbrNode, storageManager, std::move(parallelBFSState));
+    auto prevOperator = mapOperator(logicalChild);
     return std::make_unique<RecursiveJoin>(rel->getLowerBound(), rel->getUpperBound(),
-        rel->getRelType(), extend->getJoinType(), sharedState, std::move(dataInfo),
+        rel->getRelType(), extend->getJoinType(), isMultiSource, sharedState, std::move(dataInfo),
         std::move(prevOperator), getOperatorID(), extend->getExpressionsForPrinting(),
-        std::move(recursiveRoot));
+        std::move(recursiveRoot), std::move(bwdRecursiveRoot));
 }
 
 } // namespace processor
@@ -1,3 +1,4 @@
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
 #include "planner/operator/scan/logical_scan_node_property.h"
 #include "processor/operator/scan/scan_multi_node_tables.h"
@@ -11,6 +12,42 @@ using namespace kuzu::planner;
 namespace kuzu {
 namespace processor {
 
+// Converts predicates of the form `property <comparison> literal` into zone map checks.
+static std::vector<storage::ZoneMapCheck> getZoneMapChecks(
+    const expression_vector& predicates, table_id_t tableID, catalog::TableSchema* tableSchema) {
+    std::vector<storage::ZoneMapCheck> checks;
+    for (auto& predicate : predicates) {
+        auto comparison = predicate->expressionType;
+        if (!storage::ZoneMapCheck::isSupportedComparison(comparison)) {
+            continue;
+        }
+        auto left = predicate->getChild(0);
+        auto right = predicate->getChild(1);
+        if (left->expressionType == ExpressionType::LITERAL &&
+            right->expressionType == ExpressionType::PROPERTY) {
+            std::swap(left, right);
+            comparison = storage::ZoneMapCheck::flipComparison(comparison);
+        }
+        if (left->expressionType != ExpressionType::PROPERTY ||
+            right->expressionType != ExpressionType::LITERAL ||
+            left->getDataType() != right->getDataType() ||
+            !storage::ZoneMap::isSupported(left->getDataType().getPhysicalType())) {
+            continue;
+        }
+        auto property = static_pointer_cast<PropertyExpression>(left);
+        auto literal = static_pointer_cast<LiteralExpression>(right);
+        if (!property->hasPropertyID(tableID) || literal->isNull()) {
+            continue;
+        }
+        std::array<uint8_t, storage::ZoneMap::VALUE_SIZE> value{};
+        memcpy(value.data(), &literal->getValue()->val,
+            PhysicalTypeUtils::getFixedTypeSize(left->getDataType().getPhysicalType()));
+        checks.emplace_back(
+            tableSchema->getColumnID(property->getPropertyID(tableID)), comparison, value);
+    }
+    return checks;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeProperty(
     LogicalOperator* logicalOperator) {
     auto& scanProperty = (const LogicalScanNodeProperty&)*logicalOperator;
@@ -55,8 +92,9 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeProperty(
                 columnIDs.push_back(UINT32_MAX);
             }
         }
-        auto info = std::make_unique<ScanNodeTableInfo>(
-            storageManager.getNodeTable(tableID), std::move(columnIDs));
+        auto info = std::make_unique<ScanNodeTableInfo>(storageManager.getNodeTable(tableID),
+            std::move(columnIDs),
+            getZoneMapChecks(scanProperty.getPredicates(), tableID, tableSchema));
         return std::make_unique<ScanSingleNodeTable>(std::move(info), inputNodeIDVectorPos,
             std::move(outVectorsPos), std::move(prevOperator), getOperatorID(),
             scanProperty.getExpressionsForPrinting());
@@ -1,5 +1,11 @@
 #include "processor/plan_mapper.h"
 
+#include "common/constants.h"
+#include "planner/operator/logical_aggregate.h"
+#include "planner/operator/logical_distinct.h"
+#include "planner/operator/logical_hash_join.h"
+#include "planner/operator/logical_intersect.h"
+#include "planner/operator/logical_order_by.h"
 #include "processor/operator/profile.h"
 
 using namespace kuzu::common;
@@ -16,12 +22,112 @@ static void setPhysicalPlanIfProfile(
     }
 }
 
+static uint64_t multiplySaturated(uint64_t a, uint64_t b) {
+    return b != 0 && a > UINT64_MAX / b ? UINT64_MAX : a * b;
+}
+
+static uint64_t addSaturated(uint64_t a, uint64_t b) {
+    return a > UINT64_MAX - b ? UINT64_MAX : a + b;
+}
+
+// Bytes held for a tuple of the given expressions by a hash table, an aggregate or a sort.
+static uint64_t estimateTupleSize(const binder::expression_vector& expressions) {
+    uint64_t tupleSize = QueryAdmissionConstants::TUPLE_OVERHEAD_IN_BYTES;
+    for (auto& expression : expressions) {
+        tupleSize += LogicalTypeUtils::getRowLayoutSize(expression->getDataType());
+    }
+    return tupleSize;
+}
+
+// Estimates the bytes held by the hash join and intersect build sides, group tables and sort
+// buffers of a plan, from the cardinalities the planner estimated for their inputs. Operators that
+// only stream tuples through are not counted.
+static uint64_t estimateMemoryUsage(LogicalOperator* op) {
+    uint64_t numTuples = 0;
+    uint64_t tupleSize = 0;
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::HASH_JOIN: {
+        auto hashJoin = ku_dynamic_cast<LogicalOperator*, LogicalHashJoin*>(op);
+        numTuples = hashJoin->getBuildSideCardinality();
+        tupleSize = estimateTupleSize(hashJoin->getChild(1)->getSchema()->getExpressionsInScope());
+    } break;
+    case LogicalOperatorType::INTERSECT: {
+        auto intersect = ku_dynamic_cast<LogicalOperator*, LogicalIntersect*>(op);
+        numTuples = intersect->getBuildSideCardinality();
+        // Build sides hold pairs of key and nbr node IDs.
+        tupleSize =
+            QueryAdmissionConstants::TUPLE_OVERHEAD_IN_BYTES + 2 * sizeof(common::internalID_t);
+    } break;
+    case LogicalOperatorType::AGGREGATE: {
+        auto aggregate = ku_dynamic_cast<LogicalOperator*, LogicalAggregate*>(op);
+        if (aggregate->hasKeyExpressions()) {
+            numTuples = aggregate->getInputCardinality();
+            tupleSize = estimateTupleSize(aggregate->getSchema()->getExpressionsInScope());
+        }
+    } break;
+    case LogicalOperatorType::DISTINCT: {
+        auto distinct = ku_dynamic_cast<LogicalOperator*, LogicalDistinct*>(op);
+        numTuples = distinct->getInputCardinality();
+        tupleSize = estimateTupleSize(distinct->getAllDistinctExpressions());
+    } break;
+    case LogicalOperatorType::ORDER_BY: {
+        auto orderBy = ku_dynamic_cast<LogicalOperator*, LogicalOrderBy*>(op);
+        numTuples = orderBy->getInputCardinality();
+        if (orderBy->isTopK()) {
+            auto skipNum = orderBy->getSkipNum() == UINT64_MAX ? 0 : orderBy->getSkipNum();
+            numTuples = std::min(numTuples, addSaturated(orderBy->getLimitNum(), skipNum));
+        }
+        tupleSize = estimateTupleSize(orderBy->getChild(0)->getSchema()->getExpressionsInScope());
+    } break;
+    default:
+        break;
+    }
+    auto memoryUsage = multiplySaturated(numTuples, tupleSize);
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        memoryUsage = addSaturated(memoryUsage, estimateMemoryUsage(op->getChild(i).get()));
+    }
+    return memoryUsage;
+}
+
+// The planner estimates cardinalities from the statistics of the scanned tables. Plans reading
+// anything else, e.g. files, UNWIND lists or table functions, or without any input, e.g. DDL, keep
+// the default estimate of a single tuple, and so do the paths of recursive joins.
+static bool hasScanBasedCardinality(LogicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::SCAN_INTERNAL_ID:
+        return true;
+    case LogicalOperatorType::INDEX_SCAN_NODE:
+        // The optimizer replaces the scans of primary key lookups with index scans of a literal.
+        // Index scans of COPY read files instead.
+        return op->getChild(0)->getOperatorType() == LogicalOperatorType::DUMMY_SCAN;
+    case LogicalOperatorType::RECURSIVE_EXTEND:
+    case LogicalOperatorType::UNWIND:
+        return false;
+    default:
+        break;
+    }
+    if (op->getNumChildren() == 0) {
+        return false;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        if (!hasScanBasedCardinality(op->getChild(i).get())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::unique_ptr<PhysicalPlan> PlanMapper::mapLogicalPlanToPhysical(
     LogicalPlan* logicalPlan, const binder::expression_vector& expressionsToCollect) {
     auto lastOperator = mapOperator(logicalPlan->getLastOperator().get());
     lastOperator = createResultCollector(AccumulateType::REGULAR, expressionsToCollect,
         logicalPlan->getSchema(), std::move(lastOperator));
     auto physicalPlan = make_unique<PhysicalPlan>(std::move(lastOperator));
+    physicalPlan->estimatedMemoryUsage = estimateMemoryUsage(logicalPlan->getLastOperator().get());
+    physicalPlan->isShortQuery =
+        hasScanBasedCardinality(logicalPlan->getLastOperator().get()) &&
+        addSaturated(logicalPlan->getCost(), logicalPlan->getCardinality()) <=
+            QueryAdmissionConstants::SHORT_QUERY_MAX_NUM_TUPLES;
     setPhysicalPlanIfProfile(logicalPlan, physicalPlan.get());
     return physicalPlan;
 }
@@ -66,7 +66,22 @@ bool AggregateHashTable::isAggregateValueDistinctForGroupByKeys(
     return false;
 }
 
+void AggregateHashTable::merge(AggregateHashTable& other, uint64_t partitionIdx) {
+    KU_ASSERT(partitionIdx < other.partitionedEntries.size());
+    auto& entries = other.partitionedEntries[partitionIdx];
+    merge(*other.factorizedTable, entries.data(), entries.size());
+}
+
 void AggregateHashTable::merge(AggregateHashTable& other) {
+    std::vector<uint8_t*> entries(other.getNumEntries());
+    for (auto i = 0u; i < entries.size(); i++) {
+        entries[i] = other.getEntry(i);
+    }
+    merge(*other.factorizedTable, entries.data(), entries.size());
+}
+
+void AggregateHashTable::merge(
+    const FactorizedTable& tableToRead, uint8_t** entriesToMerge, uint64_t numEntriesToMerge) {
     std::shared_ptr<DataChunkState> vectorsToScanState = std::make_shared<DataChunkState>();
     std::vector<ValueVector*> vectorsToScan(keyDataTypes.size() + dependentKeyDataTypes.size());
     std::vector<ValueVector*> groupByHashVectors(keyDataTypes.size());
@@ -96,27 +111,39 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
     iota(colIdxesToScan.begin(), colIdxesToScan.end(), 0);
     // Note: we store hash values at the last column of factorizedTable.
     colIdxesToScan.push_back(factorizedTable->getTableSchema()->getNumColumns() - 1);
-    uint64_t startTupleIdx = 0;
-    while (startTupleIdx < other.factorizedTable->getNumTuples()) {
-        auto numTuplesToScan = std::min(
-            other.factorizedTable->getNumTuples() - startTupleIdx, DEFAULT_VECTOR_CAPACITY);
-        other.factorizedTable->scan(vectorsToScan, startTupleIdx, numTuplesToScan, colIdxesToScan);
+    uint64_t startIdx = 0;
+    while (startIdx < numEntriesToMerge) {
+        auto numEntriesToScan = std::min(numEntriesToMerge - startIdx, DEFAULT_VECTOR_CAPACITY);
+        tableToRead.lookup(
+            vectorsToScan, colIdxesToScan, entriesToMerge, startIdx, numEntriesToScan);
+        resizeHashTableIfNecessary(numEntriesToScan);
         findHashSlots(std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors,
             vectorsToScanState.get());
         auto aggregateStateOffset = aggStateColOffsetInFT;
         for (auto& aggregateFunction : aggregateFunctions) {
-            for (auto i = 0u; i < numTuplesToScan; i++) {
+            for (auto i = 0u; i < numEntriesToScan; i++) {
                 aggregateFunction->combineState(
                     hashSlotsToUpdateAggState[i]->entry + aggregateStateOffset,
-                    other.factorizedTable->getTuple(startTupleIdx + i) + aggregateStateOffset,
-                    &memoryManager);
+                    entriesToMerge[startIdx + i] + aggregateStateOffset, &memoryManager);
             }
             aggregateStateOffset += aggregateFunction->getAggregateStateSize();
         }
-        startTupleIdx += numTuplesToScan;
+        startIdx += numEntriesToScan;
     }
 }
 
+void AggregateHashTable::spill() {
+    factorizedTable->spill();
+    hashSlotsBlocks.clear();
+}
+
+std::unique_ptr<AggregateHashTable> AggregateHashTable::createEmptyCopy() const {
+    auto hashTable = std::make_unique<AggregateHashTable>(
+        memoryManager, keyDataTypes, dependentKeyDataTypes, aggregateFunctions, 0);
+    hashTable->partitionedEntries.resize(partitionedEntries.size());
+    return hashTable;
+}
+
 void AggregateHashTable::finalizeAggregateStates() {
     for (auto i = 0u; i < getNumEntries(); ++i) {
         auto entry = getEntry(i);
@@ -353,6 +380,9 @@ void AggregateHashTable::findHashSlots(const std::vector<ValueVector*>& flatKeyV
                 entryIdxesToInitialize[numFTEntriesToUpdate++] = idx;
                 slot->entry = factorizedTable->appendEmptyTuple();
                 slot->hash = hash;
+                if (!partitionedEntries.empty()) {
+                    partitionedEntries[getPartitionIdx(hash)].push_back(slot->entry);
+                }
             } else if (slot->hash == hash) {
                 mayMatchIdxes[numMayMatches++] = idx;
             } else {
@@ -19,6 +19,7 @@ void BaseAggregateScan::writeAggregateResultToVector(
     if (aggregateState->isNull) {
         vector.setNull(pos, true);
     } else {
+        vector.setNull(pos, false);
         aggregateState->moveResultToVector(&vector, pos);
     }
 }
@@ -7,44 +7,214 @@ using namespace kuzu::storage;
 namespace kuzu {
 namespace processor {
 
+bool HashAggregateSharedState::shouldSpill(
+    const AggregateHashTable& localHashTable, MemoryManager& memoryManager, uint64_t numThreads) {
+    if (!memoryManager.canSpill() ||
+        localHashTable.getNumEntries() < HashAggregateConstants::NUM_PARTITIONS *
+                                             HashAggregateConstants::MIN_NUM_ENTRIES_TO_SPILL) {
+        return false;
+    }
+    return localHashTable.getMemoryUsage() >
+               memoryManager.getSpillMemoryLimit() / std::max<uint64_t>(numThreads, 1) ||
+           memoryManager.isOverSpillMemoryLimit();
+}
+
+void HashAggregateSharedState::spill(
+    AggregateHashTable& localHashTable, MemoryManager& memoryManager) {
+    std::unique_lock lck{mtx};
+    setDataTypesIfNecessary(localHashTable);
+    hasSpilled = true;
+    lck.unlock();
+    for (auto partitionIdx = 0u; partitionIdx < HashAggregateConstants::NUM_PARTITIONS;
+         partitionIdx++) {
+        auto numEntries = localHashTable.getPartitionEntries(partitionIdx).size();
+        if (numEntries == 0) {
+            continue;
+        }
+        auto hashTable = std::make_unique<AggregateHashTable>(
+            memoryManager, keyDataTypes, dependentKeyDataTypes, aggregateFunctions, numEntries);
+        hashTable->merge(localHashTable, partitionIdx);
+        hashTable->spill();
+        numSpilledEntries += numEntries;
+        auto& partition = partitions[partitionIdx];
+        std::unique_lock partitionLck{partition.mtx};
+        partition.spilledHashTables.push_back(std::move(hashTable));
+    }
+}
+
 void HashAggregateSharedState::appendAggregateHashTable(
-    std::unique_ptr<AggregateHashTable> aggregateHashTable) {
+    std::unique_ptr<AggregateHashTable> aggregateHashTable, ExecutionContext* context) {
+    if (hasSpilled && context->memoryManager->isOverSpillMemoryLimit()) {
+        spill(*aggregateHashTable, *context->memoryManager);
+        return;
+    }
+    std::vector<AggregateHashTable*> localHashTablesToMerge;
     std::unique_lock lck{mtx};
+    setDataTypesIfNecessary(*aggregateHashTable);
+    // The last appended hash table is left to combineAggregateHashTable(), so that it can be
+    // moved, instead of merged, when there is only one thread.
+    for (auto& localHashTable : localAggregateHashTables) {
+        localHashTablesToMerge.push_back(localHashTable.get());
+    }
     localAggregateHashTables.push_back(std::move(aggregateHashTable));
+    lck.unlock();
+    if (hasSpilled) {
+        return;
+    }
+    // Start from different partitions to avoid contending on the same partition locks.
+    mergeLocalHashTables(localHashTablesToMerge,
+        localHashTablesToMerge.size() % HashAggregateConstants::NUM_PARTITIONS,
+        *context->memoryManager);
 }
 
-void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memoryManager*/) {
+void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& memoryManager) {
+    if (hasSpilled) {
+        return;
+    }
     std::unique_lock lck{mtx};
     if (localAggregateHashTables.size() == 1) {
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
-    } else {
-        auto numEntries = 0u;
-        for (auto& ht : localAggregateHashTables) {
-            numEntries += ht->getNumEntries();
+        partitions[0].hashTable = std::move(localAggregateHashTables[0]);
+        localAggregateHashTables.clear();
+        return;
+    }
+    std::vector<AggregateHashTable*> localHashTablesToMerge;
+    for (auto& localHashTable : localAggregateHashTables) {
+        localHashTablesToMerge.push_back(localHashTable.get());
+    }
+    lck.unlock();
+    mergeLocalHashTables(localHashTablesToMerge, 0 /* startPartitionIdx */, memoryManager);
+}
+
+void HashAggregateSharedState::setDataTypesIfNecessary(const AggregateHashTable& hashTable) {
+    if (keyDataTypes.empty()) {
+        keyDataTypes = hashTable.getKeyDataTypes();
+        dependentKeyDataTypes = hashTable.getDependentKeyDataTypes();
+    }
+}
+
+void HashAggregateSharedState::createPartitionHashTableIfNecessary(
+    Partition& partition, uint64_t numEntries, MemoryManager& memoryManager) {
+    if (partition.hashTable == nullptr) {
+        partition.hashTable = std::make_unique<AggregateHashTable>(
+            memoryManager, keyDataTypes, dependentKeyDataTypes, aggregateFunctions, numEntries);
+    }
+}
+
+void HashAggregateSharedState::mergeLocalHashTables(
+    const std::vector<AggregateHashTable*>& localHashTables, uint64_t startPartitionIdx,
+    MemoryManager& memoryManager) {
+    if (localHashTables.empty()) {
+        return;
+    }
+    for (auto i = 0u; i < HashAggregateConstants::NUM_PARTITIONS; i++) {
+        auto partitionIdx = (startPartitionIdx + i) % HashAggregateConstants::NUM_PARTITIONS;
+        mergeLocalHashTables(
+            localHashTables, partitionIdx, partitions[partitionIdx], memoryManager);
+    }
+}
+
+void HashAggregateSharedState::mergeLocalHashTables(
+    const std::vector<AggregateHashTable*>& localHashTables, uint64_t partitionIdx,
+    Partition& partition, MemoryManager& memoryManager) {
+    std::unique_lock lck{partition.mtx};
+    if (partition.numLocalHashTablesMerged >= localHashTables.size()) {
+        return;
+    }
+    auto numEntries = 0u;
+    for (auto i = partition.numLocalHashTablesMerged; i < localHashTables.size(); i++) {
+        numEntries += localHashTables[i]->getPartitionEntries(partitionIdx).size();
+    }
+    if (numEntries > 0) {
+        createPartitionHashTableIfNecessary(partition, numEntries, memoryManager);
+    }
+    for (; partition.numLocalHashTablesMerged < localHashTables.size();
+         partition.numLocalHashTablesMerged++) {
+        if (numEntries > 0) {
+            partition.hashTable->merge(
+                *localHashTables[partition.numLocalHashTablesMerged], partitionIdx);
         }
-        localAggregateHashTables[0]->resize(nextPowerOfTwo(numEntries));
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
-        for (auto i = 1u; i < localAggregateHashTables.size(); i++) {
-            globalAggregateHashTable->merge(*localAggregateHashTables[i]);
+    }
+}
+
+void HashAggregateSharedState::loadPartition(uint64_t partitionIdx, MemoryManager& memoryManager) {
+    auto& partition = partitions[partitionIdx];
+    if (hasSpilled) {
+        std::vector<AggregateHashTable*> localHashTables;
+        for (auto& localHashTable : localAggregateHashTables) {
+            localHashTables.push_back(localHashTable.get());
         }
+        mergeLocalHashTables(localHashTables, partitionIdx, partition, memoryManager);
+        for (auto& spilledHashTable : partition.spilledHashTables) {
+            spilledHashTable->reload();
+            createPartitionHashTableIfNecessary(partition, 0 /* numEntries */, memoryManager);
+            partition.hashTable->merge(*spilledHashTable);
+            spilledHashTable.reset();
+        }
+        partition.spilledHashTables.clear();
+    }
+    if (partition.hashTable != nullptr) {
+        partition.hashTable->finalizeAggregateStates();
     }
 }
 
-void HashAggregateSharedState::finalizeAggregateHashTable() {
+uint64_t HashAggregateSharedState::getNumTuples() const {
+    uint64_t numTuples = 0;
+    for (auto& partition : partitions) {
+        if (partition.hashTable != nullptr) {
+            numTuples += partition.hashTable->getNumEntries();
+        }
+    }
+    if (hasSpilled) {
+        // Groups that are not merged yet may be counted several times.
+        for (auto& localHashTable : localAggregateHashTables) {
+            numTuples += localHashTable->getNumEntries();
+        }
+        numTuples += numSpilledEntries;
+    }
+    return numTuples;
+}
+
+std::tuple<uint64_t, uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead(
+    MemoryManager& memoryManager) {
     std::unique_lock lck{mtx};
-    globalAggregateHashTable->finalizeAggregateStates();
+    while (true) {
+        for (auto i = 0u; i < HashAggregateConstants::NUM_PARTITIONS; i++) {
+            auto partitionIdx = nextPartitionIdxToRead;
+            auto& partition = partitions[partitionIdx];
+            nextPartitionIdxToRead =
+                (nextPartitionIdxToRead + 1) % HashAggregateConstants::NUM_PARTITIONS;
+            auto hashTable = partition.hashTable.get();
+            if (!partition.isLoaded || hashTable == nullptr ||
+                partition.numEntriesRead >= hashTable->getNumEntries()) {
+                continue;
+            }
+            auto startOffset = partition.numEntriesRead;
+            auto range =
+                std::min(DEFAULT_VECTOR_CAPACITY, hashTable->getNumEntries() - startOffset);
+            partition.numEntriesRead += range;
+            partition.numReaders++;
+            return std::make_tuple(partitionIdx, startOffset, startOffset + range);
+        }
+        if (nextPartitionIdxToLoad == HashAggregateConstants::NUM_PARTITIONS) {
+            return std::make_tuple(UINT64_MAX, 0, 0);
+        }
+        auto partitionIdx = nextPartitionIdxToLoad++;
+        lck.unlock();
+        loadPartition(partitionIdx, memoryManager);
+        lck.lock();
+        partitions[partitionIdx].isLoaded = true;
+    }
 }
 
-std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
+void HashAggregateSharedState::finishReadingRange(uint64_t partitionIdx) {
     std::unique_lock lck{mtx};
-    if (currentOffset >= globalAggregateHashTable->getNumEntries()) {
-        return std::make_pair(currentOffset, currentOffset);
+    auto& partition = partitions[partitionIdx];
+    KU_ASSERT(partition.numReaders > 0);
+    partition.numReaders--;
+    if (hasSpilled && partition.numReaders == 0 &&
+        partition.numEntriesRead == partition.hashTable->getNumEntries()) {
+        partition.hashTable.reset();
     }
-    auto startOffset = currentOffset;
-    auto range = std::min(
-        DEFAULT_VECTOR_CAPACITY, globalAggregateHashTable->getNumEntries() - currentOffset);
-    currentOffset += range;
-    return std::make_pair(startOffset, startOffset + range);
 }
 
 void HashAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
@@ -70,19 +240,33 @@ void HashAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
                                               unFlatKeyVectors[0]->state.get();
     localAggregateHashTable = make_unique<AggregateHashTable>(
         *context->memoryManager, keyDataTypes, payloadDataTypes, aggregateFunctions, 0);
+    localAggregateHashTable->enablePartitioning();
 }
 
 void HashAggregate::executeInternal(ExecutionContext* context) {
     while (children[0]->getNextTuple(context)) {
         localAggregateHashTable->append(flatKeyVectors, unFlatKeyVectors, dependentKeyVectors,
             leadingState, aggregateInputs, resultSet->multiplicity);
+        // The distinct values seen by a local hash table are not spilled with it.
+        if (!containDistinctAggregate() &&
+            HashAggregateSharedState::shouldSpill(
+                *localAggregateHashTable, *context->memoryManager, context->numThreads)) {
+            sharedState->spill(*localAggregateHashTable, *context->memoryManager);
+            localAggregateHashTable = localAggregateHashTable->createEmptyCopy();
+        }
     }
-    sharedState->appendAggregateHashTable(std::move(localAggregateHashTable));
+    sharedState->appendAggregateHashTable(std::move(localAggregateHashTable), context);
 }
 
 void HashAggregate::finalize(ExecutionContext* context) {
     sharedState->combineAggregateHashTable(*context->memoryManager);
-    sharedState->finalizeAggregateHashTable();
+}
+
+std::unordered_map<std::string, std::string> HashAggregate::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"NumSpilledEntries", std::to_string(sharedState->getNumSpilledEntries())});
+    return result;
 }
 
 } // namespace processor
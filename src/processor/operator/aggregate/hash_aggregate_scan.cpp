@@ -15,24 +15,26 @@ void HashAggregateScan::initLocalStateInternal(ResultSet* resultSet, ExecutionCo
     iota(groupByKeyVectorsColIdxes.begin(), groupByKeyVectorsColIdxes.end(), 0);
 }
 
-bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
-    auto [startOffset, endOffset] = sharedState->getNextRangeToRead();
+bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* context) {
+    auto [partitionIdx, startOffset, endOffset] =
+        sharedState->getNextRangeToRead(*context->memoryManager);
     if (startOffset >= endOffset) {
         return false;
     }
+    auto hashTable = sharedState->getPartitionHashTable(partitionIdx);
     auto numRowsToScan = endOffset - startOffset;
-    sharedState->getFactorizedTable()->scan(
-        groupByKeyVectors, startOffset, numRowsToScan, groupByKeyVectorsColIdxes);
+    auto factorizedTable = hashTable->getFactorizedTable();
+    factorizedTable->scan(groupByKeyVectors, startOffset, numRowsToScan, groupByKeyVectorsColIdxes);
     for (auto pos = 0u; pos < numRowsToScan; ++pos) {
-        auto entry = sharedState->getRow(startOffset + pos);
-        auto offset = sharedState->getFactorizedTable()->getTableSchema()->getColOffset(
-            groupByKeyVectors.size());
+        auto entry = hashTable->getEntry(startOffset + pos);
+        auto offset = factorizedTable->getTableSchema()->getColOffset(groupByKeyVectors.size());
         for (auto& vector : aggregateVectors) {
             auto aggState = (AggregateState*)(entry + offset);
             writeAggregateResultToVector(*vector, pos, aggState);
             offset += aggState->getStateSize();
         }
     }
+    sharedState->finishReadingRange(partitionIdx);
     metrics->numOutputTuple.increase(numRowsToScan);
     return true;
 }
@@ -0,0 +1,35 @@
+#include "processor/operator/hash_join/bloom_filter.h"
+
+#include "common/constants.h"
+#include "common/utils.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+BloomFilter::BloomFilter(MemoryManager& memoryManager, uint64_t numKeys) {
+    auto numBlocks = nextPowerOfTwo(std::max<uint64_t>(
+        1, numKeys * HashJoinConstants::BLOOM_FILTER_BITS_PER_KEY / (sizeof(uint64_t) * 8)));
+    numBlocks = std::min(numBlocks, HashJoinConstants::MAX_BLOOM_FILTER_SIZE / sizeof(uint64_t));
+    // Small filters still take a whole buffer, so they may as well use all of its blocks.
+    numBlocks = std::max(numBlocks, (uint64_t)1 << NUM_BLOCKS_PER_BUFFER_LOG2);
+    auto numBuffers = numBlocks >> NUM_BLOCKS_PER_BUFFER_LOG2;
+    for (auto i = 0u; i < numBuffers; i++) {
+        buffers.push_back(memoryManager.allocateBuffer(true /* initializeToZero */));
+    }
+    blockIdxMask = numBlocks - 1;
+}
+
+uint64_t BloomFilter::getBitMask(hash_t hash) {
+    // Sets 4 bits, each picked by 6 of the top 24 bits of the hash.
+    uint64_t bitMask = 0;
+    for (auto i = 0u; i < 4; i++) {
+        bitMask |= (uint64_t)1 << ((hash >> (40 + i * 6)) & 63);
+    }
+    return bitMask;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -11,6 +11,89 @@ void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
     hashTable->merge(localHashTable);
 }
 
+BloomFilter* HashJoinSharedState::createBloomFilterIfNecessary(MemoryManager& memoryManager) {
+    if (!isBloomFilterEnabled || hasSpilled()) {
+        return nullptr;
+    }
+    bloomFilter = std::make_unique<BloomFilter>(memoryManager, hashTable->getNumTuples());
+    return bloomFilter.get();
+}
+
+bool HashJoinSharedState::shouldSpill(MemoryManager& memoryManager) {
+    if (!canSpill) {
+        return false;
+    }
+    if (!isSpilling && memoryManager.isOverSpillMemoryLimit()) {
+        isSpilling = true;
+    }
+    return isSpilling;
+}
+
+void HashJoinSharedState::appendSpilledPartition(
+    uint64_t partitionIdx, std::unique_ptr<JoinHashTable> table) {
+    auto& partition = spilledPartitions[partitionIdx];
+    std::unique_lock lck{partition.mtx};
+    partition.tables.push_back(std::move(table));
+    partition.hasTuples = true;
+}
+
+JoinHashTable* HashJoinSharedState::acquireSpilledPartition(
+    uint64_t partitionIdx, MemoryManager& memoryManager) {
+    auto& partition = spilledPartitions[partitionIdx];
+    std::unique_lock lck{partition.mtx};
+    KU_ASSERT(!partition.tables.empty());
+    auto table = partition.tables[0].get();
+    if (!partition.isInMemory) {
+        // Other partitions are locked one at a time, so the partition may be reloaded by another
+        // probe in the meantime.
+        lck.unlock();
+        spillUnusedPartitionsIfNecessary(partitionIdx, memoryManager);
+        lck.lock();
+    }
+    if (!partition.isInMemory) {
+        table->reload();
+        if (!partition.areHashSlotsBuilt) {
+            for (auto i = 1u; i < partition.tables.size(); i++) {
+                partition.tables[i]->reload();
+                table->merge(*partition.tables[i]);
+            }
+            partition.tables.resize(1);
+            table->allocateHashSlots(table->getNumTuples());
+            table->buildHashSlots();
+            partition.areHashSlotsBuilt = true;
+        }
+        // Only set once the partition is in memory, so that a probe can't get a partition whose
+        // reload failed.
+        partition.isInMemory = true;
+    }
+    partition.numProbes++;
+    return table;
+}
+
+void HashJoinSharedState::releaseSpilledPartition(uint64_t partitionIdx) {
+    auto& partition = spilledPartitions[partitionIdx];
+    std::unique_lock lck{partition.mtx};
+    KU_ASSERT(partition.numProbes > 0);
+    partition.numProbes--;
+}
+
+void HashJoinSharedState::spillUnusedPartitionsIfNecessary(
+    uint64_t partitionIdxToReload, MemoryManager& memoryManager) {
+    for (auto partitionIdx = 0u; partitionIdx < HashJoinConstants::NUM_PARTITIONS &&
+                                 memoryManager.isOverSpillMemoryLimit();
+         partitionIdx++) {
+        if (partitionIdx == partitionIdxToReload) {
+            continue;
+        }
+        auto& partition = spilledPartitions[partitionIdx];
+        std::unique_lock lck{partition.mtx};
+        if (partition.isInMemory && partition.numProbes == 0) {
+            partition.tables[0]->spill();
+            partition.isInMemory = false;
+        }
+    }
+}
+
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     std::vector<std::unique_ptr<LogicalType>> keyTypes;
     for (auto i = 0u; i < info->keysPos.size(); ++i) {
@@ -39,22 +122,62 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
-void HashJoinBuild::finalize(ExecutionContext* /*context*/) {
+void HashJoinBuild::finalize(ExecutionContext* context) {
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
-    sharedState->getHashTable()->buildHashSlots();
+    sharedState->getHashTable()->buildHashSlots(
+        sharedState->createBloomFilterIfNecessary(*context->memoryManager));
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
     // Append thread-local tuples
     while (children[0]->getNextTuple(context)) {
+        if (sharedState->shouldSpill(*context->memoryManager)) {
+            appendVectorsToSpilledPartitions(context);
+            continue;
+        }
         for (auto i = 0u; i < resultSet->multiplicity; ++i) {
             appendVectors();
         }
     }
+    spillPartitions();
     // Merge with global hash table once local tuples are all appended.
     sharedState->mergeLocalHashTable(*hashTable);
 }
 
+void HashJoinBuild::appendVectorsToSpilledPartitions(ExecutionContext* context) {
+    if (partitioner == nullptr) {
+        partitioner = std::make_unique<HashJoinPartitioner>(context->memoryManager);
+    }
+    partitioner->partition(keyVectors, keyState, [&](uint64_t partitionIdx) {
+        auto& table = partitionTables[partitionIdx];
+        if (table == nullptr) {
+            table = hashTable->createEmptyCopy();
+        }
+        for (auto i = 0u; i < resultSet->multiplicity; ++i) {
+            table->appendVectors(keyVectors, payloadVectors, keyState);
+        }
+        if (HashJoinSharedState::shouldSpillPartition(*table->getFactorizedTable())) {
+            spillPartition(partitionIdx);
+        }
+    });
+}
+
+void HashJoinBuild::spillPartition(uint64_t partitionIdx) {
+    auto& table = partitionTables[partitionIdx];
+    if (table != nullptr && table->getNumTuples() > 0) {
+        table->spill();
+        sharedState->appendSpilledPartition(partitionIdx, std::move(table));
+    }
+    table.reset();
+}
+
+void HashJoinBuild::spillPartitions() {
+    for (auto partitionIdx = 0u; partitionIdx < HashJoinConstants::NUM_PARTITIONS;
+         partitionIdx++) {
+        spillPartition(partitionIdx);
+    }
+}
+
 } // namespace processor
 } // namespace kuzu
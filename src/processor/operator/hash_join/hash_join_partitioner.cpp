@@ -0,0 +1,58 @@
+#include "processor/operator/hash_join/hash_join_partitioner.h"
+
+#include "processor/operator/hash_join/join_hash_table.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace processor {
+
+HashJoinPartitioner::HashJoinPartitioner(MemoryManager* memoryManager) {
+    hashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64, memoryManager);
+    tmpHashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64, memoryManager);
+    partitionIdxes = std::make_unique<uint8_t[]>(DEFAULT_VECTOR_CAPACITY);
+    partitionSelVector = std::make_shared<SelectionVector>(DEFAULT_VECTOR_CAPACITY);
+}
+
+void HashJoinPartitioner::partition(const std::vector<ValueVector*>& keyVectors,
+    DataChunkState* keyState, const std::function<void(uint64_t)>& func) {
+    if (!JoinHashTable::discardNullFromKeys(keyVectors)) {
+        return;
+    }
+    JoinHashTable::computeVectorHashes(keyVectors, hashVector.get(), tmpHashVector.get());
+    auto selVector = keyState->selVector;
+    if (selVector->selectedSize == 0) {
+        return;
+    }
+    auto isSinglePartition = true;
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        auto hash = hashVector->getValue<hash_t>(selVector->selectedPositions[i]);
+        partitionIdxes[i] = getPartitionIdx(hash);
+        isSinglePartition &= partitionIdxes[i] == partitionIdxes[0];
+    }
+    if (isSinglePartition) {
+        func(partitionIdxes[0]);
+        return;
+    }
+    auto selectedPositions = partitionSelVector->getSelectedPositionsBuffer();
+    for (auto partitionIdx = 0u; partitionIdx < HashJoinConstants::NUM_PARTITIONS;
+         partitionIdx++) {
+        sel_t numSelected = 0;
+        for (auto i = 0u; i < selVector->selectedSize; i++) {
+            if (partitionIdxes[i] == partitionIdx) {
+                selectedPositions[numSelected++] = selVector->selectedPositions[i];
+            }
+        }
+        if (numSelected == 0) {
+            continue;
+        }
+        partitionSelVector->resetSelectorToValuePosBufferWithSize(numSelected);
+        keyState->selVector = partitionSelVector;
+        func(partitionIdx);
+        keyState->selVector = selVector;
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
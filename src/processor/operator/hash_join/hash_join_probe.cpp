@@ -16,10 +16,11 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     for (auto& dataPos : probeDataInfo.payloadsOutPos) {
         vectorsToReadInto.push_back(resultSet->getValueVector(dataPos).get());
     }
+    hashTable = sharedState->getHashTable();
     // We only need to read nonKeys from the factorizedTable. Key columns are always kept as first k
     // columns in the factorizedTable, so we skip the first k columns.
     KU_ASSERT(probeDataInfo.keysDataPos.size() + probeDataInfo.getNumPayloads() + 1 ==
-              sharedState->getHashTable()->getTableSchema()->getNumColumns());
+              hashTable->getTableSchema()->getNumColumns());
     columnIdxsToReadFrom.resize(probeDataInfo.getNumPayloads());
     iota(
         columnIdxsToReadFrom.begin(), columnIdxsToReadFrom.end(), probeDataInfo.keysDataPos.size());
@@ -27,6 +28,159 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     if (keyVectors.size() > 1) {
         tmpHashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64, context->memoryManager);
     }
+    if (sharedState->hasSpilled()) {
+        KU_ASSERT(joinType == JoinType::INNER && probeDataInfo.spilledTableSchema != nullptr);
+        spillState = std::make_unique<ProbeSpillState>();
+        spillState->partitioner = std::make_unique<HashJoinPartitioner>(context->memoryManager);
+        for (auto& dataPos : probeDataInfo.spilledVectorsPos) {
+            spillState->vectors.push_back(resultSet->getValueVector(dataPos).get());
+        }
+        spillState->colIdxes.resize(spillState->vectors.size());
+        iota(spillState->colIdxes.begin(), spillState->colIdxes.end(), 0);
+        spillState->canScanBatches = true;
+        for (auto i = 0u; i < spillState->vectors.size(); i++) {
+            if (!probeDataInfo.spilledTableSchema->getColumn(i)->isFlat()) {
+                spillState->canScanBatches = false;
+                break;
+            }
+            auto state = spillState->vectors[i]->state.get();
+            if (std::find(spillState->flatStates.begin(), spillState->flatStates.end(), state) ==
+                spillState->flatStates.end()) {
+                spillState->flatStates.push_back(state);
+            }
+        }
+    }
+}
+
+bool HashJoinProbe::getNextProbeTuple(ExecutionContext* context) {
+    if (spillState == nullptr) {
+        return children[0]->getNextTuple(context);
+    }
+    if (!spillState->isJoiningSpilledPartitions) {
+        if (children[0]->getNextTuple(context)) {
+            return true;
+        }
+        spillPartitions();
+        spillState->isJoiningSpilledPartitions = true;
+    }
+    return scanNextSpilledProbeTuple(context);
+}
+
+void HashJoinProbe::appendToSpilledPartitions(ExecutionContext* context) {
+    if (spillState == nullptr || spillState->isJoiningSpilledPartitions) {
+        return;
+    }
+    spillState->partitioner->partition(
+        keyVectors, keyVectors[0]->state.get(), [&](uint64_t partitionIdx) {
+            // Probe tuples can't match any build tuple of an empty partition.
+            if (!sharedState->hasSpilledPartition(partitionIdx)) {
+                return;
+            }
+            auto& table = spillState->tablesToAppend[partitionIdx];
+            if (table == nullptr) {
+                table = std::make_unique<FactorizedTable>(
+                    context->memoryManager, probeDataInfo.spilledTableSchema->copy());
+            }
+            for (auto i = 0u; i < resultSet->multiplicity; i++) {
+                table->append(spillState->vectors);
+            }
+            if (HashJoinSharedState::shouldSpillPartition(*table)) {
+                spillPartition(partitionIdx);
+            }
+        });
+}
+
+void HashJoinProbe::spillPartition(uint64_t partitionIdx) {
+    auto& table = spillState->tablesToAppend[partitionIdx];
+    if (table != nullptr) {
+        table->spill();
+        spillState->spilledTables[partitionIdx].push_back(std::move(table));
+    }
+}
+
+void HashJoinProbe::spillPartitions() {
+    for (auto partitionIdx = 0u; partitionIdx < HashJoinConstants::NUM_PARTITIONS;
+         partitionIdx++) {
+        spillPartition(partitionIdx);
+    }
+}
+
+bool HashJoinProbe::scanNextSpilledProbeTuple(ExecutionContext* context) {
+    auto& state = *spillState;
+    if (state.nextTupleIdxInBatch < state.numTuplesInBatch) {
+        selectSpilledProbeTupleInBatch();
+        resultSet->multiplicity = 1;
+        return true;
+    }
+    while (state.partitionIdx < HashJoinConstants::NUM_PARTITIONS) {
+        auto& tables = state.spilledTables[state.partitionIdx];
+        if (state.tableIdx == tables.size()) {
+            if (!tables.empty()) {
+                sharedState->releaseSpilledPartition(state.partitionIdx);
+            }
+            state.partitionIdx++;
+            state.tableIdx = 0;
+            continue;
+        }
+        auto table = tables[state.tableIdx].get();
+        if (state.tupleIdx == 0) {
+            if (state.tableIdx == 0) {
+                hashTable = sharedState->acquireSpilledPartition(
+                    state.partitionIdx, *context->memoryManager);
+            }
+            table->reload();
+        }
+        if (state.tupleIdx == table->getNumTuples()) {
+            tables[state.tableIdx].reset();
+            state.tableIdx++;
+            state.tupleIdx = 0;
+            continue;
+        }
+        scanSpilledProbeTuples(*table);
+        resultSet->multiplicity = 1;
+        return true;
+    }
+    return false;
+}
+
+void HashJoinProbe::scanSpilledProbeTuples(FactorizedTable& table) {
+    auto& state = *spillState;
+    if (!state.canScanBatches) {
+        for (auto& vector : state.vectors) {
+            if (vector->state->isFlat()) {
+                vector->state->selVector->resetSelectorToUnselectedWithSize(1);
+            } else {
+                vector->state->selVector->resetSelectorToUnselected();
+            }
+        }
+        table.scan(state.vectors, state.tupleIdx++, 1 /* numTuplesToScan */, state.colIdxes);
+        return;
+    }
+    // The rows are read into the flat vectors as if they were unflat, i.e., to positions
+    // [0, numTuplesInBatch).
+    auto numTuplesToScan =
+        std::min(DEFAULT_VECTOR_CAPACITY, table.getNumTuples() - state.tupleIdx);
+    for (auto flatState : state.flatStates) {
+        flatState->setToUnflat();
+        flatState->selVector->resetSelectorToUnselected();
+    }
+    table.scan(state.vectors, state.tupleIdx, numTuplesToScan, state.colIdxes);
+    for (auto flatState : state.flatStates) {
+        flatState->setToFlat();
+    }
+    state.tupleIdx += numTuplesToScan;
+    state.numTuplesInBatch = numTuplesToScan;
+    state.nextTupleIdxInBatch = 0;
+    selectSpilledProbeTupleInBatch();
+}
+
+void HashJoinProbe::selectSpilledProbeTupleInBatch() {
+    auto& state = *spillState;
+    for (auto flatState : state.flatStates) {
+        flatState->selVector->resetSelectorToValuePosBufferWithSize(1);
+        flatState->selVector->getSelectedPositionsBuffer()[0] = state.nextTupleIdxInBatch;
+    }
+    state.nextTupleIdxInBatch++;
 }
 
 bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
@@ -39,14 +193,15 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         // which changes the selected position.
         // TODO(Guodong): we have potential bugs here because all keys' states should be restored.
         restoreSelVector(keyVectors[0]->state->selVector);
-        if (!children[0]->getNextTuple(context)) {
+        if (!getNextProbeTuple(context)) {
             return false;
         }
         saveSelVector(keyVectors[0]->state->selVector);
-        sharedState->getHashTable()->probe(
+        appendToSpilledPartitions(context);
+        hashTable->probe(
             keyVectors, hashVector.get(), tmpHashVector.get(), probeState->probedTuples.get());
     }
-    auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(
+    auto numMatchedTuples = hashTable->matchFlatKeys(
         keyVectors, probeState->probedTuples.get(), probeState->matchedTuples.get());
     probeState->matchedSelVector->selectedSize = numMatchedTuples;
     probeState->nextMatchedTupleIdx = 0;
@@ -57,14 +212,15 @@ bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
     KU_ASSERT(keyVectors.size() == 1);
     auto keyVector = keyVectors[0];
     restoreSelVector(keyVector->state->selVector);
-    if (!children[0]->getNextTuple(context)) {
+    if (!getNextProbeTuple(context)) {
         return false;
     }
     saveSelVector(keyVector->state->selVector);
-    sharedState->getHashTable()->probe(
+    appendToSpilledPartitions(context);
+    hashTable->probe(
         keyVectors, hashVector.get(), tmpHashVector.get(), probeState->probedTuples.get());
     auto numMatchedTuples =
-        sharedState->getHashTable()->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
+        hashTable->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
             probeState->matchedTuples.get(), probeState->matchedSelVector.get());
     probeState->matchedSelVector->selectedSize = numMatchedTuples;
     probeState->nextMatchedTupleIdx = 0;
@@ -76,7 +232,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForFlatKey() {
         return 0;
     }
     auto numTuplesToRead = 1;
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -97,7 +253,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForUnFlatKey() {
         keySelVector->selectedSize = numTuplesToRead;
         keySelVector->resetSelectorToValuePosBuffer();
     }
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -32,7 +32,7 @@ void JoinHashTable::initFunctions() {
     }
 }
 
-static bool discardNullFromKeys(const std::vector<ValueVector*>& vectors) {
+bool JoinHashTable::discardNullFromKeys(const std::vector<ValueVector*>& vectors) {
     bool hasNonNullKeys = true;
     for (auto& vector : vectors) {
         if (!ValueVector::discardNull(*vector)) {
@@ -106,6 +106,11 @@ void JoinHashTable::appendVectorWithSorting(
     factorizedTable->numTuples += numTuplesToAppend;
 }
 
+std::unique_ptr<JoinHashTable> JoinHashTable::createEmptyCopy() const {
+    return std::make_unique<JoinHashTable>(
+        memoryManager, LogicalType::copy(keyTypes), tableSchema->copy());
+}
+
 void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
     setMaxNumHashSlots(nextPowerOfTwo(numTuples * 2));
     auto numSlotsPerBlock = (uint64_t)1 << numSlotsPerBlockLog2;
@@ -115,11 +120,23 @@ void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
     }
 }
 
-void JoinHashTable::buildHashSlots() {
+void JoinHashTable::buildHashSlots(BloomFilter* bloomFilter) {
+    if (maxNumHashSlots > numSlotsPerBlock) {
+        buildHashSlotsByPartition(bloomFilter);
+    } else {
+        buildHashSlotsSequentially(bloomFilter);
+    }
+}
+
+void JoinHashTable::buildHashSlotsSequentially(BloomFilter* bloomFilter) {
     for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
         uint8_t* tuple = tupleBlock->getData();
         for (auto i = 0u; i < tupleBlock->numTuples; i++) {
-            auto lastSlotEntryInHT = insertEntry(tuple);
+            auto hash = computeTupleHash(tuple);
+            if (bloomFilter != nullptr) {
+                bloomFilter->insert(hash);
+            }
+            auto lastSlotEntryInHT = insertEntry(tuple, hash);
             auto prevPtr = getPrevTuple(tuple);
             memcpy(prevPtr, &lastSlotEntryInHT, sizeof(uint8_t*));
             tuple += factorizedTable->getTableSchema()->getNumBytesPerTuple();
@@ -127,6 +144,83 @@ void JoinHashTable::buildHashSlots() {
     }
 }
 
+void JoinHashTable::buildHashSlotsByPartition(BloomFilter* bloomFilter) {
+    static_assert(sizeof(hash_t) == sizeof(uint8_t*));
+    // Blocks of the array that the tuples are scattered into hold this many tuple pointers.
+    constexpr auto numTuplesPerBlockLog2 = BufferPoolConstants::PAGE_256KB_SIZE_LOG2 - 3;
+    constexpr auto tupleIdxInBlockMask = ((uint64_t)1 << numTuplesPerBlockLog2) - 1;
+    auto numPartitions = (maxNumHashSlots + numSlotsPerBlock - 1) >> numSlotsPerBlockLog2;
+    auto numBytesPerTuple = tableSchema->getNumBytesPerTuple();
+    // Counts the tuples of each partition first, so that the tuples can be scattered into a
+    // single array, clustered by partition. The hash of each tuple is only computed here. It is
+    // kept in the prev pointer column of the tuple, until the tuple is inserted into its slot.
+    std::vector<uint64_t> partitionOffsets(numPartitions + 1, 0);
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        auto tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            auto hash = computeTupleHash(tuple);
+            if (bloomFilter != nullptr) {
+                bloomFilter->insert(hash);
+            }
+            memcpy(getPrevTuple(tuple), &hash, sizeof(hash_t));
+            partitionOffsets[(getSlotIdxForHash(hash) >> numSlotsPerBlockLog2) + 1]++;
+            tuple += numBytesPerTuple;
+        }
+    }
+    for (auto partitionIdx = 0u; partitionIdx < numPartitions; partitionIdx++) {
+        partitionOffsets[partitionIdx + 1] += partitionOffsets[partitionIdx];
+    }
+    std::vector<std::unique_ptr<DataBlock>> partitionedTupleBlocks;
+    auto numBlocksNeeded = (getNumTuples() + tupleIdxInBlockMask) >> numTuplesPerBlockLog2;
+    for (auto i = 0u; i < numBlocksNeeded; i++) {
+        partitionedTupleBlocks.push_back(std::make_unique<DataBlock>(&memoryManager));
+    }
+    auto getPartitionedTuple = [&](uint64_t idx) -> uint8_t*& {
+        return ((uint8_t**)partitionedTupleBlocks[idx >> numTuplesPerBlockLog2]
+                    ->getData())[idx & tupleIdxInBlockMask];
+    };
+    auto partitionCursors = partitionOffsets;
+    hash_t hash;
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        auto tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            memcpy(&hash, getPrevTuple(tuple), sizeof(hash_t));
+            auto partitionIdx = getSlotIdxForHash(hash) >> numSlotsPerBlockLog2;
+            getPartitionedTuple(partitionCursors[partitionIdx]++) = tuple;
+            tuple += numBytesPerTuple;
+        }
+    }
+    for (auto i = 0u; i < getNumTuples(); i++) {
+        auto tuple = getPartitionedTuple(i);
+        memcpy(&hash, getPrevTuple(tuple), sizeof(hash_t));
+        auto lastSlotEntryInHT = insertEntry(tuple, hash);
+        memcpy(getPrevTuple(tuple), &lastSlotEntryInHT, sizeof(uint8_t*));
+    }
+}
+
+void JoinHashTable::spill() {
+    factorizedTable->spill();
+    for (auto& block : hashSlotsBlocks) {
+        block->spill();
+    }
+}
+
+void JoinHashTable::reload() {
+    factorizedTable->reload();
+    for (auto& block : hashSlotsBlocks) {
+        block->reload();
+    }
+}
+
+void JoinHashTable::computeVectorHashes(const std::vector<ValueVector*>& keyVectors,
+    ValueVector* hashVector, ValueVector* tmpHashVector) {
+    VectorHashFunction::computeHash(keyVectors[0], hashVector);
+    for (auto i = 1u; i < keyVectors.size(); i++) {
+        VectorHashFunction::computeHash(keyVectors[i], tmpHashVector);
+        VectorHashFunction::combineHash(hashVector, tmpHashVector, hashVector);
+    }
+}
+
 void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector* hashVector,
     ValueVector* tmpHashVector, uint8_t** probedTuples) {
     KU_ASSERT(keyVectors.size() == keyTypes.size());
@@ -136,15 +230,21 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
     if (!discardNullFromKeys(keyVectors)) {
         return;
     }
-    function::VectorHashFunction::computeHash(keyVectors[0], hashVector);
-    for (auto i = 1u; i < keyVectors.size(); i++) {
-        function::VectorHashFunction::computeHash(keyVectors[i], tmpHashVector);
-        function::VectorHashFunction::combineHash(hashVector, tmpHashVector, hashVector);
-    }
-    for (auto i = 0u; i < hashVector->state->selVector->selectedSize; i++) {
-        auto pos = hashVector->state->selVector->selectedPositions[i];
+    computeVectorHashes(keyVectors, hashVector, tmpHashVector);
+    auto selVector = hashVector->state->selVector.get();
+    // probedTuples holds the addresses of the slots until the slots are read.
+    auto slots = (uint8_t***)probedTuples;
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        auto pos = selVector->selectedPositions[i];
         KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
-        probedTuples[i] = getTupleForHash(hashVector->getValue<hash_t>(pos));
+        slots[i] = getHashSlot(hashVector->getValue<hash_t>(pos));
+        prefetchForRead(slots[i]);
+    }
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        probedTuples[i] = *slots[i];
+        if (probedTuples[i]) {
+            prefetchForRead(probedTuples[i]);
+        }
     }
 }
 
@@ -184,7 +284,7 @@ sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTupl
     return numMatchedTuples;
 }
 
-uint8_t** JoinHashTable::findHashSlot(uint8_t* tuple) const {
+hash_t JoinHashTable::computeTupleHash(const uint8_t* tuple) const {
     auto idx = 0u;
     hash_t hash;
     entryHashFunctions[idx++](tuple, hash);
@@ -194,13 +294,11 @@ uint8_t** JoinHashTable::findHashSlot(uint8_t* tuple) const {
         function::CombineHash::operation(hash, tmpHash, hash);
         idx++;
     }
-    auto slotIdx = getSlotIdxForHash(hash);
-    return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
-                       (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
+    return hash;
 }
 
-uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) const {
-    auto slot = findHashSlot(tuple);
+uint8_t* JoinHashTable::insertEntry(uint8_t* tuple, hash_t hash) const {
+    auto slot = getHashSlot(hash);
     auto prevPtr = *slot;
     *slot = tuple;
     return prevPtr;
@@ -0,0 +1,71 @@
+#include "processor/operator/hash_join/join_key_filter.h"
+
+#include "function/hash/vector_hash_functions.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace processor {
+
+void JoinKeyFilter::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    // The build side has been finalized by the time the probe side pipeline starts.
+    bloomFilter = sharedState->getBloomFilter();
+    keyVector = resultSet->getValueVector(keyPos).get();
+    hashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64, context->memoryManager);
+    numFilteredTuples = context->profiler->registerNumericMetric(getNumFilteredTupleMetricKey());
+}
+
+bool JoinKeyFilter::getNextTuplesInternal(ExecutionContext* context) {
+    sel_t numSelectedKeys;
+    do {
+        restoreSelVector(keyVector->state->selVector);
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        if (bloomFilter == nullptr) {
+            numSelectedKeys = keyVector->state->selVector->selectedSize;
+            break;
+        }
+        saveSelVector(keyVector->state->selVector);
+        numSelectedKeys = filterKeys();
+    } while (numSelectedKeys == 0);
+    metrics->numOutputTuple.increase(numSelectedKeys);
+    return true;
+}
+
+sel_t JoinKeyFilter::filterKeys() {
+    auto selVector = keyVector->state->selVector.get();
+    auto numKeys = selVector->selectedSize;
+    VectorHashFunction::computeHash(keyVector, hashVector.get());
+    auto buffer = selVector->getSelectedPositionsBuffer();
+    sel_t numSelectedKeys = 0;
+    for (auto i = 0u; i < numKeys; i++) {
+        auto pos = selVector->selectedPositions[i];
+        buffer[numSelectedKeys] = pos;
+        numSelectedKeys +=
+            !keyVector->isNull(pos) && bloomFilter->mayContain(hashVector->getValue<hash_t>(pos));
+    }
+    selVector->resetSelectorToValuePosBuffer();
+    selVector->selectedSize = numSelectedKeys;
+    numKeysChecked += numKeys;
+    numKeysPassed += numSelectedKeys;
+    numFilteredTuples->increase(numKeys - numSelectedKeys);
+    if (numKeysChecked >= HashJoinConstants::BLOOM_FILTER_NUM_KEYS_TO_SAMPLE &&
+        numKeysPassed > numKeysChecked * HashJoinConstants::BLOOM_FILTER_MAX_PASS_RATIO) {
+        // The filter drops too few keys to pay for checking them.
+        bloomFilter = nullptr;
+    }
+    return numSelectedKeys;
+}
+
+std::unordered_map<std::string, std::string> JoinKeyFilter::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"NumFilteredTuples",
+        std::to_string(profiler.sumAllNumericMetricsWithKey(getNumFilteredTupleMetricKey()))});
+    return result;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "function/hash/hash_functions.h"
+#include "processor/operator/intersect/intersect_kernels.h"
 
 using namespace kuzu::common;
 
@@ -55,26 +56,16 @@ void Intersect::probeHTs() {
 void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
     nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
     KU_ASSERT(lSelVector.selectedSize <= rSelVector.selectedSize);
-    sel_t leftPosition = 0, rightPosition = 0;
-    uint64_t outputValuePosition = 0;
-    while (leftPosition < lSelVector.selectedSize && rightPosition < rSelVector.selectedSize) {
-        auto leftNodeID = leftNodeIDs[leftPosition];
-        auto rightNodeID = rightNodeIDs[rightPosition];
-        if (leftNodeID.offset < rightNodeID.offset) {
-            leftPosition++;
-        } else if (leftNodeID.offset > rightNodeID.offset) {
-            rightPosition++;
-        } else {
-            lSelVector.getSelectedPositionsBuffer()[outputValuePosition] = leftPosition;
-            rSelVector.getSelectedPositionsBuffer()[outputValuePosition] = rightPosition;
-            leftNodeIDs[outputValuePosition] = leftNodeID;
-            leftPosition++;
-            rightPosition++;
-            outputValuePosition++;
-        }
+    auto lPositions = lSelVector.getSelectedPositionsBuffer();
+    auto rPositions = rSelVector.getSelectedPositionsBuffer();
+    auto numMatches = IntersectKernels::intersect(leftNodeIDs, lSelVector.selectedSize,
+        rightNodeIDs, rSelVector.selectedSize, lPositions, rPositions);
+    // Compact the matched left node IDs, which are the output keys.
+    for (auto i = 0u; i < numMatches; i++) {
+        leftNodeIDs[i] = leftNodeIDs[lPositions[i]];
     }
-    lSelVector.resetSelectorToValuePosBufferWithSize(outputValuePosition);
-    rSelVector.resetSelectorToValuePosBufferWithSize(outputValuePosition);
+    lSelVector.resetSelectorToValuePosBufferWithSize(numMatches);
+    rSelVector.resetSelectorToValuePosBufferWithSize(numMatches);
 }
 
 static std::vector<overflow_value_t> fetchListsToIntersectFromTuples(
@@ -88,6 +79,21 @@ static std::vector<overflow_value_t> fetchListsToIntersectFromTuples(
     return listsToIntersect;
 }
 
+// Lists are sorted by offset, so they can only intersect if their offset ranges overlap. This
+// prunes most of the cartesian product between the chunks of large adjacency lists.
+static bool canListsIntersect(const std::vector<overflow_value_t>& lists) {
+    offset_t maxFirstOffset = 0, minLastOffset = INVALID_OFFSET;
+    for (auto& list : lists) {
+        if (list.numElements == 0) {
+            return false;
+        }
+        auto nodeIDs = (nodeID_t*)list.value;
+        maxFirstOffset = std::max(maxFirstOffset, nodeIDs[0].offset);
+        minLastOffset = std::min(minLastOffset, nodeIDs[list.numElements - 1].offset);
+    }
+    return maxFirstOffset <= minLastOffset;
+}
+
 static std::vector<uint32_t> swapSmallestListToFront(std::vector<overflow_value_t>& lists) {
     KU_ASSERT(lists.size() >= 2);
     std::vector<uint32_t> listIdxes(lists.size());
@@ -199,10 +205,14 @@ bool Intersect::getNextTuplesInternal(ExecutionContext* context) {
         }
         auto listsToIntersect =
             fetchListsToIntersectFromTuples(flatTuplesToIntersect, isIntersectListAFlatValue);
-        auto listIdxes = swapSmallestListToFront(listsToIntersect);
-        intersectLists(listsToIntersect);
-        if (outKeyVector->state->selVector->selectedSize != 0) {
-            populatePayloads(flatTuplesToIntersect, listIdxes);
+        if (!canListsIntersect(listsToIntersect)) {
+            outKeyVector->state->selVector->selectedSize = 0;
+        } else {
+            auto listIdxes = swapSmallestListToFront(listsToIntersect);
+            intersectLists(listsToIntersect);
+            if (outKeyVector->state->selVector->selectedSize != 0) {
+                populatePayloads(flatTuplesToIntersect, listIdxes);
+            }
         }
         if (!hasNextTuplesToIntersect()) {
             carryBuildSideIdx = -1u;
@@ -0,0 +1,288 @@
+#include "processor/operator/intersect/intersect_kernels.h"
+
+#include <algorithm>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KUZU_INTERSECT_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+// Advances rightPosition to the first right offset that is not smaller than offset.
+static inline uint64_t skipScalar(
+    const nodeID_t* right, uint64_t rightPosition, uint64_t rightSize, offset_t offset) {
+    while (rightPosition < rightSize && right[rightPosition].offset < offset) {
+        rightPosition++;
+    }
+    return rightPosition;
+}
+
+static inline uint64_t skipGalloping(
+    const nodeID_t* right, uint64_t rightPosition, uint64_t rightSize, offset_t offset) {
+    if (rightPosition >= rightSize || right[rightPosition].offset >= offset) {
+        return rightPosition;
+    }
+    // Double the step until we overshoot, then binary search within the last step.
+    uint64_t step = 1;
+    while (rightPosition + step < rightSize && right[rightPosition + step].offset < offset) {
+        step *= 2;
+    }
+    auto begin = right + rightPosition + step / 2 + 1;
+    auto end = right + std::min(rightPosition + step, rightSize);
+    auto it = std::lower_bound(begin, end, offset,
+        [](const nodeID_t& nodeID, offset_t value) { return nodeID.offset < value; });
+    return it - right;
+}
+
+// Records a match if the right list at rightPosition has offset. Returns the new right position.
+static inline uint64_t matchAt(const nodeID_t* right, uint64_t rightPosition, uint64_t rightSize,
+    offset_t offset, uint64_t leftPosition, sel_t* leftPositions, sel_t* rightPositions,
+    uint64_t& numMatches) {
+    if (rightPosition < rightSize && right[rightPosition].offset == offset) {
+        leftPositions[numMatches] = leftPosition;
+        rightPositions[numMatches] = rightPosition;
+        numMatches++;
+        rightPosition++;
+    }
+    return rightPosition;
+}
+
+uint64_t IntersectKernels::mergeIntersect(const nodeID_t* left, uint64_t leftSize,
+    const nodeID_t* right, uint64_t rightSize, sel_t* leftPositions, sel_t* rightPositions) {
+    uint64_t numMatches = 0, rightPosition = 0;
+    for (auto leftPosition = 0u; leftPosition < leftSize && rightPosition < rightSize;
+         leftPosition++) {
+        auto offset = left[leftPosition].offset;
+        rightPosition = skipScalar(right, rightPosition, rightSize, offset);
+        rightPosition = matchAt(right, rightPosition, rightSize, offset, leftPosition,
+            leftPositions, rightPositions, numMatches);
+    }
+    return numMatches;
+}
+
+uint64_t IntersectKernels::gallopingIntersect(const nodeID_t* left, uint64_t leftSize,
+    const nodeID_t* right, uint64_t rightSize, sel_t* leftPositions, sel_t* rightPositions) {
+    uint64_t numMatches = 0, rightPosition = 0;
+    for (auto leftPosition = 0u; leftPosition < leftSize && rightPosition < rightSize;
+         leftPosition++) {
+        auto offset = left[leftPosition].offset;
+        rightPosition = skipGalloping(right, rightPosition, rightSize, offset);
+        rightPosition = matchAt(right, rightPosition, rightSize, offset, leftPosition,
+            leftPositions, rightPositions, numMatches);
+    }
+    return numMatches;
+}
+
+// The block kernels compare a block of the left list against a block of the right list at once, and
+// then move past the block with the smaller maximum offset, as a merge would do with single
+// elements. For each left element, they remember the first right position with the same offset.
+// A left element is compared against every right block that may contain its offset, so this is the
+// first position of that offset in the right list.
+class BlockMatches {
+public:
+    BlockMatches(const nodeID_t* right, uint64_t rightSize, sel_t* leftPositions,
+        sel_t* rightPositions)
+        : right{right}, rightSize{rightSize}, leftPositions{leftPositions},
+          rightPositions{rightPositions}, numMatches{0}, lastRightPosition{UINT64_MAX} {
+        std::fill(std::begin(firstRightPositions), std::end(firstRightPositions), UINT64_MAX);
+    }
+
+    // Only called if some offsets of the blocks are equal, which is rare, so no need for SIMD here.
+    inline void matchBlocks(const nodeID_t* left, uint64_t leftPosition, uint64_t rightPosition,
+        uint64_t blockSize) {
+        for (auto i = 0u; i < blockSize; i++) {
+            if (firstRightPositions[i] != UINT64_MAX) {
+                continue;
+            }
+            for (auto j = 0u; j < blockSize; j++) {
+                if (left[leftPosition + i].offset == right[rightPosition + j].offset) {
+                    firstRightPositions[i] = rightPosition + j;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Emits the matches of a left block and resets it.
+    inline void emitBlock(const nodeID_t* left, uint64_t leftPosition, uint64_t blockSize) {
+        for (auto i = 0u; i < blockSize; i++) {
+            emit(leftPosition + i, left[leftPosition + i].offset, firstRightPositions[i]);
+            firstRightPositions[i] = UINT64_MAX;
+        }
+    }
+
+    // Matches the left elements after the last emitted block one by one, starting from
+    // rightPosition. The first of them may already have been matched against full right blocks.
+    inline uint64_t finish(const nodeID_t* left, uint64_t leftPosition, uint64_t leftSize,
+        uint64_t rightPosition) {
+        for (auto i = 0u; leftPosition + i < leftSize; i++) {
+            auto offset = left[leftPosition + i].offset;
+            auto firstRightPosition = i < MAX_BLOCK_SIZE ? firstRightPositions[i] : UINT64_MAX;
+            if (firstRightPosition == UINT64_MAX) {
+                rightPosition = skipScalar(right, rightPosition, rightSize, offset);
+                if (rightPosition < rightSize && right[rightPosition].offset == offset) {
+                    firstRightPosition = rightPosition;
+                }
+            }
+            emit(leftPosition + i, offset, firstRightPosition);
+        }
+        return numMatches;
+    }
+
+    static constexpr uint64_t MAX_BLOCK_SIZE = 8;
+
+private:
+    // Equal offsets are matched one to one, so a left element whose offset is the same as that of
+    // the previous match takes the next right position, if it still has the same offset.
+    inline void emit(uint64_t leftPosition, offset_t offset, uint64_t rightPosition) {
+        if (rightPosition == UINT64_MAX) {
+            return;
+        }
+        if (lastRightPosition != UINT64_MAX && rightPosition <= lastRightPosition) {
+            rightPosition = lastRightPosition + 1;
+            if (rightPosition >= rightSize || right[rightPosition].offset != offset) {
+                return;
+            }
+        }
+        leftPositions[numMatches] = leftPosition;
+        rightPositions[numMatches] = rightPosition;
+        numMatches++;
+        lastRightPosition = rightPosition;
+    }
+
+private:
+    const nodeID_t* right;
+    uint64_t rightSize;
+    sel_t* leftPositions;
+    sel_t* rightPositions;
+    uint64_t numMatches;
+    uint64_t lastRightPosition;
+    uint64_t firstRightPositions[MAX_BLOCK_SIZE];
+};
+
+#ifdef KUZU_INTERSECT_X86_KERNELS
+
+__attribute__((target("avx2"))) static inline __m256i loadOffsetsAVX2(const nodeID_t* nodeIDs) {
+    static_assert(sizeof(nodeID_t) == 2 * sizeof(offset_t));
+    auto ptr = (const __m256i*)nodeIDs;
+    // Pick the offsets out of 4 (offset, tableID) pairs. Their order does not matter.
+    return _mm256_unpacklo_epi64(_mm256_loadu_si256(ptr), _mm256_loadu_si256(ptr + 1));
+}
+
+__attribute__((target("avx2"))) static uint64_t avx2Intersect(const nodeID_t* left,
+    uint64_t leftSize, const nodeID_t* right, uint64_t rightSize, sel_t* leftPositions,
+    sel_t* rightPositions) {
+    BlockMatches matches{right, rightSize, leftPositions, rightPositions};
+    uint64_t leftPosition = 0, rightPosition = 0;
+    while (leftPosition + 4 <= leftSize && rightPosition + 4 <= rightSize) {
+        auto leftOffsets = loadOffsetsAVX2(left + leftPosition);
+        auto rightOffsets = loadOffsetsAVX2(right + rightPosition);
+        // Compare all pairs of offsets by rotating the right block.
+        auto isEqual = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi64(leftOffsets, rightOffsets),
+                _mm256_cmpeq_epi64(leftOffsets, _mm256_permute4x64_epi64(rightOffsets, 0x39))),
+            _mm256_or_si256(
+                _mm256_cmpeq_epi64(leftOffsets, _mm256_permute4x64_epi64(rightOffsets, 0x4e)),
+                _mm256_cmpeq_epi64(leftOffsets, _mm256_permute4x64_epi64(rightOffsets, 0x93))));
+        if (!_mm256_testz_si256(isEqual, isEqual)) {
+            matches.matchBlocks(left, leftPosition, rightPosition, 4);
+        }
+        if (left[leftPosition + 3].offset <= right[rightPosition + 3].offset) {
+            matches.emitBlock(left, leftPosition, 4);
+            leftPosition += 4;
+        } else {
+            rightPosition += 4;
+        }
+    }
+    return matches.finish(left, leftPosition, leftSize, rightPosition);
+}
+
+__attribute__((target("avx512f"))) static inline __m512i loadOffsetsAVX512(
+    const nodeID_t* nodeIDs) {
+    auto ptr = (const uint8_t*)nodeIDs;
+    // Pick the offsets out of 8 (offset, tableID) pairs. Their order does not matter.
+    return _mm512_unpacklo_epi64(_mm512_loadu_si512(ptr), _mm512_loadu_si512(ptr + 64));
+}
+
+__attribute__((target("avx512f"))) static uint64_t avx512Intersect(const nodeID_t* left,
+    uint64_t leftSize, const nodeID_t* right, uint64_t rightSize, sel_t* leftPositions,
+    sel_t* rightPositions) {
+    BlockMatches matches{right, rightSize, leftPositions, rightPositions};
+    uint64_t leftPosition = 0, rightPosition = 0;
+    while (leftPosition + 8 <= leftSize && rightPosition + 8 <= rightSize) {
+        auto leftOffsets = loadOffsetsAVX512(left + leftPosition);
+        auto rightOffsets = loadOffsetsAVX512(right + rightPosition);
+        // Compare all pairs of offsets by rotating the right block.
+        __mmask8 isEqual = _mm512_cmpeq_epu64_mask(leftOffsets, rightOffsets);
+        isEqual |= _mm512_cmpeq_epu64_mask(
+            leftOffsets, _mm512_alignr_epi64(rightOffsets, rightOffsets, 1));
+        isEqual |= _mm512_cmpeq_epu64_mask(
+            leftOffsets, _mm512_alignr_epi64(rightOffsets, rightOffsets, 2));
+        isEqual |= _mm512_cmpeq_epu64_mask(
+            leftOffsets, _mm512_alignr_epi64(rightOffsets, rightOffsets, 3));
+        isEqual |= _mm512_cmpeq_epu64_mask(
+            leftOffsets, _mm512_alignr_epi64(rightOffsets, rightOffsets, 4));
+        isEqual |= _mm512_cmpeq_epu64_mask(
+            leftOffsets, _mm512_alignr_epi64(rightOffsets, rightOffsets, 5));
+        isEqual |= _mm512_cmpeq_epu64_mask(
+            leftOffsets, _mm512_alignr_epi64(rightOffsets, rightOffsets, 6));
+        isEqual |= _mm512_cmpeq_epu64_mask(
+            leftOffsets, _mm512_alignr_epi64(rightOffsets, rightOffsets, 7));
+        if (isEqual) {
+            matches.matchBlocks(left, leftPosition, rightPosition, 8);
+        }
+        if (left[leftPosition + 7].offset <= right[rightPosition + 7].offset) {
+            matches.emitBlock(left, leftPosition, 8);
+            leftPosition += 8;
+        } else {
+            rightPosition += 8;
+        }
+    }
+    return matches.finish(left, leftPosition, leftSize, rightPosition);
+}
+
+IntersectKernels::intersect_func_t IntersectKernels::getAVX2Kernel() {
+    return __builtin_cpu_supports("avx2") ? avx2Intersect : nullptr;
+}
+
+IntersectKernels::intersect_func_t IntersectKernels::getAVX512Kernel() {
+    return __builtin_cpu_supports("avx512f") ? avx512Intersect : nullptr;
+}
+
+#else
+
+IntersectKernels::intersect_func_t IntersectKernels::getAVX2Kernel() {
+    return nullptr;
+}
+
+IntersectKernels::intersect_func_t IntersectKernels::getAVX512Kernel() {
+    return nullptr;
+}
+
+#endif
+
+static IntersectKernels::intersect_func_t getBlockKernel() {
+    if (auto kernel = IntersectKernels::getAVX512Kernel()) {
+        return kernel;
+    }
+    if (auto kernel = IntersectKernels::getAVX2Kernel()) {
+        return kernel;
+    }
+    return IntersectKernels::mergeIntersect;
+}
+
+uint64_t IntersectKernels::intersect(const nodeID_t* left, uint64_t leftSize,
+    const nodeID_t* right, uint64_t rightSize, sel_t* leftPositions, sel_t* rightPositions) {
+    if (rightSize >= GALLOPING_SIZE_RATIO * leftSize) {
+        return gallopingIntersect(left, leftSize, right, rightSize, leftPositions, rightPositions);
+    }
+    static const auto blockKernel = getBlockKernel();
+    return blockKernel(left, leftSize, right, rightSize, leftPositions, rightPositions);
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -27,7 +27,7 @@ void CopyNodeSharedState::init(ExecutionContext* context) {
                 reinterpret_cast<function::ScanSharedState*>(readerSharedState->sharedState.get());
             numRows = scanSharedState->numRows;
         } else {
-            numRows = distinctSharedState->getFactorizedTable()->getNumTuples();
+            numRows = distinctSharedState->getNumTuples();
         }
         pkIndex->bulkReserve(numRows);
         globalIndexBuilder = IndexBuilder(std::make_shared<IndexBuilderSharedState>(pkIndex.get()));
@@ -69,6 +69,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "INTERSECT";
     case PhysicalOperatorType::INSTALL_EXTENSION:
         return "INSTALL_EXTENSION";
+    case PhysicalOperatorType::JOIN_KEY_FILTER:
+        return "JOIN_KEY_FILTER";
     case PhysicalOperatorType::LIMIT:
         return "LIMIT";
     case PhysicalOperatorType::LOAD_EXTENSION:
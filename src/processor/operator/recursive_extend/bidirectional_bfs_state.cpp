@@ -0,0 +1,115 @@
+#include "processor/operator/recursive_extend/bidirectional_bfs_state.h"
+
+#include <algorithm>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void BidirectionalBFSState::Side::reset(nodeID_t nodeID) {
+    parents.clear();
+    parents.emplace(
+        nodeID, Parent{nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID}, relID_t{INVALID_OFFSET, 0}});
+    frontier.clear();
+    frontier.push_back(nodeID);
+    nextFrontier.clear();
+    level = 0;
+}
+
+void BidirectionalBFSState::resetState() {
+    BaseBFSState::resetState();
+    isForward = true;
+    isFinalized = false;
+    pathLength = 0;
+}
+
+void BidirectionalBFSState::markSrc(nodeID_t nodeID) {
+    currentFrontier->addNodeWithMultiplicity(nodeID, 1);
+    fwdSide.reset(nodeID);
+    bwdSide.reset(dstNodeID);
+    // Like a forward shortest path BFS, a path back to the src node is never output.
+    isFinalized = nodeID == dstNodeID || upperBound == 0;
+}
+
+nodeID_t BidirectionalBFSState::getNextNodeID() {
+    auto& side = getExtendingSide();
+    if (nextNodeIdxToExtend == side.frontier.size()) {
+        return nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+    }
+    return side.frontier[nextNodeIdxToExtend++];
+}
+
+void BidirectionalBFSState::markVisited(
+    nodeID_t boundNodeID, nodeID_t nbrNodeID, relID_t relID, uint64_t /*multiplicity*/) {
+    if (isFinalized) {
+        return; // Rest of the rels scanned from the bound node after the sides met.
+    }
+    auto& side = getExtendingSide();
+    if (!side.parents.emplace(nbrNodeID, Parent{boundNodeID, relID}).second) {
+        return;
+    }
+    if (getOtherSide().parents.contains(nbrNodeID)) {
+        populateFrontiers(nbrNodeID);
+        isFinalized = true;
+        return;
+    }
+    side.nextFrontier.push_back(nbrNodeID);
+}
+
+void BidirectionalBFSState::finalizeCurrentLevel() {
+    auto& side = getExtendingSide();
+    side.frontier.swap(side.nextFrontier);
+    side.nextFrontier.clear();
+    side.level++;
+    currentLevel++;
+    nextNodeIdxToExtend = 0;
+    if (side.frontier.empty() || fwdSide.level + bwdSide.level == upperBound) {
+        isFinalized = true;
+        return;
+    }
+    isForward = fwdSide.frontier.size() <= bwdSide.frontier.size();
+    auto& nextSide = getExtendingSide();
+    std::sort(nextSide.frontier.begin(), nextSide.frontier.end());
+}
+
+void BidirectionalBFSState::populateFrontiers(nodeID_t meetNodeID) {
+    // Nodes of the path in order, where relIDs[i] connects nodeIDs[i] and nodeIDs[i + 1].
+    std::vector<nodeID_t> nodeIDs;
+    std::vector<relID_t> relIDs;
+    for (auto nodeID = meetNodeID;;) {
+        nodeIDs.push_back(nodeID);
+        auto& parent = fwdSide.parents.at(nodeID);
+        if (parent.nodeID.offset == INVALID_OFFSET) {
+            break;
+        }
+        relIDs.push_back(parent.relID);
+        nodeID = parent.nodeID;
+    }
+    std::reverse(nodeIDs.begin(), nodeIDs.end());
+    std::reverse(relIDs.begin(), relIDs.end());
+    for (auto nodeID = meetNodeID;;) {
+        auto& parent = bwdSide.parents.at(nodeID);
+        if (parent.nodeID.offset == INVALID_OFFSET) {
+            break;
+        }
+        relIDs.push_back(parent.relID);
+        nodeIDs.push_back(parent.nodeID);
+        nodeID = parent.nodeID;
+    }
+    pathLength = relIDs.size();
+    KU_ASSERT(pathLength <= upperBound && nodeIDs.back() == dstNodeID);
+    while (frontiers.size() <= pathLength) {
+        addNextFrontier();
+    }
+    if (!trackPath) {
+        frontiers[pathLength]->addNodeWithMultiplicity(dstNodeID, 1);
+        return;
+    }
+    for (auto i = 1u; i <= pathLength; ++i) {
+        frontiers[i]->addEdge(nodeIDs[i - 1], nodeIDs[i], relIDs[i - 1]);
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -59,8 +59,8 @@ void PathScanner::scanFromDstOffset(RecursiveJoinVectors* vectors, sel_t& vector
     while (!nbrsStack.empty()) {
         auto& cursor = cursorStack.top();
         cursor++;
-        if ((uint64_t)cursor < nbrsStack.top()->size()) { // Found a new nbr
-            auto& nbr = nbrsStack.top()->at(cursor);
+        if ((uint64_t)cursor < nbrsStack.top().size()) { // Found a new nbr
+            auto& nbr = nbrsStack.top()[cursor];
             nodeIDs[level] = nbr.first;
             relIDs[level] = nbr.second;
             if (level == 0) { // Found a new nbr at level 0. Found a new path.
@@ -72,7 +72,7 @@ void PathScanner::scanFromDstOffset(RecursiveJoinVectors* vectors, sel_t& vector
             }
             // Push new stack.
             cursorStack.push(-1);
-            nbrsStack.push(&frontiers[level]->bwdEdges.at(nbr.first));
+            nbrsStack.push(frontiers[level]->getBwdEdges(nbr.first));
             level--;
         } else { // Failed to find a nbr. Pop stack.
             cursorStack.pop();
@@ -92,10 +92,10 @@ void PathScanner::initDfs(const frontier::node_rel_id_t& nodeAndRelID, size_t cu
         cursorStack.top() = -1;
         return;
     }
-    auto nbrs = &frontiers[currentDepth]->bwdEdges.at(nodeAndRelID.first);
+    auto nbrs = frontiers[currentDepth]->getBwdEdges(nodeAndRelID.first);
     nbrsStack.push(nbrs);
     cursorStack.push(0);
-    initDfs(nbrs->at(0), currentDepth - 1);
+    initDfs(nbrs[0], currentDepth - 1);
 }
 
 void PathScanner::writePathToVector(RecursiveJoinVectors* vectors, sel_t& vectorPos,
@@ -131,11 +131,10 @@ void PathScanner::writePathToVector(RecursiveJoinVectors* vectors, sel_t& vector
 
 void DstNodeWithMultiplicityScanner::scanFromDstOffset(RecursiveJoinVectors* vectors,
     sel_t& vectorPos, sel_t& /*nodeIDDataVectorPos*/, sel_t& /*relIDDataVectorPos*/) {
-    auto& multiplicity = frontiers[k]->nodeIDToMultiplicity.at(currentDstNodeID);
-    while (multiplicity > 0 && vectorPos < DEFAULT_VECTOR_CAPACITY) {
+    while (multiplicityToScan > 0 && vectorPos < DEFAULT_VECTOR_CAPACITY) {
         writeDstNodeOffsetAndLength(vectors->dstNodeIDVector, vectors->pathLengthVector, vectorPos);
         vectorPos++;
-        multiplicity--;
+        multiplicityToScan--;
     }
 }
 
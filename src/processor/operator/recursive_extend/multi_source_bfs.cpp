@@ -0,0 +1,106 @@
+#include "processor/operator/recursive_extend/multi_source_bfs.h"
+
+#include <bit>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void MultiSourceBFSState::resetState() {
+    currentLevel = 0;
+    nextNodeIdxToExtend = 0;
+    currentSourceMask = 0;
+    completedSourceMask = 0;
+    currentFrontier.clear();
+    nextFrontier.clear();
+    nodeIDToIdx.clear();
+    nodeIDs.clear();
+    seen.clear();
+    currentVisit.clear();
+    nextVisit.clear();
+    visitedNodesPerSource.clear();
+    numVisitedDstNodesPerSource.clear();
+}
+
+void MultiSourceBFSState::markSrc(nodeID_t nodeID) {
+    KU_ASSERT(getNumSources() < MAX_NUM_SOURCES);
+    auto sourceMask = (uint64_t)1 << getNumSources();
+    visitedNodesPerSource.emplace_back();
+    numVisitedDstNodesPerSource.push_back(0);
+    auto nodeIdx = getOrInsertNodeIdx(nodeID);
+    if (currentVisit[nodeIdx] == 0) {
+        currentFrontier.push_back(nodeIdx);
+    }
+    currentVisit[nodeIdx] |= sourceMask;
+    markNodeVisitedBySources(nodeIdx, sourceMask, 0 /* level */);
+}
+
+nodeID_t MultiSourceBFSState::getNextNodeID() {
+    while (nextNodeIdxToExtend < currentFrontier.size()) {
+        auto nodeIdx = currentFrontier[nextNodeIdxToExtend++];
+        currentSourceMask = currentVisit[nodeIdx] & ~completedSourceMask;
+        if (currentSourceMask != 0) {
+            return nodeIDs[nodeIdx];
+        }
+    }
+    return nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+}
+
+void MultiSourceBFSState::markVisited(nodeID_t nbrNodeID) {
+    auto nodeIdx = getOrInsertNodeIdx(nbrNodeID);
+    auto newSourceMask = currentSourceMask & ~seen[nodeIdx];
+    if (newSourceMask == 0) {
+        return;
+    }
+    if (nextVisit[nodeIdx] == 0) {
+        nextFrontier.push_back(nodeIdx);
+    }
+    nextVisit[nodeIdx] |= newSourceMask;
+    markNodeVisitedBySources(nodeIdx, newSourceMask, currentLevel + 1);
+}
+
+void MultiSourceBFSState::finalizeCurrentLevel() {
+    for (auto nodeIdx : currentFrontier) {
+        currentVisit[nodeIdx] = 0;
+    }
+    currentVisit.swap(nextVisit);
+    currentFrontier.swap(nextFrontier);
+    nextFrontier.clear();
+    currentLevel++;
+    nextNodeIdxToExtend = 0;
+    if (currentLevel < upperBound) { // No need to sort if we are not extending further.
+        std::sort(currentFrontier.begin(), currentFrontier.end(),
+            [&](uint32_t left, uint32_t right) { return nodeIDs[left] < nodeIDs[right]; });
+    }
+}
+
+uint32_t MultiSourceBFSState::getOrInsertNodeIdx(nodeID_t nodeID) {
+    auto [iter, inserted] = nodeIDToIdx.emplace(nodeID, nodeIDs.size());
+    if (inserted) {
+        nodeIDs.push_back(nodeID);
+        seen.push_back(0);
+        currentVisit.push_back(0);
+        nextVisit.push_back(0);
+    }
+    return iter->second;
+}
+
+void MultiSourceBFSState::markNodeVisitedBySources(
+    uint32_t nodeIdx, uint64_t sourceMask, uint8_t level) {
+    seen[nodeIdx] |= sourceMask;
+    auto nodeID = nodeIDs[nodeIdx];
+    auto isTarget = targetDstNodes->contains(nodeID);
+    while (sourceMask != 0) {
+        auto sourceIdx = std::countr_zero(sourceMask);
+        sourceMask &= sourceMask - 1;
+        visitedNodesPerSource[sourceIdx].push_back(VisitedNode{nodeID, level});
+        if (isTarget &&
+            ++numVisitedDstNodesPerSource[sourceIdx] == targetDstNodes->getNumNodes()) {
+            completedSourceMask |= (uint64_t)1 << sourceIdx;
+        }
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,150 @@
+#include "processor/operator/recursive_extend/parallel_bfs.h"
+
+#include <algorithm>
+
+#include "common/assert.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void ParallelBFSSharedState::beginFetchingSrcNodes() {
+    std::unique_lock lck{mtx};
+    numThreadsFetchingSrcNodes++;
+}
+
+void ParallelBFSSharedState::endFetchingSrcNodes() {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(numThreadsFetchingSrcNodes > 0);
+    numThreadsFetchingSrcNodes--;
+    cv.notify_all();
+}
+
+bool ParallelBFSSharedState::tryStart(
+    offset_t srcOffset, offset_t maxNodeOffset, bool isSrcTarget, uint64_t numTargetNodes_) {
+    std::unique_lock lck{mtx};
+    if (isInUse) {
+        return false;
+    }
+    isInUse = true;
+    auto numWords = (maxNodeOffset >> 6) + 1;
+    if (numWords > numBitmapWords) {
+        // Bits of visited nodes are cleared on release, so the bitmap only needs to be
+        // zero-initialized when it grows.
+        visitedBitmap = std::make_unique<std::atomic<uint64_t>[]>(numWords);
+        numBitmapWords = numWords;
+        levels.resize(numWords << 6);
+        if (canExtendBottomUp) {
+            frontierBitmap.resize(numWords);
+        }
+    }
+    numNodes = maxNodeOffset + 1;
+    markVisited(srcOffset, 0 /* level */);
+    visitedNodeOffsets.push_back(srcOffset);
+    currentFrontier.push_back(srcOffset);
+    isBottomUp = false;
+    currentLevel = 0;
+    nextMorselIdx = 0;
+    numActiveMorsels = 0;
+    numTargetNodes = numTargetNodes_;
+    numVisitedDstNodes = isSrcTarget ? 1 : 0;
+    numBFSs++;
+    updateIsExtending();
+    cv.notify_all();
+    return true;
+}
+
+bool ParallelBFSSharedState::getOwnerMorsel(ParallelBFSMorsel& morsel) {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return hasMorsel() || !isExtending; });
+    if (!isExtending) {
+        return false;
+    }
+    takeMorsel(morsel);
+    return true;
+}
+
+void ParallelBFSSharedState::release() {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(numActiveMorsels == 0);
+    // Every set bit belongs to a node visited by this BFS, so whole words can be cleared.
+    for (auto offset : visitedNodeOffsets) {
+        visitedBitmap[offset >> 6].store(0, std::memory_order_relaxed);
+    }
+    visitedNodeOffsets.clear();
+    currentFrontier.clear();
+    nextFrontier.clear();
+    isInUse = false;
+}
+
+bool ParallelBFSSharedState::getHelperMorsel(ParallelBFSMorsel& morsel) {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return hasMorsel() || (!isExtending && numThreadsFetchingSrcNodes == 0); });
+    if (!hasMorsel()) {
+        return false;
+    }
+    takeMorsel(morsel);
+    return true;
+}
+
+void ParallelBFSSharedState::finishMorsel(
+    const std::vector<offset_t>& nextFrontierNodes, uint64_t numVisitedDstNodesInMorsel) {
+    std::unique_lock lck{mtx};
+    nextFrontier.insert(nextFrontier.end(), nextFrontierNodes.begin(), nextFrontierNodes.end());
+    numVisitedDstNodes += numVisitedDstNodesInMorsel;
+    KU_ASSERT(numActiveMorsels > 0);
+    numActiveMorsels--;
+    if (isExtending && numActiveMorsels == 0 && nextMorselIdx == getNumMorselUnits()) {
+        finalizeCurrentLevel();
+        cv.notify_all();
+    }
+}
+
+void ParallelBFSSharedState::abort() {
+    std::unique_lock lck{mtx};
+    isExtending = false;
+    cv.notify_all();
+}
+
+void ParallelBFSSharedState::takeMorsel(ParallelBFSMorsel& morsel) {
+    morsel.startIdx = nextMorselIdx;
+    morsel.endIdx = std::min(
+        nextMorselIdx + (isBottomUp ? BOTTOM_UP_MORSEL_SIZE : MORSEL_SIZE), getNumMorselUnits());
+    morsel.level = currentLevel;
+    morsel.isBottomUp = isBottomUp;
+    nextMorselIdx = morsel.endIdx;
+    numActiveMorsels++;
+}
+
+void ParallelBFSSharedState::finalizeCurrentLevel() {
+    currentFrontier.swap(nextFrontier);
+    nextFrontier.clear();
+    visitedNodeOffsets.insert(
+        visitedNodeOffsets.end(), currentFrontier.begin(), currentFrontier.end());
+    currentLevel++;
+    nextMorselIdx = 0;
+    updateIsExtending();
+    if (!isExtending) {
+        return;
+    }
+    isBottomUp =
+        canExtendBottomUp && currentFrontier.size() > numNodes - visitedNodeOffsets.size();
+    if (isBottomUp) {
+        std::fill(frontierBitmap.begin(), frontierBitmap.end(), 0);
+        for (auto offset : currentFrontier) {
+            frontierBitmap[offset >> 6] |= (uint64_t)1 << (offset & 63);
+        }
+        numBottomUpLevels++;
+    } else {
+        std::sort(currentFrontier.begin(), currentFrontier.end());
+    }
+}
+
+void ParallelBFSSharedState::updateIsExtending() {
+    isExtending = !currentFrontier.empty() && currentLevel != upperBound &&
+                  numVisitedDstNodes != numTargetNodes;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,9 +1,14 @@
 #include "processor/operator/recursive_extend/recursive_join.h"
 
+#include "common/cast.h"
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
 #include "processor/operator/recursive_extend/all_shortest_path_state.h"
+#include "processor/operator/recursive_extend/bidirectional_bfs_state.h"
 #include "processor/operator/recursive_extend/scan_frontier.h"
 #include "processor/operator/recursive_extend/shortest_path_state.h"
 #include "processor/operator/recursive_extend/variable_length_state.h"
+#include "processor/operator/recursive_extend/weighted_shortest_path_state.h"
 
 using namespace kuzu::common;
 
@@ -12,6 +17,9 @@ namespace processor {
 
 void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionContext* context) {
     populateTargetDstNodes();
+    // A shortest path to a single dst node is searched from both ends if the planner provided a
+    // recursive plan in the opposite direction.
+    isBidirectional = bwdRecursiveRoot != nullptr && targetDstNodes->getNodeIDs().size() == 1;
     vectors = std::make_unique<RecursiveJoinVectors>();
     vectors->srcNodeIDVector = resultSet->getValueVector(dataInfo->srcNodePos).get();
     vectors->dstNodeIDVector = resultSet->getValueVector(dataInfo->dstNodePos).get();
@@ -45,16 +53,34 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
         switch (joinType) {
         case planner::RecursiveJoinType::TRACK_PATH: {
             vectors->pathVector = resultSet->getValueVector(dataInfo->pathPos).get();
-            bfsState = std::make_unique<ShortestPathState<true /* TRACK_PATH */>>(
-                upperBound, targetDstNodes.get());
+            if (isBidirectional) {
+                bfsState = std::make_unique<BidirectionalBFSState>(upperBound,
+                    targetDstNodes.get(), *targetDstNodes->getNodeIDs().begin(),
+                    true /* trackPath */);
+            } else {
+                auto shortestPathState =
+                    std::make_unique<ShortestPathState<true /* TRACK_PATH */>>(
+                        upperBound, targetDstNodes.get());
+                enableDenseFrontiers(shortestPathState.get());
+                bfsState = std::move(shortestPathState);
+            }
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(std::make_unique<PathScanner>(
                     targetDstNodes.get(), i, dataInfo->tableIDToName));
             }
         } break;
         case planner::RecursiveJoinType::TRACK_NONE: {
-            bfsState = std::make_unique<ShortestPathState<false /* TRACK_PATH */>>(
-                upperBound, targetDstNodes.get());
+            if (isBidirectional) {
+                bfsState = std::make_unique<BidirectionalBFSState>(upperBound,
+                    targetDstNodes.get(), *targetDstNodes->getNodeIDs().begin(),
+                    false /* trackPath */);
+            } else {
+                auto shortestPathState =
+                    std::make_unique<ShortestPathState<false /* TRACK_PATH */>>(
+                        upperBound, targetDstNodes.get());
+                enableDenseFrontiers(shortestPathState.get());
+                bfsState = std::move(shortestPathState);
+            }
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(
                     std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
@@ -87,6 +113,29 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
             KU_UNREACHABLE;
         }
     } break;
+    case QueryRelType::WEIGHTED_SHORTEST: {
+        switch (joinType) {
+        case planner::RecursiveJoinType::TRACK_PATH: {
+            vectors->pathVector = resultSet->getValueVector(dataInfo->pathPos).get();
+            bfsState = std::make_unique<WeightedShortestPathState>(
+                upperBound, targetDstNodes.get(), true /* trackPath */);
+            for (auto i = lowerBound; i <= upperBound; ++i) {
+                scanners.push_back(std::make_unique<PathScanner>(
+                    targetDstNodes.get(), i, dataInfo->tableIDToName));
+            }
+        } break;
+        case planner::RecursiveJoinType::TRACK_NONE: {
+            bfsState = std::make_unique<WeightedShortestPathState>(
+                upperBound, targetDstNodes.get(), false /* trackPath */);
+            for (auto i = lowerBound; i <= upperBound; ++i) {
+                scanners.push_back(
+                    std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
+            }
+        } break;
+        default:
+            KU_UNREACHABLE;
+        }
+    } break;
     default:
         KU_UNREACHABLE;
     }
@@ -127,6 +176,15 @@ void RecursiveJoin::initLocalStateInternal(ResultSet* /*resultSet_*/, ExecutionC
             StructVector::getFieldVector(pathRelsDataVector, pathRelsLabelFieldIdx).get();
     }
     frontiersScanner = std::make_unique<FrontiersScanner>(std::move(scanners));
+    if (isMultiSource) {
+        KU_ASSERT(queryRelType == QueryRelType::SHORTEST &&
+                  joinType == planner::RecursiveJoinType::TRACK_NONE);
+        multiSourceState = std::make_unique<MultiSourceBFSLocalState>();
+        multiSourceState->bfsState =
+            std::make_unique<MultiSourceBFSState>(upperBound, targetDstNodes.get());
+        multiSourceState->srcNodeChunkState = vectors->srcNodeIDVector->state.get();
+        currentSelVector->resetSelectorToValuePosBufferWithSize(1 /* size */);
+    }
     initLocalRecursivePlan(context);
 }
 
@@ -134,6 +192,14 @@ bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
     if (targetDstNodes->getNumNodes() == 0) {
         return false;
     }
+    if (isMultiSource) {
+        try {
+            return getNextTuplesMultiSource(context);
+        } catch (...) {
+            endFetchingSrcNodes(); // Don't let helper threads wait for this thread.
+            throw;
+        }
+    }
     // There are two high level steps.
     //
     // (1) BFS Computation phase: Grab a new source to do a BFS and compute an entire BFS starting
@@ -177,6 +243,10 @@ bool RecursiveJoin::scanOutput() {
 void RecursiveJoin::computeBFS(ExecutionContext* context) {
     auto nodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
         vectors->srcNodeIDVector->state->selVector->selectedPositions[0]);
+    if (isBidirectional) {
+        computeBidirectionalBFS(context, nodeID);
+        return;
+    }
     bfsState->markSrc(nodeID);
     scanFrontier->setNodePredicateExecFlag(true);
     while (!bfsState->isComplete()) {
@@ -195,7 +265,87 @@ void RecursiveJoin::computeBFS(ExecutionContext* context) {
     }
 }
 
+void RecursiveJoin::computeBidirectionalBFS(ExecutionContext* context, nodeID_t srcNodeID) {
+    auto bidirectionalState =
+        ku_dynamic_cast<BaseBFSState*, BidirectionalBFSState*>(bfsState.get());
+    bidirectionalState->markSrc(srcNodeID);
+    while (!bidirectionalState->isComplete()) {
+        auto isForward = bidirectionalState->isExtendingForward();
+        auto boundNodeID = bidirectionalState->getNextNodeID();
+        if (boundNodeID.offset == INVALID_OFFSET) {
+            bidirectionalState->finalizeCurrentLevel();
+            continue;
+        }
+        auto root = isForward ? recursiveRoot.get() : bwdRecursiveRoot.get();
+        auto nbrNodeIDVector =
+            isForward ? vectors->recursiveDstNodeIDVector : vectors->bwdRecursiveDstNodeIDVector;
+        auto edgeIDVector =
+            isForward ? vectors->recursiveEdgeIDVector : vectors->bwdRecursiveEdgeIDVector;
+        (isForward ? scanFrontier : bwdScanFrontier)->setNodeID(boundNodeID);
+        while (root->getNextTuple(context)) {
+            auto& selVector = nbrNodeIDVector->state->selVector;
+            for (auto i = 0u; i < selVector->selectedSize; ++i) {
+                auto pos = selVector->selectedPositions[i];
+                bidirectionalState->markVisited(boundNodeID,
+                    nbrNodeIDVector->getValue<nodeID_t>(pos), edgeIDVector->getValue<relID_t>(pos),
+                    1 /* multiplicity */);
+            }
+        }
+    }
+}
+
+static double getWeight(ValueVector* weightVector, uint32_t pos) {
+    switch (weightVector->dataType.getPhysicalType()) {
+    case PhysicalTypeID::INT64:
+        return (double)weightVector->getValue<int64_t>(pos);
+    case PhysicalTypeID::INT32:
+        return (double)weightVector->getValue<int32_t>(pos);
+    case PhysicalTypeID::INT16:
+        return (double)weightVector->getValue<int16_t>(pos);
+    case PhysicalTypeID::INT8:
+        return (double)weightVector->getValue<int8_t>(pos);
+    case PhysicalTypeID::UINT64:
+        return (double)weightVector->getValue<uint64_t>(pos);
+    case PhysicalTypeID::UINT32:
+        return (double)weightVector->getValue<uint32_t>(pos);
+    case PhysicalTypeID::UINT16:
+        return (double)weightVector->getValue<uint16_t>(pos);
+    case PhysicalTypeID::UINT8:
+        return (double)weightVector->getValue<uint8_t>(pos);
+    case PhysicalTypeID::DOUBLE:
+        return weightVector->getValue<double>(pos);
+    case PhysicalTypeID::FLOAT:
+        return (double)weightVector->getValue<float>(pos);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+void RecursiveJoin::updateVisitedNodesWithWeight(nodeID_t boundNodeID) {
+    auto weightedState =
+        ku_dynamic_cast<BaseBFSState*, WeightedShortestPathState*>(bfsState.get());
+    auto weightVector = vectors->recursiveEdgeWeightVector;
+    for (auto i = 0u; i < vectors->recursiveDstNodeIDVector->state->selVector->selectedSize; ++i) {
+        auto pos = vectors->recursiveDstNodeIDVector->state->selVector->selectedPositions[i];
+        if (weightVector->isNull(pos)) {
+            continue; // Rels without a weight can't be on a weighted path.
+        }
+        auto weight = getWeight(weightVector, pos);
+        if (weight < 0) {
+            throw RuntimeException(
+                stringFormat("Weighted shortest path found negative weight {}.", weight));
+        }
+        auto nbrNodeID = vectors->recursiveDstNodeIDVector->getValue<nodeID_t>(pos);
+        auto edgeID = vectors->recursiveEdgeIDVector->getValue<relID_t>(pos);
+        weightedState->markVisitedWithWeight(boundNodeID, nbrNodeID, edgeID, weight);
+    }
+}
+
 void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
+    if (vectors->recursiveEdgeWeightVector != nullptr) {
+        updateVisitedNodesWithWeight(boundNodeID);
+        return;
+    }
     auto boundNodeMultiplicity = bfsState->getMultiplicity(boundNodeID);
     for (auto i = 0u; i < vectors->recursiveDstNodeIDVector->state->selVector->selectedSize; ++i) {
         auto pos = vectors->recursiveDstNodeIDVector->state->selVector->selectedPositions[i];
@@ -205,6 +355,289 @@ void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
     }
 }
 
+bool RecursiveJoin::getNextTuplesMultiSource(ExecutionContext* context) {
+    // Same two phases as above, except that a BFS is computed for a batch of up to 64 src nodes
+    // of the current src node chunk at once. The results of each source of the batch are then
+    // output in turn, with the src node chunk flattened to that source.
+    // A src node that is alone in its chunk is extended by all threads instead, which keeps the
+    // other threads busy once they run out of src nodes.
+    auto& state = *multiSourceState;
+    while (true) {
+        if (state.outputSourceIdx < state.numSourcesInBatch) { // Phase 2
+            if (scanMultiSourceOutput()) {
+                return true;
+            }
+            state.outputSourceIdx++;
+            state.outputCursor = 0;
+            continue;
+        }
+        if (state.nextSrcNodeIdx == state.numSrcNodes && !fetchSrcNodes(context)) {
+            if (sharedState->parallelBFSState != nullptr) {
+                helpParallelBFS(context);
+            }
+            return false;
+        }
+        computeMultiSourceBFS(context); // Phase 1
+    }
+}
+
+bool RecursiveJoin::fetchSrcNodes(ExecutionContext* context) {
+    auto& state = *multiSourceState;
+    state.srcNodeChunkState->setToUnflat();
+    restoreSelVector(state.srcNodeChunkState->selVector);
+    if (sharedState->parallelBFSState != nullptr) {
+        sharedState->parallelBFSState->beginFetchingSrcNodes();
+        state.isFetchingSrcNodes = true;
+    }
+    if (!children[0]->getNextTuple(context)) {
+        endFetchingSrcNodes();
+        return false;
+    }
+    state.numSrcNodes = state.srcNodeChunkState->selVector->selectedSize;
+    state.nextSrcNodeIdx = 0;
+    saveSelVector(state.srcNodeChunkState->selVector);
+    state.srcNodeChunkState->setToFlat();
+    if (state.numSrcNodes != 1) {
+        endFetchingSrcNodes();
+    }
+    return true;
+}
+
+void RecursiveJoin::computeMultiSourceBFS(ExecutionContext* context) {
+    auto& state = *multiSourceState;
+    state.batchStartIdx = state.nextSrcNodeIdx;
+    state.numSourcesInBatch = std::min(
+        MultiSourceBFSState::MAX_NUM_SOURCES, state.numSrcNodes - state.nextSrcNodeIdx);
+    if (isBidirectional) {
+        // Searching from both ends is cheaper than batching forward searches, so src nodes are
+        // searched one at a time.
+        state.numSourcesInBatch = 1;
+    }
+    state.nextSrcNodeIdx += state.numSourcesInBatch;
+    state.outputSourceIdx = 0;
+    state.outputCursor = 0;
+    state.isSingleSourceBatch = false;
+    if (isBidirectional) {
+        endFetchingSrcNodes();
+        auto srcNodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
+            prevSelVector->selectedPositions[state.batchStartIdx]);
+        bfsState->resetState();
+        computeBidirectionalBFS(context, srcNodeID);
+        auto bidirectionalState =
+            ku_dynamic_cast<BaseBFSState*, BidirectionalBFSState*>(bfsState.get());
+        state.singleSourceVisitedNodes.clear();
+        if (bidirectionalState->getPathLength() != 0) {
+            state.singleSourceVisitedNodes.push_back(MultiSourceBFSState::VisitedNode{
+                bidirectionalState->getDstNodeID(), bidirectionalState->getPathLength()});
+        }
+        state.isSingleSourceBatch = true;
+        return;
+    }
+    if (state.numSrcNodes == 1 && sharedState->parallelBFSState != nullptr) {
+        auto srcNodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
+            prevSelVector->selectedPositions[state.batchStartIdx]);
+        if (computeParallelBFS(context, srcNodeID)) {
+            state.isSingleSourceBatch = true;
+            return;
+        }
+    }
+    endFetchingSrcNodes();
+    auto msBFSState = state.bfsState.get();
+    msBFSState->resetState();
+    for (auto i = 0u; i < state.numSourcesInBatch; ++i) {
+        auto pos = prevSelVector->selectedPositions[state.batchStartIdx + i];
+        msBFSState->markSrc(vectors->srcNodeIDVector->getValue<nodeID_t>(pos));
+    }
+    if (state.numSourcesInBatch > 1) {
+        sharedState->numMultiSourceBatches++;
+    }
+    scanFrontier->setNodePredicateExecFlag(true);
+    auto recursiveDstNodeIDVector = vectors->recursiveDstNodeIDVector;
+    while (!msBFSState->isComplete()) {
+        auto boundNodeID = msBFSState->getNextNodeID();
+        if (boundNodeID.offset != INVALID_OFFSET) {
+            scanFrontier->setNodeID(boundNodeID);
+            while (recursiveRoot->getNextTuple(context)) {
+                auto& selVector = recursiveDstNodeIDVector->state->selVector;
+                for (auto i = 0u; i < selVector->selectedSize; ++i) {
+                    auto pos = selVector->selectedPositions[i];
+                    msBFSState->markVisited(recursiveDstNodeIDVector->getValue<nodeID_t>(pos));
+                }
+            }
+        } else {
+            msBFSState->finalizeCurrentLevel();
+            scanFrontier->setNodePredicateExecFlag(false);
+        }
+    }
+}
+
+bool RecursiveJoin::scanMultiSourceOutput() {
+    auto& state = *multiSourceState;
+    auto& visitedNodes = state.isSingleSourceBatch ?
+                             state.singleSourceVisitedNodes :
+                             state.bfsState->getVisitedNodes(state.outputSourceIdx);
+    sel_t numOutput = 0;
+    while (state.outputCursor < visitedNodes.size() && numOutput < DEFAULT_VECTOR_CAPACITY) {
+        auto& visitedNode = visitedNodes[state.outputCursor++];
+        if (visitedNode.level < lowerBound || !targetDstNodes->contains(visitedNode.nodeID)) {
+            continue;
+        }
+        vectors->dstNodeIDVector->setValue<nodeID_t>(numOutput, visitedNode.nodeID);
+        vectors->pathLengthVector->setValue<int64_t>(numOutput, visitedNode.level);
+        numOutput++;
+    }
+    if (numOutput == 0) {
+        return false;
+    }
+    currentSelVector->selectedPositions[0] =
+        prevSelVector->selectedPositions[state.batchStartIdx + state.outputSourceIdx];
+    vectors->dstNodeIDVector->state->initOriginalAndSelectedSize(numOutput);
+    return true;
+}
+
+template<bool TRACK_PATH>
+void RecursiveJoin::enableDenseFrontiers(ShortestPathState<TRACK_PATH>* shortestPathState) {
+    // Dense frontiers are indexed by node offset, so all nbr nodes must be from one table.
+    if (dataInfo->recursiveDstNodeTableIDs.size() != 1 || sharedState->semiMasks.size() != 1) {
+        return;
+    }
+    auto nodeTable = sharedState->semiMasks[0]->getNodeTable();
+    if (!dataInfo->recursiveDstNodeTableIDs.contains(nodeTable->getTableID())) {
+        return;
+    }
+    auto maxNodeOffset = nodeTable->getMaxNodeOffset(transaction);
+    if (maxNodeOffset == INVALID_OFFSET) {
+        return; // Empty table.
+    }
+    shortestPathState->enableDenseFrontiers(nodeTable->getTableID(), maxNodeOffset + 1);
+}
+
+bool RecursiveJoin::computeParallelBFS(ExecutionContext* context, nodeID_t srcNodeID) {
+    auto parallelBFSState = sharedState->parallelBFSState.get();
+    if (srcNodeID.tableID != parallelBFSState->getTableID()) {
+        return false;
+    }
+    // The recursive pattern has a single node table, which is also the only nbr node table.
+    KU_ASSERT(sharedState->semiMasks.size() == 1);
+    auto maxNodeOffset = sharedState->semiMasks[0]->getNodeTable()->getMaxNodeOffset(transaction);
+    auto isStarted = parallelBFSState->tryStart(srcNodeID.offset, maxNodeOffset,
+        targetDstNodes->contains(srcNodeID), targetDstNodes->getNumNodes());
+    endFetchingSrcNodes();
+    if (!isStarted) {
+        return false;
+    }
+    ParallelBFSMorsel morsel;
+    try {
+        while (parallelBFSState->getOwnerMorsel(morsel)) {
+            extendParallelBFSMorsel(context, morsel);
+        }
+    } catch (...) {
+        parallelBFSState->abort();
+        throw;
+    }
+    auto& visitedNodes = multiSourceState->singleSourceVisitedNodes;
+    visitedNodes.clear();
+    for (auto offset : parallelBFSState->getVisitedNodeOffsets()) {
+        visitedNodes.push_back(MultiSourceBFSState::VisitedNode{
+            nodeID_t{offset, srcNodeID.tableID}, parallelBFSState->getLevel(offset)});
+    }
+    parallelBFSState->release();
+    return true;
+}
+
+void RecursiveJoin::helpParallelBFS(ExecutionContext* context) {
+    auto parallelBFSState = sharedState->parallelBFSState.get();
+    ParallelBFSMorsel morsel;
+    while (parallelBFSState->getHelperMorsel(morsel)) {
+        try {
+            extendParallelBFSMorsel(context, morsel);
+        } catch (...) {
+            parallelBFSState->abort();
+            throw;
+        }
+    }
+}
+
+void RecursiveJoin::extendParallelBFSMorsel(
+    ExecutionContext* context, const ParallelBFSMorsel& morsel) {
+    if (morsel.isBottomUp) {
+        extendParallelBFSMorselBottomUp(context, morsel);
+        return;
+    }
+    auto parallelBFSState = sharedState->parallelBFSState.get();
+    auto tableID = parallelBFSState->getTableID();
+    auto recursiveDstNodeIDVector = vectors->recursiveDstNodeIDVector;
+    auto& nextFrontier = multiSourceState->parallelBFSNextFrontier;
+    nextFrontier.clear();
+    uint64_t numVisitedDstNodes = 0;
+    scanFrontier->setNodePredicateExecFlag(morsel.level == 0);
+    for (auto i = morsel.startIdx; i < morsel.endIdx; ++i) {
+        scanFrontier->setNodeID(nodeID_t{parallelBFSState->getFrontierNodeOffset(i), tableID});
+        while (recursiveRoot->getNextTuple(context)) {
+            auto& selVector = recursiveDstNodeIDVector->state->selVector;
+            for (auto j = 0u; j < selVector->selectedSize; ++j) {
+                auto nbrNodeID =
+                    recursiveDstNodeIDVector->getValue<nodeID_t>(selVector->selectedPositions[j]);
+                if (parallelBFSState->markVisited(nbrNodeID.offset, morsel.level + 1)) {
+                    nextFrontier.push_back(nbrNodeID.offset);
+                    if (targetDstNodes->contains(nbrNodeID)) {
+                        numVisitedDstNodes++;
+                    }
+                }
+            }
+        }
+    }
+    parallelBFSState->finishMorsel(nextFrontier, numVisitedDstNodes);
+}
+
+void RecursiveJoin::extendParallelBFSMorselBottomUp(
+    ExecutionContext* context, const ParallelBFSMorsel& morsel) {
+    auto parallelBFSState = sharedState->parallelBFSState.get();
+    auto tableID = parallelBFSState->getTableID();
+    auto bwdRecursiveDstNodeIDVector = vectors->bwdRecursiveDstNodeIDVector;
+    auto& nextFrontier = multiSourceState->parallelBFSNextFrontier;
+    nextFrontier.clear();
+    uint64_t numVisitedDstNodes = 0;
+    for (auto offset = morsel.startIdx; offset < morsel.endIdx; ++offset) {
+        if (parallelBFSState->isVisited(offset)) {
+            continue;
+        }
+        auto hasParentInFrontier = false;
+        bwdScanFrontier->setNodeID(nodeID_t{offset, tableID});
+        // The scan is drained even after a parent is found, so that it starts over for the next
+        // node.
+        while (bwdRecursiveRoot->getNextTuple(context)) {
+            auto& selVector = bwdRecursiveDstNodeIDVector->state->selVector;
+            for (auto j = 0u; j < selVector->selectedSize && !hasParentInFrontier; ++j) {
+                auto parentNodeID = bwdRecursiveDstNodeIDVector->getValue<nodeID_t>(
+                    selVector->selectedPositions[j]);
+                hasParentInFrontier = parallelBFSState->isInFrontier(parentNodeID.offset);
+            }
+        }
+        if (!hasParentInFrontier) {
+            continue;
+        }
+        // Only this morsel can visit the node in a bottom-up level.
+        parallelBFSState->markVisited(offset, morsel.level + 1);
+        nextFrontier.push_back(offset);
+        if (targetDstNodes->contains(nodeID_t{offset, tableID})) {
+            numVisitedDstNodes++;
+        }
+    }
+    parallelBFSState->finishMorsel(nextFrontier, numVisitedDstNodes);
+}
+
+void RecursiveJoin::endFetchingSrcNodes() {
+    if (multiSourceState->isFetchingSrcNodes) {
+        multiSourceState->isFetchingSrcNodes = false;
+        sharedState->parallelBFSState->endFetchingSrcNodes();
+    }
+}
+
+void RecursiveJoin::resetToCurrentSelVector(std::shared_ptr<SelectionVector>& selVector) {
+    selVector = currentSelVector;
+}
+
 void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
     auto op = recursiveRoot.get();
     while (!op->isSource()) {
@@ -218,7 +651,28 @@ void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
         localResultSet->getValueVector(dataInfo->recursiveDstNodeIDPos).get();
     vectors->recursiveEdgeIDVector =
         localResultSet->getValueVector(dataInfo->recursiveEdgeIDPos).get();
+    if (dataInfo->recursiveEdgeWeightPos.isValid()) {
+        vectors->recursiveEdgeWeightVector =
+            localResultSet->getValueVector(dataInfo->recursiveEdgeWeightPos).get();
+    }
     recursiveRoot->initLocalState(localResultSet.get(), context);
+    // The plan in the opposite direction is used by bidirectional and bottom-up searches.
+    if (bwdRecursiveRoot == nullptr) {
+        return;
+    }
+    op = bwdRecursiveRoot.get();
+    while (!op->isSource()) {
+        KU_ASSERT(op->getNumChildren() == 1);
+        op = op->getChild(0);
+    }
+    bwdScanFrontier = (ScanFrontier*)op;
+    bwdLocalResultSet = std::make_unique<ResultSet>(
+        dataInfo->bwdLocalResultSetDescriptor.get(), context->memoryManager);
+    vectors->bwdRecursiveDstNodeIDVector =
+        bwdLocalResultSet->getValueVector(dataInfo->bwdRecursiveDstNodeIDPos).get();
+    vectors->bwdRecursiveEdgeIDVector =
+        bwdLocalResultSet->getValueVector(dataInfo->bwdRecursiveEdgeIDPos).get();
+    bwdRecursiveRoot->initLocalState(bwdLocalResultSet.get(), context);
 }
 
 void RecursiveJoin::populateTargetDstNodes() {
@@ -248,5 +702,21 @@ void RecursiveJoin::populateTargetDstNodes() {
     }
 }
 
+std::unordered_map<std::string, std::string> RecursiveJoin::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    if (isMultiSource) {
+        result.insert(
+            {"NumMultiSourceBatches", std::to_string(sharedState->numMultiSourceBatches.load())});
+    }
+    if (sharedState->parallelBFSState != nullptr) {
+        auto parallelBFSState = sharedState->parallelBFSState.get();
+        result.insert({"NumParallelBFSs", std::to_string(parallelBFSState->getNumBFSs())});
+        result.insert(
+            {"NumBottomUpLevels", std::to_string(parallelBFSState->getNumBottomUpLevels())});
+    }
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
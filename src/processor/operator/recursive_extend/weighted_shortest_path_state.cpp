@@ -0,0 +1,168 @@
+#include "processor/operator/recursive_extend/weighted_shortest_path_state.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+// Costs are non-negative, so their bit patterns order the same way as their values.
+static inline uint64_t getHeapKey(double cost) {
+    return std::bit_cast<uint64_t>(cost);
+}
+
+void WeightedShortestPathState::resetState() {
+    BaseBFSState::resetState();
+    isFinalized = false;
+    numSettledDstNodes = 0;
+    nodeIDToIdx.clear();
+    nodeStates.clear();
+    pathStates.clear();
+    cheapestStateIdxs.clear();
+    currentStateIdx = 0;
+    heap.clear();
+}
+
+void WeightedShortestPathState::markSrc(nodeID_t nodeID) {
+    auto nodeIdx = getOrInsertNodeIdx(nodeID);
+    currentStateIdx = insertState(nodeIdx, 0 /* cost */, 0 /* numRels */, UINT32_MAX,
+        relID_t{INVALID_OFFSET, INVALID_TABLE_ID});
+    auto& pathState = pathStates[currentStateIdx];
+    pathState.isSettled = true;
+    pathState.isCheapest = true;
+    nodeStates[nodeIdx].minSettledNumRels = 0;
+    if (targetDstNodes->contains(nodeID)) {
+        numSettledDstNodes++;
+    }
+    currentFrontier->addNodeWithMultiplicity(nodeID, 1);
+}
+
+nodeID_t WeightedShortestPathState::getNextNodeID() {
+    if (currentLevel == 0) {
+        return BaseBFSState::getNextNodeID();
+    }
+    while (!heap.empty() && !isAllDstSettled()) {
+        auto stateIdx = heap.pop().second;
+        auto& pathState = pathStates[stateIdx];
+        auto& nodeState = nodeStates[pathState.nodeIdx];
+        if (pathState.numRels >= nodeState.minSettledNumRels) {
+            continue; // A cheaper state of the node with at most as many rels is settled.
+        }
+        pathState.isSettled = true;
+        if (nodeState.minSettledNumRels == UINT64_MAX) {
+            pathState.isCheapest = true;
+            cheapestStateIdxs.push_back(stateIdx);
+            if (targetDstNodes->contains(nodeState.nodeID)) {
+                numSettledDstNodes++;
+            }
+        }
+        nodeState.minSettledNumRels = pathState.numRels;
+        if (pathState.numRels == upperBound) {
+            continue; // Extending the state would exceed the upper bound.
+        }
+        currentStateIdx = stateIdx;
+        return nodeState.nodeID;
+    }
+    return nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+}
+
+void WeightedShortestPathState::markVisitedWithWeight([[maybe_unused]] nodeID_t boundNodeID,
+    nodeID_t nbrNodeID, relID_t relID, double weight) {
+    KU_ASSERT(nodeStates[pathStates[currentStateIdx].nodeIdx].nodeID == boundNodeID);
+    // Adding -0.0 to a non-negative cost gives +0.0, which keeps heap keys ordered.
+    auto cost = pathStates[currentStateIdx].cost + weight;
+    auto numRels = pathStates[currentStateIdx].numRels + 1;
+    auto nodeIdx = getOrInsertNodeIdx(nbrNodeID);
+    if (numRels >= nodeStates[nodeIdx].minSettledNumRels ||
+        isDominated(nodeStates[nodeIdx], cost, numRels)) {
+        return;
+    }
+    auto stateIdx = insertState(nodeIdx, cost, numRels, currentStateIdx, relID);
+    heap.push(getHeapKey(cost), stateIdx);
+}
+
+void WeightedShortestPathState::finalizeCurrentLevel() {
+    if (currentLevel == 0) {
+        // Src node is extended. Following states are extended from the heap.
+        currentLevel++;
+        return;
+    }
+    populateFrontiers();
+    isFinalized = true;
+}
+
+uint32_t WeightedShortestPathState::getOrInsertNodeIdx(nodeID_t nodeID) {
+    auto [iter, inserted] = nodeIDToIdx.emplace(nodeID, nodeStates.size());
+    if (inserted) {
+        nodeStates.push_back(NodeState{nodeID, std::vector<uint32_t>{}, UINT64_MAX});
+    }
+    return iter->second;
+}
+
+uint32_t WeightedShortestPathState::insertState(uint32_t nodeIdx, double cost, uint64_t numRels,
+    uint32_t parentStateIdx, relID_t parentRelID) {
+    auto stateIdx = (uint32_t)pathStates.size();
+    pathStates.push_back(PathState{nodeIdx, cost, numRels, parentStateIdx, parentRelID,
+        false /* isSettled */, false /* isCheapest */, false /* isInFrontier */});
+    auto& stateIdxs = nodeStates[nodeIdx].stateIdxs;
+    // The dominated states have at least as many rels and follow each other in the front.
+    auto begin = std::lower_bound(stateIdxs.begin(), stateIdxs.end(), numRels,
+        [&](uint32_t idx, uint64_t value) { return pathStates[idx].numRels < value; });
+    auto end = begin;
+    while (end != stateIdxs.end() && pathStates[*end].cost >= cost) {
+        end++;
+    }
+    if (begin == end) {
+        stateIdxs.insert(begin, stateIdx);
+    } else {
+        *begin = stateIdx;
+        stateIdxs.erase(begin + 1, end);
+    }
+    return stateIdx;
+}
+
+bool WeightedShortestPathState::isDominated(
+    const NodeState& nodeState, double cost, uint64_t numRels) const {
+    // Of the states with at most numRels rels, the one with the most rels is the cheapest.
+    auto iter = std::upper_bound(nodeState.stateIdxs.begin(), nodeState.stateIdxs.end(), numRels,
+        [&](uint64_t value, uint32_t idx) { return value < pathStates[idx].numRels; });
+    return iter != nodeState.stateIdxs.begin() && pathStates[*(iter - 1)].cost <= cost;
+}
+
+void WeightedShortestPathState::populateFrontiers() {
+    for (auto cheapestStateIdx : cheapestStateIdxs) {
+        auto& cheapestState = pathStates[cheapestStateIdx];
+        KU_ASSERT(cheapestState.numRels <= upperBound);
+        while (frontiers.size() <= cheapestState.numRels) {
+            addNextFrontier();
+        }
+        if (!trackPath) {
+            frontiers[cheapestState.numRels]->addNodeWithMultiplicity(
+                nodeStates[cheapestState.nodeIdx].nodeID, 1);
+            continue;
+        }
+        // Add the bwd edges of the path, until reaching a state whose path is added already.
+        for (auto stateIdx = cheapestStateIdx; stateIdx != UINT32_MAX;) {
+            auto& pathState = pathStates[stateIdx];
+            if (pathState.isInFrontier || pathState.numRels == 0) {
+                break;
+            }
+            pathState.isInFrontier = true;
+            auto& parentState = pathStates[pathState.parentStateIdx];
+            auto nodeID = nodeStates[pathState.nodeIdx].nodeID;
+            auto parentNodeID = nodeStates[parentState.nodeIdx].nodeID;
+            auto frontier = frontiers[pathState.numRels].get();
+            if (pathState.isCheapest) {
+                frontier->addEdge(parentNodeID, nodeID, pathState.parentRelID);
+            } else {
+                frontier->addBwdEdge(parentNodeID, nodeID, pathState.parentRelID);
+            }
+            stateIdx = pathState.parentStateIdx;
+        }
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
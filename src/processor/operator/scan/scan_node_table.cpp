@@ -6,9 +6,11 @@ namespace kuzu {
 namespace processor {
 
 bool ScanSingleNodeTable::getNextTuplesInternal(ExecutionContext* context) {
-    if (!children[0]->getNextTuple(context)) {
-        return false;
-    }
+    do {
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+    } while (canSkipInput());
     for (auto& outputVector : outVectors) {
         outputVector->resetAuxiliaryBuffer();
     }
@@ -17,5 +19,14 @@ bool ScanSingleNodeTable::getNextTuplesInternal(ExecutionContext* context) {
     return true;
 }
 
+bool ScanSingleNodeTable::canSkipInput() {
+    // Sequential node IDs come from a single morsel, which never spans multiple node groups.
+    if (info->zoneMapChecks.empty() || !inVector->isSequential()) {
+        return false;
+    }
+    auto nodeGroupIdx = storage::StorageUtils::getNodeGroupIdx(inVector->readNodeOffset(0));
+    return info->table->canSkipNodeGroup(transaction, nodeGroupIdx, info->zoneMapChecks);
+}
+
 } // namespace processor
 } // namespace kuzu
@@ -25,7 +25,13 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(
     auto task = std::make_shared<ProcessorTask>(resultCollector, context);
     decomposePlanIntoTask(lastOperator->getChild(0), task.get(), context);
     initTask(task.get());
-    taskScheduler->scheduleTaskAndWaitOrError(task, context);
+    auto priority = context->clientContext->getQueryPriority();
+    if (priority == QueryPriority::NORMAL && physicalPlan->isShortQuery) {
+        priority = QueryPriority::HIGH;
+    }
+    auto admittedQuery =
+        admissionController.admit(physicalPlan->estimatedMemoryUsage, priority, context);
+    taskScheduler->scheduleTaskAndWaitOrError(task, priority, context);
     return resultCollector->getResultFactorizedTable();
 }
 
@@ -34,14 +40,75 @@ void QueryProcessor::decomposePlanIntoTask(
     if (op->isSink()) {
         auto childTask =
             std::make_unique<ProcessorTask>(ku_dynamic_cast<PhysicalOperator*, Sink*>(op), context);
-        for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
-            decomposePlanIntoTask(op->getChild(i), childTask.get(), context);
-        }
+        decomposeChildrenIntoTask(op, childTask.get(), context);
         task->addChildTask(std::move(childTask));
     } else {
-        // Schedule the right most side (e.g., build side of the hash join) first.
-        for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
-            decomposePlanIntoTask(op->getChild(i), task, context);
+        decomposeChildrenIntoTask(op, task, context);
+    }
+}
+
+// A semi masker filters the scans on the probe side of its join, and updates have to be applied in
+// the order of the plan.
+static bool hasSideEffectsInSubtree(PhysicalOperator* op) {
+    if (op->hasSideEffects()) {
+        return true;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        if (hasSideEffectsInSubtree(op->getChild(i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// With sideways information passing from probe to build, the probe side is accumulated by the
+// last child and read by the build side.
+static bool isSIPProbeToBuild(PhysicalOperator* op) {
+    switch (op->getOperatorType()) {
+    case PhysicalOperatorType::HASH_JOIN_PROBE:
+    case PhysicalOperatorType::INTERSECT:
+    case PhysicalOperatorType::PATH_PROPERTY_PROBE:
+        return op->getChild(op->getNumChildren() - 1)->getOperatorType() ==
+               PhysicalOperatorType::RESULT_COLLECTOR;
+    default:
+        return false;
+    }
+}
+
+static void addDependenciesToSubtree(Task* task, const std::vector<Task*>& dependencies) {
+    for (auto dependency : dependencies) {
+        task->addDependency(dependency);
+    }
+    for (auto& child : task->children) {
+        addDependenciesToSubtree(child.get(), dependencies);
+    }
+}
+
+void QueryProcessor::decomposeChildrenIntoTask(
+    PhysicalOperator* op, Task* task, ExecutionContext* context) {
+    auto isOrdered = false;
+    if (op->getNumChildren() > 1) {
+        isOrdered = isSIPProbeToBuild(op);
+        for (auto i = 0u; i < op->getNumChildren() && !isOrdered; ++i) {
+            isOrdered = hasSideEffectsInSubtree(op->getChild(i));
+        }
+    }
+    // Tasks of children decomposed so far. If the children are ordered, every task of a later
+    // child depends on them, including the nested ones, which may e.g. scan a semi mask.
+    std::vector<Task*> prevChildTasks;
+    // Decompose the right most side (e.g., build side of the hash join) first, so that it runs
+    // first if the children are ordered.
+    for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
+        auto numChildTasks = task->children.size();
+        decomposePlanIntoTask(op->getChild(i), task, context);
+        if (!isOrdered) {
+            continue;
+        }
+        for (auto j = numChildTasks; j < task->children.size(); ++j) {
+            addDependenciesToSubtree(task->children[j].get(), prevChildTasks);
+        }
+        for (auto j = numChildTasks; j < task->children.size(); ++j) {
+            prevChildTasks.push_back(task->children[j].get());
         }
     }
 }
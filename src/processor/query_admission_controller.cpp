@@ -0,0 +1,65 @@
+#include "processor/query_admission_controller.h"
+
+#include "common/constants.h"
+#include "common/exception/interrupt.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+AdmittedQuery::~AdmittedQuery() {
+    if (controller != nullptr) {
+        controller->release(reservedMemory);
+    }
+}
+
+std::unique_ptr<AdmittedQuery> QueryAdmissionController::admit(
+    uint64_t estimatedMemoryUsage, QueryPriority priority, ExecutionContext* context) {
+    auto memoryBudget = (uint64_t)((double)context->bufferManager->getBufferPoolSize() *
+                                   QueryAdmissionConstants::MEMORY_BUDGET_RATIO);
+    if (estimatedMemoryUsage <= memoryBudget / QueryAdmissionConstants::MEMORY_HEAVY_QUERY_RATIO) {
+        return std::make_unique<AdmittedQuery>(nullptr /* controller */, 0 /* reservedMemory */);
+    }
+    auto memoryToReserve = std::min(estimatedMemoryUsage, memoryBudget);
+    auto clientContext = context->clientContext;
+    std::unique_lock<std::mutex> lck{mtx};
+    numWaitingQueries[(uint8_t)priority]++;
+    while (!canAdmitNoLock(memoryToReserve, memoryBudget, priority)) {
+        if (clientContext->isInterrupted() || (clientContext->isTimeOutEnabled() &&
+                                                  clientContext->getTimeoutRemainingInMS() == 0)) {
+            numWaitingQueries[(uint8_t)priority]--;
+            lck.unlock();
+            // Queries of lower priority may be admitted now.
+            cv.notify_all();
+            throw InterruptException();
+        }
+        // Interrupts are not signaled to the controller, so wake up to check for them.
+        cv.wait_for(lck, std::chrono::milliseconds(QueryAdmissionConstants::WAIT_INTERVAL_IN_MS));
+    }
+    numWaitingQueries[(uint8_t)priority]--;
+    reservedMemory += memoryToReserve;
+    numAdmittedQueries++;
+    return std::make_unique<AdmittedQuery>(this, memoryToReserve);
+}
+
+bool QueryAdmissionController::canAdmitNoLock(
+    uint64_t memoryToReserve, uint64_t memoryBudget, QueryPriority priority) const {
+    for (auto i = (uint64_t)priority + 1; i < numWaitingQueries.size(); ++i) {
+        if (numWaitingQueries[i] > 0) {
+            return false;
+        }
+    }
+    return numAdmittedQueries == 0 || reservedMemory + memoryToReserve <= memoryBudget;
+}
+
+void QueryAdmissionController::release(uint64_t memoryToRelease) {
+    std::unique_lock<std::mutex> lck{mtx};
+    reservedMemory -= memoryToRelease;
+    numAdmittedQueries--;
+    lck.unlock();
+    cv.notify_all();
+}
+
+} // namespace processor
+} // namespace kuzu
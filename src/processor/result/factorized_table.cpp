@@ -106,6 +106,18 @@ void DataBlockCollection::merge(DataBlockCollection& other) {
     }
 }
 
+void DataBlockCollection::spill() {
+    for (auto& block : blocks) {
+        block->spill();
+    }
+}
+
+void DataBlockCollection::reload() {
+    for (auto& block : blocks) {
+        block->reload();
+    }
+}
+
 FactorizedTable::FactorizedTable(
     MemoryManager* memoryManager, std::unique_ptr<FactorizedTableSchema> tableSchema)
     : memoryManager{memoryManager}, tableSchema{std::move(tableSchema)}, numTuples{0} {
@@ -225,6 +237,24 @@ void FactorizedTable::merge(FactorizedTable& other) {
     numTuples += other.numTuples;
 }
 
+void FactorizedTable::spill() {
+    if (tableSchema->isEmpty()) {
+        return;
+    }
+    flatTupleBlockCollection->spill();
+    unflatTupleBlockCollection->spill();
+    inMemOverflowBuffer->spill();
+}
+
+void FactorizedTable::reload() {
+    if (tableSchema->isEmpty()) {
+        return;
+    }
+    flatTupleBlockCollection->reload();
+    unflatTupleBlockCollection->reload();
+    inMemOverflowBuffer->reload();
+}
+
 bool FactorizedTable::hasUnflatCol() const {
     std::vector<ft_col_idx_t> colIdxes(tableSchema->getNumColumns());
     iota(colIdxes.begin(), colIdxes.end(), 0);
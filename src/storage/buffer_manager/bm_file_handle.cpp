@@ -1,5 +1,10 @@
 #include "storage/buffer_manager/bm_file_handle.h"
 
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+
+#include "common/file_system/local_file_system.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/storage_utils.h"
 
@@ -20,12 +25,36 @@ BMFileHandle::BMFileHandle(const std::string& path, uint8_t flags, BufferManager
     PageSizeClass pageSizeClass, FileVersionedType fileVersionedType,
     common::VirtualFileSystem* vfs)
     : FileHandle{path, flags, vfs}, fileVersionedType{fileVersionedType}, bm{bm},
-      pageSizeClass{pageSizeClass} {
+      pageSizeClass{pageSizeClass}, numPrefetchesInFlight{0}, numPagesRead{0},
+      mmappedData{nullptr}, numMMappedPages{0} {
     initPageStatesAndGroups();
+    mmapFileIfReadOnly();
 }
 
 BMFileHandle::~BMFileHandle() {
     bm->removeFilePagesFromFrames(*this);
+#if !defined(_WIN32)
+    if (mmappedData) {
+        munmap(mmappedData, (uint64_t)numMMappedPages * getPageSize());
+    }
+#endif
+}
+
+// Only local files on POSIX systems are mapped. Other files fall back to being cached by the BM.
+void BMFileHandle::mmapFileIfReadOnly() {
+#if !defined(_WIN32)
+    auto localFileInfo = dynamic_cast<LocalFileInfo*>(fileInfo.get());
+    if (!isReadOnlyFile() || isLargePaged() || numPages == 0 || !localFileInfo) {
+        return;
+    }
+    auto mappedSize = (uint64_t)numPages * getPageSize();
+    auto data = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, localFileInfo->fd, 0 /* offset */);
+    if (data == MAP_FAILED) {
+        return;
+    }
+    mmappedData = (uint8_t*)data;
+    numMMappedPages = numPages;
+#endif
 }
 
 void BMFileHandle::initPageStatesAndGroups() {
@@ -79,6 +108,7 @@ void BMFileHandle::removePageIdxAndTruncateIfNecessary(page_idx_t pageIdx) {
     if (numPages <= pageIdx) {
         return;
     }
+    waitForPrefetchesToFinish();
     numPages = pageIdx;
     pageStates.resize(numPages);
     auto numPageGroups = getNumPageGroups();
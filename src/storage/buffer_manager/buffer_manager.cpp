@@ -1,9 +1,12 @@
 #include "storage/buffer_manager/buffer_manager.h"
 
+#include <algorithm>
+#include <bit>
 #include <cstring>
 
 #include "common/constants.h"
 #include "common/exception/buffer_manager.h"
+#include "function/hash/hash_functions.h"
 
 #if defined(_WIN32)
 #include <exception>
@@ -11,6 +14,8 @@
 #include <eh.h>
 #include <windows.h>
 #include <winnt.h>
+#else
+#include <sys/mman.h>
 #endif
 
 using namespace kuzu::common;
@@ -18,63 +23,254 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 // In this function, we try to remove as many as possible candidates that are not evictable from the
-// eviction queue until we hit a candidate that is evictable.
+// shard until we hit a candidate that is evictable, which is left at the front of the shard, so that
+// purging keeps the FIFO order of evictable candidates.
 // 1) If the candidate page's version has changed, which means the page was pinned and unpinned, we
 // remove the candidate from the queue.
 // 2) If the candidate page's state is UNLOCKED, and its page version hasn't changed, which means
 // the page was optimistically read, we give a second chance to evict the page by marking the page
 // as MARKED, and moving the candidate to the back of the queue.
 // 3) If the candidate page's state is LOCKED, we remove the candidate from the queue.
-void EvictionQueue::removeNonEvictableCandidates() {
-    std::shared_lock sLck{mtx};
-    while (true) {
-        EvictionCandidate evictionCandidate;
-        if (!queue->try_dequeue(evictionCandidate)) {
-            break;
-        }
+void EvictionQueue::Shard::removeNonEvictableCandidates() {
+    EvictionCandidate evictionCandidate;
+    while (queue.try_dequeue_if(evictionCandidate, [](const EvictionCandidate& candidate) {
+        return !candidate.isEvictable(candidate.pageState->getStateAndVersion());
+    })) {
         auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
         if (evictionCandidate.isEvictable(pageStateAndVersion)) {
-            queue->enqueue(evictionCandidate);
-            break;
+            // The page was unpinned after the candidate was checked.
+            queue.enqueue(evictionCandidate);
         } else if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
             // The page was optimistically read, mark it as MARKED, and enqueue to be evicted later.
             evictionCandidate.pageState->tryMark(pageStateAndVersion);
-            queue->enqueue(evictionCandidate);
-            continue;
+            queue.enqueue(evictionCandidate);
         } else {
             // Cases to remove the candidate from the queue:
             // 1) The page is currently LOCKED (it is currently pinned), remove the candidate from
             // the queue.
             // 2) The page's version number has changed (it was pinned and unpinned), another
             // candidate exists for this page in the queue. remove the candidate from the queue.
-            continue;
+            size.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::atomic<uint64_t> EvictionQueue::nextLocalShardIdx{0};
+thread_local uint64_t EvictionQueue::localShardIdx = EvictionQueue::nextLocalShardIdx++;
+
+EvictionQueue::EvictionQueue() {
+    auto numShards = std::min<uint64_t>(
+        std::bit_ceil(std::max(1u, std::thread::hardware_concurrency())), MAX_NUM_SHARDS);
+    shards.resize(numShards);
+    for (auto& shard : shards) {
+        shard = std::make_unique<Shard>();
+    }
+}
+
+void EvictionQueue::enqueue(Shard& shard, EvictionCandidate& candidate) {
+    auto numInsertions = shard.numInsertions.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (numInsertions % BufferPoolConstants::EVICTION_QUEUE_PURGING_INTERVAL == 0) {
+        shard.removeNonEvictableCandidates();
+    }
+    shard.queue.enqueue(candidate);
+    shard.size.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool EvictionQueue::dequeue(EvictionCandidate& candidate) {
+    auto localShardIdx = getLocalShardIdx();
+    for (auto i = 0u; i < shards.size(); i++) {
+        auto& shard = *shards[(localShardIdx + i) & (shards.size() - 1)];
+        if (shard.queue.try_dequeue(candidate)) {
+            shard.size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
         }
     }
+    return false;
+}
+
+uint64_t EvictionQueue::getSize() const {
+    int64_t size = 0;
+    for (auto& shard : shards) {
+        size += shard->size.load(std::memory_order_relaxed);
+    }
+    return std::max<int64_t>(size, 0);
+}
+
+void EvictionQueue::removeCandidatesForFile(BMFileHandle& fileHandle) {
+    for (auto& shard : shards) {
+        shard->queue.erase_if([&](const EvictionCandidate& candidate) {
+            if (candidate.fileHandle != &fileHandle) {
+                return false;
+            }
+            shard->size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        });
+    }
 }
 
-void EvictionQueue::removeCandidatesForFile(kuzu::storage::BMFileHandle& fileHandle) {
-    std::unique_lock xLck{mtx};
-    EvictionCandidate candidate;
-    uint64_t loopedCandidateIdx = 0;
-    auto numCandidatesInQueue = queue->size();
-    while (loopedCandidateIdx < numCandidatesInQueue && queue->try_dequeue(candidate)) {
-        if (candidate.fileHandle != &fileHandle) {
+std::unique_ptr<EvictionPolicy> EvictionPolicy::create(
+    EvictionPolicyType policyType, uint64_t bufferPoolSize) {
+    switch (policyType) {
+    case EvictionPolicyType::FIFO:
+        return std::make_unique<FIFOEvictionPolicy>();
+    case EvictionPolicyType::TWO_QUEUE:
+        return std::make_unique<TwoQueueEvictionPolicy>(bufferPoolSize);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+bool FIFOEvictionPolicy::getNextCandidateToEvict(EvictionCandidate& candidate) {
+    while (queue->dequeue(candidate)) {
+        auto pageStateAndVersion = candidate.pageState->getStateAndVersion();
+        if (candidate.isEvictable(pageStateAndVersion)) {
+            return true;
+        }
+        if (candidate.isSecondChanceEvictable(pageStateAndVersion)) {
+            candidate.pageState->tryMark(pageStateAndVersion);
             queue->enqueue(candidate);
         }
-        loopedCandidateIdx++;
     }
+    return false;
+}
+
+TwoQueueEvictionPolicy::TwoQueueEvictionPolicy(uint64_t bufferPoolSize)
+    : smallQueue{std::make_unique<EvictionQueue>()}, mainQueue{std::make_unique<EvictionQueue>()} {
+    auto numFrames = bufferPoolSize / BufferPoolConstants::PAGE_4KB_SIZE;
+    smallQueueTargetSize = std::max<uint64_t>(1, numFrames * SMALL_QUEUE_SIZE_RATIO);
+    ghostTable = std::vector<std::atomic<uint64_t>>(
+        std::bit_ceil(std::max<uint64_t>(1, numFrames * GHOST_TABLE_SIZE_RATIO)));
+}
+
+void TwoQueueEvictionPolicy::onPageCached(
+    BMFileHandle& fileHandle, page_idx_t pageIdx, PageState& pageState) {
+    auto fingerprint = getGhostFingerprint(&fileHandle, pageIdx);
+    auto& ghostSlot = getGhostSlot(fingerprint);
+    if (ghostSlot.load(std::memory_order_relaxed) == fingerprint) {
+        ghostSlot.store(0, std::memory_order_relaxed);
+        pageState.setHot();
+    }
+}
+
+void TwoQueueEvictionPolicy::enqueue(
+    BMFileHandle* fileHandle, page_idx_t pageIdx, PageState* pageState, uint64_t pageVersion) {
+    auto& queue = PageState::isHot(pageVersion) ? mainQueue : smallQueue;
+    queue->enqueue(fileHandle, pageIdx, pageState, pageVersion);
+}
+
+bool TwoQueueEvictionPolicy::getNextCandidateToEvict(EvictionCandidate& candidate) {
+    if (smallQueue->getSize() > smallQueueTargetSize && getNextCandidateFromSmallQueue(candidate)) {
+        return true;
+    }
+    return getNextCandidateFromMainQueue(candidate) || getNextCandidateFromSmallQueue(candidate);
+}
+
+bool TwoQueueEvictionPolicy::getNextCandidateFromSmallQueue(EvictionCandidate& candidate) {
+    while (smallQueue->dequeue(candidate)) {
+        auto pageStateAndVersion = candidate.pageState->getStateAndVersion();
+        // Optimistic reads don't save a page from being evicted from the small queue, since a
+        // scan reads each of its pages several times in a row.
+        if (candidate.isSecondChanceEvictable(pageStateAndVersion)) {
+            candidate.pageState->tryMark(pageStateAndVersion);
+            pageStateAndVersion = candidate.pageState->getStateAndVersion();
+        }
+        if (candidate.isEvictable(pageStateAndVersion)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TwoQueueEvictionPolicy::getNextCandidateFromMainQueue(EvictionCandidate& candidate) {
+    while (mainQueue->dequeue(candidate)) {
+        auto pageStateAndVersion = candidate.pageState->getStateAndVersion();
+        if (candidate.isEvictable(pageStateAndVersion)) {
+            return true;
+        }
+        if (candidate.isSecondChanceEvictable(pageStateAndVersion)) {
+            candidate.pageState->tryMark(pageStateAndVersion);
+            mainQueue->enqueue(candidate);
+        }
+    }
+    return false;
 }
 
-BufferManager::BufferManager(uint64_t bufferPoolSize)
-    : usedMemory{0}, bufferPoolSize{bufferPoolSize}, numEvictionQueueInsertions{0} {
+void TwoQueueEvictionPolicy::onPageEvicted(const EvictionCandidate& candidate) {
+    // Only pages evicted from the small queue are remembered. Candidates of hot pages are in the
+    // main queue.
+    if (!PageState::isHot(candidate.pageVersion)) {
+        auto fingerprint = getGhostFingerprint(candidate.fileHandle, candidate.pageIdx);
+        getGhostSlot(fingerprint).store(fingerprint, std::memory_order_relaxed);
+    }
+}
+
+void TwoQueueEvictionPolicy::removeCandidatesForFile(BMFileHandle& fileHandle) {
+    smallQueue->removeCandidatesForFile(fileHandle);
+    mainQueue->removeCandidatesForFile(fileHandle);
+}
+
+uint64_t TwoQueueEvictionPolicy::getGhostFingerprint(BMFileHandle* fileHandle, page_idx_t pageIdx) {
+    auto fingerprint = function::combineHashScalar(
+        function::murmurhash64((uint64_t)fileHandle), function::murmurhash64(pageIdx));
+    // Zero marks an empty slot.
+    return fingerprint | 1;
+}
+
+PrefetchThreadPool::PrefetchThreadPool(uint64_t numThreads) : stopped{false} {
+    for (auto i = 0u; i < numThreads; i++) {
+        workers.emplace_back([&]() { runWorker(); });
+    }
+}
+
+PrefetchThreadPool::~PrefetchThreadPool() {
+    {
+        std::unique_lock lck{mtx};
+        stopped = true;
+    }
+    cv.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void PrefetchThreadPool::submit(std::function<void()> task) {
+    {
+        std::unique_lock lck{mtx};
+        tasks.push_back(std::move(task));
+    }
+    cv.notify_one();
+}
+
+void PrefetchThreadPool::runWorker() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lck{mtx};
+            cv.wait(lck, [&]() { return stopped || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+BufferManager::BufferManager(
+    uint64_t bufferPoolSize, EvictionPolicyType evictionPolicyType, uint64_t maxSpillSize)
+    : usedMemory{0}, bufferPoolSize{bufferPoolSize}, prefetchMemoryInFlight{0},
+      evictionPolicyType{evictionPolicyType} {
     if (bufferPoolSize < BufferPoolConstants::PAGE_4KB_SIZE) {
         throw BufferManagerException("The given buffer pool size should be at least 4KB.");
     }
     vmRegions.resize(2);
     vmRegions[0] = std::make_unique<VMRegion>(
         PageSizeClass::PAGE_4KB, BufferPoolConstants::DEFAULT_VM_REGION_MAX_SIZE);
-    vmRegions[1] = std::make_unique<VMRegion>(PageSizeClass::PAGE_256KB, bufferPoolSize);
-    evictionQueue = std::make_unique<EvictionQueue>();
+    auto spillableRegionSize = std::max(bufferPoolSize,
+        std::min(bufferPoolSize + maxSpillSize, BufferPoolConstants::DEFAULT_VM_REGION_MAX_SIZE));
+    vmRegions[1] = std::make_unique<VMRegion>(PageSizeClass::PAGE_256KB, spillableRegionSize);
+    evictionPolicy = EvictionPolicy::create(evictionPolicyType, bufferPoolSize);
 }
 
 // Important Note: Pin returns a raw pointer to the frame. This is potentially very dangerous and
@@ -88,6 +284,9 @@ BufferManager::BufferManager(uint64_t bufferPoolSize)
 // both get access to the same piece of memory.
 uint8_t* BufferManager::pin(
     BMFileHandle& fileHandle, page_idx_t pageIdx, PageReadPolicy pageReadPolicy) {
+    if (fileHandle.isPageMMapped(pageIdx)) {
+        return fileHandle.getMMappedPage(pageIdx);
+    }
     auto pageState = fileHandle.getPageState(pageIdx);
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
@@ -175,6 +374,10 @@ inline bool try_func(const std::function<void(uint8_t*)>& func, uint8_t* frame,
 
 void BufferManager::optimisticRead(
     BMFileHandle& fileHandle, page_idx_t pageIdx, const std::function<void(uint8_t*)>& func) {
+    if (fileHandle.isPageMMapped(pageIdx)) {
+        func(fileHandle.getMMappedPage(pageIdx));
+        return;
+    }
     auto pageState = fileHandle.getPageState(pageIdx);
 #if defined(_WIN32)
     // Change the Structured Exception handling just for the scope of this function
@@ -214,11 +417,123 @@ void BufferManager::optimisticRead(
 }
 
 void BufferManager::unpin(BMFileHandle& fileHandle, page_idx_t pageIdx) {
+    if (fileHandle.isPageMMapped(pageIdx)) {
+        return;
+    }
     auto pageState = fileHandle.getPageState(pageIdx);
     pageState->unlock();
     addToEvictionQueue(&fileHandle, pageIdx, pageState);
 }
 
+void BufferManager::prefetch(
+    BMFileHandle& fileHandle, page_idx_t startPageIdx, page_idx_t numPages) {
+    auto endPageIdx = std::min<page_idx_t>(startPageIdx + numPages, fileHandle.getNumPages());
+    if (fileHandle.isPageMMapped(startPageIdx)) {
+        prefetchMMappedPages(fileHandle, startPageIdx, endPageIdx);
+        return;
+    }
+    // Locked pages of the current run are [pageIdx - numPagesInRun, pageIdx). A run is cut at
+    // page group boundaries, as frames are only guaranteed to be contiguous within a page group.
+    page_idx_t numPagesInRun = 0;
+    for (auto pageIdx = startPageIdx; pageIdx < endPageIdx; pageIdx++) {
+        if ((pageIdx & StorageConstants::PAGE_IDX_IN_GROUP_MASK) == 0) {
+            readPagesAsync(fileHandle, pageIdx - numPagesInRun, numPagesInRun);
+            numPagesInRun = 0;
+        }
+        if (tryLockAndClaimFrameForPrefetch(fileHandle, pageIdx)) {
+            numPagesInRun++;
+        } else {
+            readPagesAsync(fileHandle, pageIdx - numPagesInRun, numPagesInRun);
+            numPagesInRun = 0;
+        }
+    }
+    readPagesAsync(fileHandle, endPageIdx - numPagesInRun, numPagesInRun);
+}
+
+void BufferManager::prefetchMMappedPages(
+    BMFileHandle& fileHandle, page_idx_t startPageIdx, page_idx_t endPageIdx) {
+#if !defined(_WIN32)
+    // The pages of a mapped file are in the OS page cache, so we only ask the OS to read ahead.
+    endPageIdx = std::min(endPageIdx, fileHandle.numMMappedPages);
+    auto numBytes = (uint64_t)(endPageIdx - startPageIdx) * fileHandle.getPageSize();
+    madvise(fileHandle.getMMappedPage(startPageIdx), numBytes, MADV_WILLNEED);
+#else
+    (void)fileHandle;
+    (void)startPageIdx;
+    (void)endPageIdx;
+#endif
+}
+
+bool BufferManager::tryLockAndClaimFrameForPrefetch(BMFileHandle& fileHandle, page_idx_t pageIdx) {
+    auto pageSize = fileHandle.getPageSize();
+    if (prefetchMemoryInFlight.load() + pageSize >
+        bufferPoolSize.load() * BufferPoolConstants::MAX_PREFETCH_MEM_RATIO) {
+        return false;
+    }
+    auto pageState = fileHandle.getPageState(pageIdx);
+    auto currStateAndVersion = pageState->getStateAndVersion();
+    if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+        !pageState->tryLock(currStateAndVersion)) {
+        return false;
+    }
+    // The eviction policy is told about the page once it has been read.
+    if (!reserveMemoryForPage(fileHandle)) {
+        pageState->resetToEvicted();
+        return false;
+    }
+    pageState->clearDirty();
+    prefetchMemoryInFlight += pageSize;
+    return true;
+}
+
+// The pages are LOCKED and have their frames claimed. The read is handed to the prefetch thread
+// pool, which unpins the pages once they are read, or evicts them again if the read fails.
+void BufferManager::readPagesAsync(
+    BMFileHandle& fileHandle, page_idx_t startPageIdx, page_idx_t numPages) {
+    if (numPages == 0) {
+        return;
+    }
+    std::call_once(prefetchPoolInitFlag, [&]() {
+        prefetchPool = std::make_unique<PrefetchThreadPool>(BufferPoolConstants::NUM_IO_THREADS);
+    });
+    // Page states and frames are looked up here rather than in the I/O thread, because
+    // `pageStates` and `frameGroupIdxes` can be concurrently resized by writers of the file.
+    std::vector<PageState*> pageStates(numPages);
+    for (auto i = 0u; i < numPages; i++) {
+        pageStates[i] = fileHandle.getPageState(startPageIdx + i);
+    }
+    auto startFrameIdx = fileHandle.getFrameIdx(startPageIdx);
+    fileHandle.numPrefetchesInFlight++;
+    prefetchPool->submit([this, &fileHandle, pageStates = std::move(pageStates), startFrameIdx,
+                             startPageIdx, numPages]() {
+        auto& vmRegion = *vmRegions[fileHandle.getPageSizeClass()];
+        auto pageSize = fileHandle.getPageSize();
+        auto readSucceeded = true;
+        try {
+            fileHandle.getFileInfo()->readFromFile(vmRegion.getFrame(startFrameIdx),
+                (uint64_t)numPages * pageSize, (uint64_t)startPageIdx * pageSize);
+        } catch (std::exception&) {
+            readSucceeded = false;
+        }
+        if (readSucceeded) {
+            fileHandle.numPagesRead.fetch_add(numPages, std::memory_order_relaxed);
+        }
+        for (auto i = 0u; i < numPages; i++) {
+            if (readSucceeded) {
+                evictionPolicy->onPageCached(fileHandle, startPageIdx + i, *pageStates[i]);
+                pageStates[i]->unlock();
+                addToEvictionQueue(&fileHandle, startPageIdx + i, pageStates[i]);
+            } else {
+                vmRegion.releaseFrame(startFrameIdx + i);
+                freeUsedMemory(pageSize);
+                pageStates[i]->resetToEvicted();
+            }
+        }
+        prefetchMemoryInFlight -= (uint64_t)numPages * pageSize;
+        fileHandle.numPrefetchesInFlight--;
+    });
+}
+
 // This function tries to load the given page into a frame. Due to our design of mmap, each page is
 // uniquely mapped to a frame. Thus, claiming a frame is equivalent to ensuring enough physical
 // memory is available.
@@ -229,6 +544,15 @@ void BufferManager::unpin(BMFileHandle& fileHandle, page_idx_t pageIdx) {
 // and return false, otherwise, we load the page to its corresponding frame and return true.
 bool BufferManager::claimAFrame(
     BMFileHandle& fileHandle, page_idx_t pageIdx, PageReadPolicy pageReadPolicy) {
+    if (!reserveMemoryForPage(fileHandle)) {
+        return false;
+    }
+    // Have enough memory available now, load the page into its corresponding frame.
+    cachePageIntoFrame(fileHandle, pageIdx, pageReadPolicy);
+    return true;
+}
+
+bool BufferManager::reserveMemoryForPage(BMFileHandle& fileHandle) {
     page_offset_t pageSizeToClaim = fileHandle.getPageSize();
     // Reserve the memory for the page.
     auto currentUsedMem = reserveUsedMemory(pageSizeToClaim);
@@ -236,23 +560,19 @@ bool BufferManager::claimAFrame(
     // Evict pages if necessary until we have enough memory.
     while ((currentUsedMem + pageSizeToClaim - claimedMemory) > bufferPoolSize.load()) {
         EvictionCandidate evictionCandidate;
-        if (!evictionQueue->dequeue(evictionCandidate)) {
+        if (!evictionPolicy->getNextCandidateToEvict(evictionCandidate)) {
             // Cannot find more pages to be evicted. Free the memory we reserved and return false.
             freeUsedMemory(pageSizeToClaim);
             return false;
         }
-        auto pageStateAndVersion = evictionCandidate.pageState->getStateAndVersion();
-        if (!evictionCandidate.isEvictable(pageStateAndVersion)) {
-            if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
-                evictionCandidate.pageState->tryMark(pageStateAndVersion);
-                evictionQueue->enqueue(evictionCandidate);
-            }
-            continue;
-        }
         // We found a page that potentially hasn't been accessed since enqueued. We try to evict the
         // page from its frame by calling `tryEvictPage`, which will check if the page's version has
         // changed, if not, we evict the page from its frame.
-        claimedMemory += tryEvictPage(evictionCandidate);
+        auto numBytesFreed = tryEvictPage(evictionCandidate);
+        if (numBytesFreed > 0) {
+            evictionPolicy->onPageEvicted(evictionCandidate);
+        }
+        claimedMemory += numBytesFreed;
         currentUsedMem = usedMemory.load();
     }
     if ((currentUsedMem + pageSizeToClaim - claimedMemory) > bufferPoolSize.load()) {
@@ -260,8 +580,6 @@ bool BufferManager::claimAFrame(
         freeUsedMemory(pageSizeToClaim);
         return false;
     }
-    // Have enough memory available now, load the page into its corresponding frame.
-    cachePageIntoFrame(fileHandle, pageIdx, pageReadPolicy);
     freeUsedMemory(claimedMemory);
     return true;
 }
@@ -269,12 +587,8 @@ bool BufferManager::claimAFrame(
 void BufferManager::addToEvictionQueue(
     BMFileHandle* fileHandle, page_idx_t pageIdx, PageState* pageState) {
     auto currStateAndVersion = pageState->getStateAndVersion();
-    if (++numEvictionQueueInsertions == BufferPoolConstants::EVICTION_QUEUE_PURGING_INTERVAL) {
-        evictionQueue->removeNonEvictableCandidates();
-        numEvictionQueueInsertions = 0;
-    }
     pageState->tryMark(currStateAndVersion);
-    evictionQueue->enqueue(
+    evictionPolicy->enqueue(
         fileHandle, pageIdx, pageState, PageState::getVersion(currStateAndVersion));
 }
 
@@ -299,9 +613,11 @@ void BufferManager::cachePageIntoFrame(
     BMFileHandle& fileHandle, page_idx_t pageIdx, PageReadPolicy pageReadPolicy) {
     auto pageState = fileHandle.getPageState(pageIdx);
     pageState->clearDirty();
+    evictionPolicy->onPageCached(fileHandle, pageIdx, *pageState);
     if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
         fileHandle.getFileInfo()->readFromFile((void*)getFrame(fileHandle, pageIdx),
             fileHandle.getPageSize(), pageIdx * fileHandle.getPageSize());
+        fileHandle.numPagesRead.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
@@ -314,7 +630,8 @@ void BufferManager::flushIfDirtyWithoutLock(BMFileHandle& fileHandle, page_idx_t
 }
 
 void BufferManager::removeFilePagesFromFrames(BMFileHandle& fileHandle) {
-    evictionQueue->removeCandidatesForFile(fileHandle);
+    fileHandle.waitForPrefetchesToFinish();
+    evictionPolicy->removeCandidatesForFile(fileHandle);
     for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); ++pageIdx) {
         removePageFromFrame(fileHandle, pageIdx, false /* do not flush */);
     }
@@ -328,6 +645,7 @@ void BufferManager::flushAllDirtyPagesInFrames(BMFileHandle& fileHandle) {
 
 void BufferManager::updateFrameIfPageIsInFrameWithoutLock(
     BMFileHandle& fileHandle, uint8_t* newPage, page_idx_t pageIdx) {
+    fileHandle.waitForPrefetchesToFinish();
     auto pageState = fileHandle.getPageState(pageIdx);
     if (pageState) {
         memcpy(getFrame(fileHandle, pageIdx), newPage, BufferPoolConstants::PAGE_4KB_SIZE);
@@ -345,11 +663,17 @@ void BufferManager::removePageFromFrameIfNecessary(BMFileHandle& fileHandle, pag
 void BufferManager::removePageFromFrame(
     BMFileHandle& fileHandle, page_idx_t pageIdx, bool shouldFlush) {
     auto pageState = fileHandle.getPageState(pageIdx);
-    pageState->spinLock(pageState->getStateAndVersion());
+    auto stateAndVersion = pageState->getStateAndVersion();
+    while (!pageState->tryLock(stateAndVersion)) {
+        stateAndVersion = pageState->getStateAndVersion();
+    }
     if (shouldFlush) {
         flushIfDirtyWithoutLock(fileHandle, pageIdx);
     }
     releaseFrameForPage(fileHandle, pageIdx);
+    if (PageState::getState(stateAndVersion) != PageState::EVICTED) {
+        freeUsedMemory(fileHandle.getPageSize());
+    }
     pageState->resetToEvicted();
 }
 
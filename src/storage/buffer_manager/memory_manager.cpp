@@ -1,7 +1,10 @@
 #include "storage/buffer_manager/memory_manager.h"
 
+#include <fcntl.h>
+
 #include <cstring>
 
+#include "common/file_system/virtual_file_system.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::common;
@@ -10,21 +13,41 @@ namespace kuzu {
 namespace storage {
 
 MemoryBuffer::MemoryBuffer(MemoryAllocator* allocator, page_idx_t pageIdx, uint8_t* buffer)
-    : buffer{buffer}, pageIdx{pageIdx}, allocator{allocator} {}
+    : buffer{buffer}, pageIdx{pageIdx}, allocator{allocator}, isSpilled{false} {}
 
 MemoryBuffer::~MemoryBuffer() {
     if (buffer != nullptr) {
-        allocator->freeBlock(pageIdx);
+        allocator->freeBlock(pageIdx, isSpilled);
     }
 }
 
-MemoryAllocator::MemoryAllocator(BufferManager* bm, VirtualFileSystem* vfs) : bm{bm} {
+void MemoryBuffer::spill() {
+    KU_ASSERT(!isSpilled);
+    allocator->spillBlock(pageIdx, buffer);
+    isSpilled = true;
+}
+
+void MemoryBuffer::reload() {
+    KU_ASSERT(isSpilled);
+    [[maybe_unused]] auto reloadedBuffer = allocator->reloadBlock(pageIdx);
+    KU_ASSERT(reloadedBuffer == buffer);
+    isSpilled = false;
+}
+
+MemoryAllocator::MemoryAllocator(
+    BufferManager* bm, VirtualFileSystem* vfs, std::string spillFilePath)
+    : bm{bm}, vfs{vfs}, spillFilePath{std::move(spillFilePath)}, numUsedPages{0} {
     pageSize = BufferPoolConstants::PAGE_256KB_SIZE;
     fh = bm->getBMFileHandle("mm-256KB", FileHandle::O_IN_MEM_TEMP_FILE,
         BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs, PAGE_256KB);
 }
 
-MemoryAllocator::~MemoryAllocator() = default;
+MemoryAllocator::~MemoryAllocator() {
+    if (spillFileInfo != nullptr) {
+        spillFileInfo.reset();
+        vfs->removeFileIfExists(spillFilePath);
+    }
+}
 
 std::unique_ptr<MemoryBuffer> MemoryAllocator::allocateBuffer(bool initializeToZero) {
     std::unique_lock<std::mutex> lock(allocatorLock);
@@ -36,6 +59,7 @@ std::unique_ptr<MemoryBuffer> MemoryAllocator::allocateBuffer(bool initializeToZ
         freePages.pop();
     }
     auto buffer = bm->pin(*fh, pageIdx, BufferManager::PageReadPolicy::DONT_READ_PAGE);
+    numUsedPages++;
     auto memoryBuffer = std::make_unique<MemoryBuffer>(this, pageIdx, buffer);
     if (initializeToZero) {
         memset(memoryBuffer->buffer, 0, pageSize);
@@ -43,11 +67,39 @@ std::unique_ptr<MemoryBuffer> MemoryAllocator::allocateBuffer(bool initializeToZ
     return memoryBuffer;
 }
 
-void MemoryAllocator::freeBlock(page_idx_t pageIdx) {
+void MemoryAllocator::freeBlock(page_idx_t pageIdx, bool isSpilled) {
     std::unique_lock<std::mutex> lock(allocatorLock);
-    bm->unpin(*fh, pageIdx);
+    if (!isSpilled) {
+        bm->unpin(*fh, pageIdx);
+        numUsedPages--;
+    }
     freePages.push(pageIdx);
 }
 
+void MemoryAllocator::spillBlock(page_idx_t pageIdx, const uint8_t* buffer) {
+    KU_ASSERT(canSpill());
+    std::unique_lock<std::mutex> lock(allocatorLock);
+    if (spillFileInfo == nullptr) {
+        spillFileInfo = vfs->openFile(spillFilePath, O_CREAT | O_RDWR);
+    }
+    lock.unlock();
+    spillFileInfo->writeFile(buffer, pageSize, (uint64_t)pageIdx * pageSize);
+    bm->unpin(*fh, pageIdx);
+    numUsedPages--;
+}
+
+uint8_t* MemoryAllocator::reloadBlock(page_idx_t pageIdx) {
+    // The page may have been evicted, so its frame is claimed again without reading the in-mem
+    // file, and filled from the spill file instead.
+    auto buffer = bm->pin(*fh, pageIdx, BufferManager::PageReadPolicy::DONT_READ_PAGE);
+    numUsedPages++;
+    spillFileInfo->readFromFile(buffer, pageSize, (uint64_t)pageIdx * pageSize);
+    return buffer;
+}
+
+uint64_t MemoryManager::getSpillMemoryLimit() const {
+    return bm->getBufferPoolSize() * BufferPoolConstants::SPILL_MEMORY_RATIO;
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -1,7 +1,10 @@
 #include "storage/compression/compression.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "common/exception/not_implemented.h"
 #include "common/exception/storage.h"
@@ -48,7 +51,13 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
         return true;
     }
     case CompressionType::CONSTANT:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::FRAME_OF_REFERENCE:
+    case CompressionType::DELTA:
+    case CompressionType::ALP:
+    case CompressionType::FSST:
+    case CompressionType::RLE:
+    case CompressionType::NEIGHBOR_DELTA: {
         return false;
     }
     default: {
@@ -65,7 +74,13 @@ bool CompressionMetadata::canUpdateInPlace(
     switch (compression) {
     case CompressionType::CONSTANT: {
         // Value can be updated in place only if it is identical to the value already stored.
+        if (physicalType == PhysicalTypeID::INTERNAL_ID) {
+            // Only the offset of an internal ID is stored.
+            auto offset = reinterpret_cast<const internalID_t*>(data)[pos].offset;
+            return memcmp(&offset, this->data.data(), sizeof(offset)) == 0;
+        }
         auto size = PhysicalTypeUtils::getFixedTypeSize(physicalType);
+        KU_ASSERT(size <= DATA_SIZE);
         return memcmp(data + pos * size, this->data.data(), size) == 0;
     }
     case CompressionType::BOOLEAN_BITPACKING:
@@ -124,6 +139,68 @@ bool CompressionMetadata::canUpdateInPlace(
         }
         }
     }
+    case CompressionType::FRAME_OF_REFERENCE: {
+        auto header = BitpackHeader::readHeader(this->data);
+        switch (physicalType) {
+        case PhysicalTypeID::INT64: {
+            return IntegerFrameOfReference<int64_t>::canUpdateInPlace(
+                reinterpret_cast<const int64_t*>(data)[pos], header);
+        }
+        case PhysicalTypeID::INT32: {
+            return IntegerFrameOfReference<int32_t>::canUpdateInPlace(
+                reinterpret_cast<const int32_t*>(data)[pos], header);
+        }
+        case PhysicalTypeID::INT16: {
+            return IntegerFrameOfReference<int16_t>::canUpdateInPlace(
+                reinterpret_cast<const int16_t*>(data)[pos], header);
+        }
+        case PhysicalTypeID::INT8: {
+            return IntegerFrameOfReference<int8_t>::canUpdateInPlace(
+                reinterpret_cast<const int8_t*>(data)[pos], header);
+        }
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses frame of reference encoding but "
+                "does not have a supported integer physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
+    case CompressionType::DELTA: {
+        // Updating a value would change the decoding of all of the values after it.
+        return false;
+    }
+    case CompressionType::FSST: {
+        // Values are only ever written compressed when the whole chunk is flushed.
+        return false;
+    }
+    case CompressionType::RLE: {
+        // Changing a value may split a run, which the page may not have space for.
+        return false;
+    }
+    case CompressionType::NEIGHBOR_DELTA: {
+        // Updating an offset would change the decoding of the offset after it.
+        return false;
+    }
+    case CompressionType::ALP: {
+        auto header = ALPHeader::readHeader(this->data);
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>::canUpdateInPlace(
+                reinterpret_cast<const double*>(data)[pos], header);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>::canUpdateInPlace(
+                reinterpret_cast<const float*>(data)[pos], header);
+        }
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP compression but does not "
+                "have a supported floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -136,9 +213,18 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
     case CompressionType::CONSTANT: {
         return std::numeric_limits<uint64_t>::max();
     }
+    case CompressionType::FSST:
     case CompressionType::UNCOMPRESSED: {
         return Uncompressed::numValues(pageSize, dataType);
     }
+    case CompressionType::RLE: {
+        KU_ASSERT(pageSize == BufferPoolConstants::PAGE_4KB_SIZE);
+        return RunLengthEncoding<int64_t>::numValues(*this);
+    }
+    case CompressionType::NEIGHBOR_DELTA: {
+        return NeighborListDelta::numValues(pageSize, NeighborListHeader::readHeader(data));
+    }
+    case CompressionType::FRAME_OF_REFERENCE:
     case CompressionType::INTEGER_BITPACKING: {
         switch (dataType.getPhysicalType()) {
         case PhysicalTypeID::INT64:
@@ -170,6 +256,40 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
         }
         }
     }
+    case CompressionType::DELTA: {
+        auto header = BitpackHeader::readHeader(data);
+        switch (dataType.getPhysicalType()) {
+        case PhysicalTypeID::INT64:
+            return IntegerDelta<int64_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INT32:
+            return IntegerDelta<int32_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INT16:
+            return IntegerDelta<int16_t>::numValues(pageSize, header);
+        case PhysicalTypeID::INT8:
+            return IntegerDelta<int8_t>::numValues(pageSize, header);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses delta encoding but does not "
+                "have a supported integer physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(dataType.getPhysicalType()));
+        }
+        }
+    }
+    case CompressionType::ALP: {
+        auto header = ALPHeader::readHeader(data);
+        switch (dataType.getPhysicalType()) {
+        case PhysicalTypeID::DOUBLE:
+            return FloatCompression<double>::numValues(pageSize, header);
+        case PhysicalTypeID::FLOAT:
+            return FloatCompression<float>::numValues(pageSize, header);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses ALP compression but does not "
+                "have a supported floating point physical type: " +
+                PhysicalTypeUtils::physicalTypeToString(dataType.getPhysicalType()));
+        }
+        }
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
@@ -257,6 +377,29 @@ std::string CompressionMetadata::toString() const {
     case CompressionType::CONSTANT: {
         return "CONSTANT";
     }
+    case CompressionType::FRAME_OF_REFERENCE: {
+        auto header = BitpackHeader::readHeader(data);
+        return "FRAME_OF_REFERENCE[" + std::to_string(header.bitWidth) + "]";
+    }
+    case CompressionType::DELTA: {
+        auto header = BitpackHeader::readHeader(data);
+        return "DELTA[" + std::to_string(header.bitWidth) + "]";
+    }
+    case CompressionType::ALP: {
+        auto header = ALPHeader::readHeader(data);
+        return "ALP[" + std::to_string(header.exponent) + ", " + std::to_string(header.bitWidth) +
+               "]";
+    }
+    case CompressionType::FSST: {
+        return "FSST";
+    }
+    case CompressionType::RLE: {
+        return "RLE[" + std::to_string(RunLengthEncoding<int64_t>::numValues(*this)) + "]";
+    }
+    case CompressionType::NEIGHBOR_DELTA: {
+        auto header = NeighborListHeader::readHeader(data);
+        return "NEIGHBOR_DELTA[" + std::to_string(header.bitWidth) + "]";
+    }
     default: {
         KU_UNREACHABLE;
     }
@@ -534,6 +677,709 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+template<typename T>
+CompressionMetadata IntegerFrameOfReference<T>::getCompressionMetadata(
+    const uint8_t* srcBuffer, uint64_t numValues) const {
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    T min = numValues == 0 ? 0 : values[0], max = min;
+    for (auto i = 1u; i < numValues; i++) {
+        min = std::min(min, values[i]);
+        max = std::max(max, values[i]);
+    }
+    // The difference is computed using unsigned arithmetic since it may not fit in T
+    auto bitWidth = static_cast<uint8_t>(std::bit_width((U)((U)max - (U)min)));
+    if (bitWidth >= sizeof(T) * 8) {
+        // Nothing to gain, and the differences from the minimum would no longer fit in T.
+        return IntegerBitpacking<T>::getCompressionMetadata(srcBuffer, numValues);
+    }
+    BitpackHeader header{bitWidth, false /*hasNegative*/, (uint64_t)min};
+    return CompressionMetadata{CompressionType::FRAME_OF_REFERENCE, header.getData()};
+}
+
+template<typename T>
+bool IntegerFrameOfReference<T>::canUpdateInPlace(T value, const BitpackHeader& header) {
+    auto offset = (T)header.offset;
+    return value >= offset && std::bit_width((U)((U)value - (U)offset)) <= header.bitWidth;
+}
+
+template class IntegerFrameOfReference<int8_t>;
+template class IntegerFrameOfReference<int16_t>;
+template class IntegerFrameOfReference<int32_t>;
+template class IntegerFrameOfReference<int64_t>;
+
+template<typename T>
+CompressionMetadata IntegerDelta<T>::getCompressionMetadata(
+    const uint8_t* srcBuffer, uint64_t numValues) const {
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    // Differences are computed using unsigned arithmetic to avoid overflows. Since the smallest
+    // difference is subtracted from all of them, the result is the same as with infinite precision.
+    T minDelta = std::numeric_limits<T>::max();
+    for (auto i = 1u; i < numValues; i++) {
+        minDelta = std::min(minDelta, (T)((U)values[i] - (U)values[i - 1]));
+    }
+    U maxAdjustedDelta = 0;
+    for (auto i = 1u; i < numValues; i++) {
+        maxAdjustedDelta = std::max(
+            maxAdjustedDelta, (U)((U)values[i] - (U)values[i - 1] - (U)minDelta));
+    }
+    if (numValues < 2) {
+        minDelta = 0;
+    }
+    BitpackHeader header{static_cast<uint8_t>(std::bit_width(maxAdjustedDelta)),
+        false /*hasNegative*/, (uint64_t)minDelta};
+    return CompressionMetadata{CompressionType::DELTA, header.getData()};
+}
+
+template<typename T>
+uint64_t IntegerDelta<T>::compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+    uint8_t* dstBuffer, uint64_t dstBufferSize, const struct CompressionMetadata& metadata) const {
+    auto header = BitpackHeader::readHeader(metadata.data);
+    auto bitWidth = header.bitWidth;
+    auto minDelta = (U)header.offset;
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(dstBufferSize, header));
+    KU_ASSERT(dstBufferSize >= sizeof(T) + CHUNK_SIZE * bitWidth / 8);
+    memcpy(dstBuffer, values, sizeof(T));
+    if (bitWidth > 0) {
+        // The first difference in each page is unused, since the first value is stored as-is.
+        U tmp[CHUNK_SIZE];
+        auto packedBuffer = dstBuffer + sizeof(T);
+        for (uint64_t i = 0; i < numValuesToCompress; i += CHUNK_SIZE) {
+            auto numValuesInChunk = std::min(CHUNK_SIZE, numValuesToCompress - i);
+            for (auto j = 0u; j < numValuesInChunk; j++) {
+                tmp[j] = i + j == 0 ? 0 : (U)((U)values[i + j] - (U)values[i + j - 1] - minDelta);
+            }
+            std::fill(tmp + numValuesInChunk, tmp + CHUNK_SIZE, 0);
+            fastpack(tmp, packedBuffer + i * bitWidth / 8, bitWidth);
+        }
+    }
+    srcBuffer += numValuesToCompress * sizeof(T);
+    // Round up to nearest byte
+    return sizeof(T) + numValuesToCompress * bitWidth / 8 +
+           (numValuesToCompress * bitWidth % 8 != 0);
+}
+
+template<typename T>
+void IntegerDelta<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    auto header = BitpackHeader::readHeader(metadata.data);
+    auto minDelta = (U)header.offset;
+    U value;
+    memcpy(&value, srcBuffer, sizeof(T));
+    auto result = reinterpret_cast<U*>(dstBuffer) + dstOffset;
+    if (header.bitWidth == 0) {
+        for (auto i = 0u; i < numValues; i++) {
+            result[i] = (U)(value + (U)(srcOffset + i) * minDelta);
+        }
+        return;
+    }
+    // Every value depends on all of the values before it in the page, so decoding always starts
+    // from the beginning of the page.
+    auto packedBuffer = srcBuffer + sizeof(T);
+    auto endOffset = srcOffset + numValues;
+    U chunk[CHUNK_SIZE];
+    for (uint64_t chunkStart = 0; chunkStart < endOffset; chunkStart += CHUNK_SIZE) {
+        fastunpack(packedBuffer + chunkStart * header.bitWidth / 8, chunk, header.bitWidth);
+        auto chunkEnd = std::min(chunkStart + CHUNK_SIZE, endOffset);
+        for (auto pos = chunkStart; pos < chunkEnd; pos++) {
+            if (pos > 0) {
+                value += chunk[pos - chunkStart] + minDelta;
+            }
+            if (pos >= srcOffset) {
+                result[pos - srcOffset] = value;
+            }
+        }
+    }
+}
+
+template class IntegerDelta<int8_t>;
+template class IntegerDelta<int16_t>;
+template class IntegerDelta<int32_t>;
+template class IntegerDelta<int64_t>;
+
+// Returns the largest number of runs in any page if each page holds 2^log2ValuesPerPage values.
+static uint64_t getMaxRunsPerPage(
+    const std::vector<uint64_t>& runStarts, uint8_t log2ValuesPerPage) {
+    uint64_t maxRuns = 1, numRuns = 1, currentPage = 0;
+    for (auto runStart : runStarts) {
+        auto page = runStart >> log2ValuesPerPage;
+        if (page != currentPage) {
+            currentPage = page;
+            numRuns = 1;
+        }
+        // A run starting at the beginning of a page is the page's first run, which is already
+        // counted.
+        if (runStart & ((1ull << log2ValuesPerPage) - 1)) {
+            numRuns++;
+        }
+        maxRuns = std::max(maxRuns, numRuns);
+    }
+    return maxRuns;
+}
+
+template<typename T>
+CompressionMetadata RunLengthEncoding<T>::getCompressionMetadata(
+    const uint8_t* srcBuffer, uint64_t numValues) const {
+    static constexpr uint8_t MAX_LOG2_VALUES_PER_PAGE =
+        std::bit_width(MAX_NUM_VALUES_PER_PAGE) - 1;
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    std::vector<uint64_t> runStarts;
+    for (auto i = 1u; i < numValues; i++) {
+        if (values[i] != values[i - 1]) {
+            runStarts.push_back(i);
+        }
+    }
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> data{};
+    if (runStarts.size() + 1 <= MAX_RUNS_PER_PAGE) {
+        // Every page has space for all of the runs.
+        data[0] = MAX_LOG2_VALUES_PER_PAGE;
+        return CompressionMetadata(CompressionType::RLE, data);
+    }
+    // A single page can't hold all of the values, so start from the largest power of two below the
+    // number of values and halve the values per page until every page has space for its runs.
+    // This always terminates, since a page with at most MAX_RUNS_PER_PAGE values can't have more
+    // runs than that.
+    uint8_t log2ValuesPerPage =
+        std::min<uint64_t>(std::bit_width(numValues) - 1, MAX_LOG2_VALUES_PER_PAGE);
+    while (getMaxRunsPerPage(runStarts, log2ValuesPerPage) > MAX_RUNS_PER_PAGE) {
+        log2ValuesPerPage--;
+    }
+    data[0] = log2ValuesPerPage;
+    return CompressionMetadata(CompressionType::RLE, data);
+}
+
+template<typename T>
+uint64_t RunLengthEncoding<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, [[maybe_unused]] uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(metadata));
+    uint64_t numRuns = numValuesToCompress > 0;
+    for (auto i = 1u; i < numValuesToCompress; i++) {
+        numRuns += values[i] != values[i - 1];
+    }
+    auto compressedSize = getRunEndsStart(numRuns) + numRuns * sizeof(run_end_t);
+    KU_ASSERT(numRuns <= MAX_RUNS_PER_PAGE && compressedSize <= dstBufferSize);
+    memcpy(dstBuffer, &numRuns, sizeof(numRuns));
+    auto runValues = reinterpret_cast<T*>(dstBuffer + HEADER_SIZE);
+    auto runEnds = reinterpret_cast<run_end_t*>(dstBuffer + getRunEndsStart(numRuns));
+    uint64_t run = 0;
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        if (i > 0 && values[i] != values[i - 1]) {
+            runEnds[run++] = i;
+        }
+        runValues[run] = values[i];
+    }
+    if (numRuns > 0) {
+        runEnds[run] = numValuesToCompress;
+    }
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return compressedSize;
+}
+
+template<typename T>
+void RunLengthEncoding<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& /*metadata*/) const {
+    uint64_t numRuns;
+    memcpy(&numRuns, srcBuffer, sizeof(numRuns));
+    auto runValues = reinterpret_cast<const T*>(srcBuffer + HEADER_SIZE);
+    auto runEnds = reinterpret_cast<const run_end_t*>(srcBuffer + getRunEndsStart(numRuns));
+    auto result = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    // Each run is written out as a whole instead of decoding values one at a time.
+    auto run = std::upper_bound(runEnds, runEnds + numRuns, srcOffset) - runEnds;
+    auto pos = srcOffset;
+    for (; pos < srcOffset + numValues && (uint64_t)run < numRuns; run++) {
+        auto runEnd = std::min<uint64_t>(runEnds[run], srcOffset + numValues);
+        std::fill(result, result + (runEnd - pos), runValues[run]);
+        result += runEnd - pos;
+        pos = runEnd;
+    }
+    // Values past the last run were never written to the page (e.g. nulls appended to the chunk
+    // after it was flushed), so their content doesn't matter.
+    std::fill(result, result + (srcOffset + numValues - pos), T{});
+}
+
+template class RunLengthEncoding<int8_t>;
+template class RunLengthEncoding<int16_t>;
+template class RunLengthEncoding<int32_t>;
+template class RunLengthEncoding<int64_t>;
+template class RunLengthEncoding<uint8_t>;
+template class RunLengthEncoding<uint16_t>;
+template class RunLengthEncoding<uint32_t>;
+template class RunLengthEncoding<uint64_t>;
+
+std::array<uint8_t, CompressionMetadata::DATA_SIZE> NeighborListHeader::getData() const {
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> data = {};
+    data[0] = bitWidth;
+    memcpy(&data[1], &exceptionCapacity, sizeof(exceptionCapacity));
+    return data;
+}
+
+NeighborListHeader NeighborListHeader::readHeader(
+    const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data) {
+    NeighborListHeader header;
+    header.bitWidth = data[0];
+    memcpy(&header.exceptionCapacity, &data[1], sizeof(header.exceptionCapacity));
+    return header;
+}
+
+// Maps differences of small magnitude to small unsigned integers (0, -1, 1, -2, ... to 0, 1, 2,
+// 3, ...).
+static inline uint64_t zigzagEncode(uint64_t delta) {
+    return (delta << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(delta) >> 63);
+}
+
+static inline uint64_t zigzagDecode(uint64_t value) {
+    return (value >> 1) ^ (~(value & 1) + 1);
+}
+
+uint64_t NeighborListDelta::numValues(uint64_t dataSize, const NeighborListHeader& header) {
+    KU_ASSERT(header.bitWidth > 0);
+    auto packedDataStart = getPackedDataStart(header);
+    if (dataSize <= packedDataStart) {
+        return 0;
+    }
+    auto numValues = (dataSize - packedDataStart) * 8 / header.bitWidth;
+    // Keeping the restart positions at the same place in every page means that they never need
+    // to be searched for.
+    numValues -= numValues % RESTART_INTERVAL;
+    return std::min(numValues, MAX_NUM_VALUES_PER_PAGE);
+}
+
+CompressionMetadata NeighborListDelta::getCompressionMetadata(
+    const uint8_t* srcBuffer, uint64_t numValues) const {
+    auto values = reinterpret_cast<const offset_t*>(srcBuffer);
+    // Offsets at restart positions are always exceptions. Of the others, count how many need each
+    // number of bits for their difference.
+    std::array<uint64_t, 65> numValuesByBitWidth{};
+    for (auto i = 0u; i < numValues; i++) {
+        if (i % RESTART_INTERVAL != 0) {
+            numValuesByBitWidth[std::bit_width(zigzagEncode(values[i] - values[i - 1]))]++;
+        }
+    }
+    // Choose the bit width which minimizes the total size, assuming that exceptions are spread
+    // evenly over the pages.
+    auto numExceptions = (numValues + RESTART_INTERVAL - 1) / RESTART_INTERVAL;
+    for (auto bitWidth = 2u; bitWidth < numValuesByBitWidth.size(); bitWidth++) {
+        numExceptions += numValuesByBitWidth[bitWidth];
+    }
+    uint8_t bestBitWidth = 1;
+    auto bestSize = UINT64_MAX;
+    for (uint8_t bitWidth = 1; bitWidth <= 64; bitWidth++) {
+        auto sizeInBits =
+            numValues * bitWidth + numExceptions * (sizeof(offset_t) + sizeof(uint16_t)) * 8;
+        if (sizeInBits < bestSize) {
+            bestSize = sizeInBits;
+            bestBitWidth = bitWidth;
+        }
+        if (bitWidth < 64) {
+            numExceptions -= numValuesByBitWidth[bitWidth + 1];
+        }
+    }
+    NeighborListHeader header{bestBitWidth, 0 /*exceptionCapacity*/};
+    // Reserve enough space for exceptions in every page. Reserving space reduces the number of
+    // values per page, so repeat until the capacity is sufficient.
+    while (true) {
+        auto numValuesPerPage = this->numValues(BufferPoolConstants::PAGE_4KB_SIZE, header);
+        if (numValuesPerPage == 0) {
+            return CompressionMetadata();
+        }
+        uint64_t maxExceptionsPerPage = 0;
+        for (uint64_t pageStart = 0; pageStart < numValues; pageStart += numValuesPerPage) {
+            auto pageEnd = std::min(pageStart + numValuesPerPage, numValues);
+            uint64_t numExceptionsInPage = 0;
+            for (auto i = pageStart; i < pageEnd; i++) {
+                numExceptionsInPage +=
+                    i % RESTART_INTERVAL == 0 ||
+                    std::bit_width(zigzagEncode(values[i] - values[i - 1])) > header.bitWidth;
+            }
+            maxExceptionsPerPage = std::max(maxExceptionsPerPage, numExceptionsInPage);
+        }
+        if (maxExceptionsPerPage <= header.exceptionCapacity) {
+            break;
+        }
+        if (maxExceptionsPerPage > UINT16_MAX) {
+            return CompressionMetadata();
+        }
+        header.exceptionCapacity = static_cast<uint16_t>(maxExceptionsPerPage);
+    }
+    return CompressionMetadata(CompressionType::NEIGHBOR_DELTA, header.getData());
+}
+
+uint64_t NeighborListDelta::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    auto header = NeighborListHeader::readHeader(metadata.data);
+    auto values = reinterpret_cast<const offset_t*>(srcBuffer);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(dstBufferSize, header));
+    auto packedData = dstBuffer + getPackedDataStart(header);
+    auto exceptionValues = dstBuffer + HEADER_SIZE;
+    auto exceptionPositions = exceptionValues + header.exceptionCapacity * sizeof(offset_t);
+    uint16_t numExceptions = 0;
+    uint64_t chunk[CHUNK_SIZE];
+    for (uint64_t i = 0; i < numValuesToCompress; i += CHUNK_SIZE) {
+        auto numValuesInChunk = std::min(CHUNK_SIZE, numValuesToCompress - i);
+        for (auto j = 0u; j < numValuesInChunk; j++) {
+            auto pos = i + j;
+            chunk[j] =
+                pos % RESTART_INTERVAL == 0 ? 0 : zigzagEncode(values[pos] - values[pos - 1]);
+            if (pos % RESTART_INTERVAL == 0 || std::bit_width(chunk[j]) > header.bitWidth) {
+                KU_ASSERT(numExceptions < header.exceptionCapacity);
+                auto posInPage = static_cast<uint16_t>(pos);
+                memcpy(exceptionValues + numExceptions * sizeof(offset_t), &values[pos],
+                    sizeof(offset_t));
+                memcpy(exceptionPositions + numExceptions * sizeof(uint16_t), &posInPage,
+                    sizeof(posInPage));
+                numExceptions++;
+                chunk[j] = 0;
+            }
+        }
+        std::fill(chunk + numValuesInChunk, chunk + CHUNK_SIZE, 0);
+        fastpack(chunk, packedData + i * header.bitWidth / 8, header.bitWidth);
+    }
+    memcpy(dstBuffer, &numExceptions, sizeof(numExceptions));
+    srcBuffer += numValuesToCompress * sizeof(offset_t);
+    // Round up to nearest byte
+    return getPackedDataStart(header) + numValuesToCompress * header.bitWidth / 8 +
+           (numValuesToCompress * header.bitWidth % 8 != 0);
+}
+
+void NeighborListDelta::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    if (numValues == 0) {
+        return;
+    }
+    auto header = NeighborListHeader::readHeader(metadata.data);
+    auto packedData = srcBuffer + getPackedDataStart(header);
+    auto exceptionValues = srcBuffer + HEADER_SIZE;
+    auto exceptionPositions = exceptionValues + header.exceptionCapacity * sizeof(offset_t);
+    uint16_t numExceptions;
+    memcpy(&numExceptions, srcBuffer, sizeof(numExceptions));
+    auto getExceptionPosition = [&](uint64_t exceptionIdx) {
+        uint16_t pos;
+        memcpy(&pos, exceptionPositions + exceptionIdx * sizeof(uint16_t), sizeof(pos));
+        return (uint64_t)pos;
+    };
+    // Decoding starts from the last exception at or before srcOffset. There is always one, since
+    // the first value in the page is an exception.
+    uint64_t low = 0, high = numExceptions;
+    while (low < high) {
+        auto mid = (low + high) / 2;
+        if (getExceptionPosition(mid) <= srcOffset) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    KU_ASSERT(low > 0);
+    auto exceptionIdx = low - 1;
+    auto startPos = getExceptionPosition(exceptionIdx);
+    offset_t value;
+    memcpy(&value, exceptionValues + exceptionIdx * sizeof(offset_t), sizeof(offset_t));
+    exceptionIdx++;
+    auto nextExceptionPos =
+        exceptionIdx < numExceptions ? getExceptionPosition(exceptionIdx) : UINT64_MAX;
+    auto result = reinterpret_cast<offset_t*>(dstBuffer) + dstOffset;
+    if (startPos == srcOffset) {
+        result[0] = value;
+    }
+    auto endOffset = srcOffset + numValues;
+    uint64_t chunk[CHUNK_SIZE];
+    for (auto pos = startPos + 1; pos < endOffset; pos++) {
+        if (pos == startPos + 1 || pos % CHUNK_SIZE == 0) {
+            auto chunkStart = pos - pos % CHUNK_SIZE;
+            fastunpack(packedData + chunkStart * header.bitWidth / 8, chunk, header.bitWidth);
+        }
+        if (pos == nextExceptionPos) {
+            memcpy(&value, exceptionValues + exceptionIdx * sizeof(offset_t), sizeof(offset_t));
+            exceptionIdx++;
+            nextExceptionPos =
+                exceptionIdx < numExceptions ? getExceptionPosition(exceptionIdx) : UINT64_MAX;
+        } else {
+            value += zigzagDecode(chunk[pos % CHUNK_SIZE]);
+        }
+        if (pos >= srcOffset) {
+            result[pos - srcOffset] = value;
+        }
+    }
+}
+
+// Powers of ten which can be represented exactly as doubles
+static constexpr double POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+// Encoded integers must be exactly representable as doubles
+static constexpr double ALP_ENCODING_LIMIT = 9007199254740992.0; // 2^53
+static constexpr uint64_t ALP_SAMPLE_SIZE = 256;
+
+template<typename T>
+static constexpr uint8_t getMaxExponent() {
+    return std::is_same_v<T, float> ? 10 : 18;
+}
+
+template<typename T>
+static inline T decodeFloat(int64_t encoded, uint8_t exponent) {
+    // Division by an exact power of ten is correctly rounded, which is not true of multiplying by
+    // its (inexact) inverse.
+    return static_cast<T>(static_cast<double>(encoded) / POW10[exponent]);
+}
+
+template<typename T>
+static inline bool encodeFloat(T value, uint8_t exponent, int64_t& encoded) {
+    auto scaled = static_cast<double>(value) * POW10[exponent];
+    // Also rejects NaN and infinity
+    if (!(std::abs(scaled) < ALP_ENCODING_LIMIT)) {
+        return false;
+    }
+    encoded = std::llround(scaled);
+    auto decoded = decodeFloat<T>(encoded, exponent);
+    // Compare bits so that e.g. -0.0 is not stored as 0.0
+    return std::memcmp(&decoded, &value, sizeof(T)) == 0;
+}
+
+std::array<uint8_t, CompressionMetadata::DATA_SIZE> ALPHeader::getData() const {
+    KU_ASSERT(exponent <= EXPONENT_MASK);
+    KU_ASSERT(exceptionCapacity <= MAX_EXCEPTION_CAPACITY &&
+              (exceptionCapacity == 0 || std::has_single_bit(exceptionCapacity)));
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> data = {};
+    uint8_t capacityBits =
+        exceptionCapacity == 0 ? 0 : static_cast<uint8_t>(std::countr_zero(exceptionCapacity) + 1);
+    data[0] = exponent | (capacityBits << 5);
+    data[1] = bitWidth;
+    auto offsetBits = static_cast<uint64_t>(offset);
+    memcpy(&data[2], &offsetBits, CompressionMetadata::DATA_SIZE - 2);
+    return data;
+}
+
+ALPHeader ALPHeader::readHeader(const std::array<uint8_t, CompressionMetadata::DATA_SIZE>& data) {
+    ALPHeader header;
+    header.exponent = data[0] & EXPONENT_MASK;
+    uint8_t capacityBits = data[0] >> 5;
+    header.exceptionCapacity = capacityBits == 0 ? 0 : 1 << (capacityBits - 1);
+    header.bitWidth = data[1];
+    uint64_t offsetBits = 0;
+    memcpy(&offsetBits, &data[2], CompressionMetadata::DATA_SIZE - 2);
+    // Sign-extend from 56 bits
+    header.offset = static_cast<int64_t>(offsetBits << 8) >> 8;
+    return header;
+}
+
+template<typename T>
+uint64_t FloatCompression<T>::numValues(uint64_t dataSize, const ALPHeader& header) {
+    if (header.bitWidth == 0) {
+        KU_ASSERT(header.exceptionCapacity == 0);
+        return UINT64_MAX;
+    }
+    auto packedDataStart = getPackedDataStart(header);
+    if (dataSize <= packedDataStart) {
+        return 0;
+    }
+    auto numValues = (dataSize - packedDataStart) * 8 / header.bitWidth;
+    numValues -= numValues % CHUNK_SIZE;
+    return numValues;
+}
+
+template<typename T>
+CompressionMetadata FloatCompression<T>::getCompressionMetadata(
+    const uint8_t* srcBuffer, uint64_t numValues) const {
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    if (numValues == 0) {
+        return CompressionMetadata();
+    }
+    // Choose the exponent which produces the fewest exceptions in a sample of the values. Smaller
+    // exponents are preferred on ties since they produce smaller integers.
+    auto sampleStep = std::max<uint64_t>(1, numValues / ALP_SAMPLE_SIZE);
+    uint8_t exponent = 0;
+    auto minNumExceptions = UINT64_MAX;
+    for (uint8_t e = 0; e <= getMaxExponent<T>() && minNumExceptions > 0; e++) {
+        uint64_t numExceptions = 0;
+        int64_t encoded;
+        for (auto i = 0u; i < numValues; i += sampleStep) {
+            numExceptions += !encodeFloat(values[i], e, encoded);
+        }
+        if (numExceptions < minNumExceptions) {
+            minNumExceptions = numExceptions;
+            exponent = e;
+        }
+    }
+    auto min = std::numeric_limits<int64_t>::max(), max = std::numeric_limits<int64_t>::min();
+    std::vector<uint64_t> exceptionPositions;
+    for (auto i = 0u; i < numValues; i++) {
+        int64_t encoded;
+        if (encodeFloat(values[i], exponent, encoded)) {
+            min = std::min(min, encoded);
+            max = std::max(max, encoded);
+        } else {
+            exceptionPositions.push_back(i);
+        }
+    }
+    if (exceptionPositions.size() == numValues) {
+        return CompressionMetadata();
+    }
+    ALPHeader header{exponent, static_cast<uint8_t>(std::bit_width((uint64_t)(max - min))),
+        0 /*exceptionCapacity*/, min};
+    if (!exceptionPositions.empty()) {
+        // Pages need space for the packed values to be able to store exceptions
+        header.bitWidth = std::max<uint8_t>(header.bitWidth, 1);
+    }
+    // Reserve enough space for exceptions in every page. Reserving space reduces the number of
+    // values per page, so repeat until the capacity is sufficient.
+    while (true) {
+        auto numValuesPerPage = this->numValues(BufferPoolConstants::PAGE_4KB_SIZE, header);
+        uint64_t maxExceptionsPerPage = 0, numExceptionsInPage = 0, currentPage = 0;
+        for (auto pos : exceptionPositions) {
+            if (pos / numValuesPerPage != currentPage) {
+                currentPage = pos / numValuesPerPage;
+                numExceptionsInPage = 0;
+            }
+            maxExceptionsPerPage = std::max(maxExceptionsPerPage, ++numExceptionsInPage);
+        }
+        if (maxExceptionsPerPage <= header.exceptionCapacity) {
+            break;
+        }
+        if (maxExceptionsPerPage > ALPHeader::MAX_EXCEPTION_CAPACITY) {
+            return CompressionMetadata();
+        }
+        header.exceptionCapacity = static_cast<uint8_t>(std::bit_ceil(maxExceptionsPerPage));
+    }
+    return CompressionMetadata(CompressionType::ALP, header.getData());
+}
+
+template<typename T>
+uint64_t FloatCompression<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const struct CompressionMetadata& metadata) const {
+    auto header = ALPHeader::readHeader(metadata.data);
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    auto numValuesToCompress = std::min(numValuesRemaining, numValues(dstBufferSize, header));
+    auto packedData = dstBuffer + getPackedDataStart(header);
+    auto exceptionValues = dstBuffer + HEADER_SIZE;
+    auto exceptionPositions = exceptionValues + header.exceptionCapacity * sizeof(T);
+    KU_ASSERT(dstBufferSize >= getPackedDataStart(header));
+    uint16_t numExceptions = 0;
+    uint64_t chunk[CHUNK_SIZE];
+    for (uint64_t i = 0; i < numValuesToCompress; i += CHUNK_SIZE) {
+        auto numValuesInChunk = std::min(CHUNK_SIZE, numValuesToCompress - i);
+        for (auto j = 0u; j < numValuesInChunk; j++) {
+            int64_t encoded;
+            if (encodeFloat(values[i + j], header.exponent, encoded)) {
+                chunk[j] = (uint64_t)(encoded - header.offset);
+            } else {
+                KU_ASSERT(numExceptions < header.exceptionCapacity);
+                auto pos = static_cast<uint16_t>(i + j);
+                memcpy(exceptionValues + numExceptions * sizeof(T), &values[i + j], sizeof(T));
+                memcpy(exceptionPositions + numExceptions * sizeof(uint16_t), &pos, sizeof(pos));
+                numExceptions++;
+                chunk[j] = 0;
+            }
+        }
+        if (header.bitWidth > 0) {
+            std::fill(chunk + numValuesInChunk, chunk + CHUNK_SIZE, 0);
+            fastpack(chunk, packedData + i * header.bitWidth / 8, header.bitWidth);
+        }
+    }
+    memcpy(dstBuffer, &numExceptions, sizeof(numExceptions));
+    srcBuffer += numValuesToCompress * sizeof(T);
+    // Round up to nearest byte
+    return getPackedDataStart(header) + numValuesToCompress * header.bitWidth / 8 +
+           (numValuesToCompress * header.bitWidth % 8 != 0);
+}
+
+template<typename T>
+void FloatCompression<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    auto header = ALPHeader::readHeader(metadata.data);
+    auto result = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    auto endOffset = srcOffset + numValues;
+    if (header.bitWidth == 0) {
+        std::fill(result, result + numValues, decodeFloat<T>(header.offset, header.exponent));
+    } else {
+        // Unpack whole chunks of values at a time, then convert them back to floats in a tight
+        // loop which the compiler can vectorize.
+        auto packedData = srcBuffer + getPackedDataStart(header);
+        uint64_t chunk[CHUNK_SIZE];
+        for (auto chunkStart = srcOffset - srcOffset % CHUNK_SIZE; chunkStart < endOffset;
+             chunkStart += CHUNK_SIZE) {
+            fastunpack(packedData + chunkStart * header.bitWidth / 8, chunk, header.bitWidth);
+            auto start = std::max(chunkStart, srcOffset);
+            auto end = std::min(chunkStart + CHUNK_SIZE, endOffset);
+            for (auto pos = start; pos < end; pos++) {
+                result[pos - srcOffset] = decodeFloat<T>(
+                    (int64_t)(chunk[pos - chunkStart] + (uint64_t)header.offset), header.exponent);
+            }
+        }
+    }
+    // Patch exceptions
+    uint16_t numExceptions;
+    memcpy(&numExceptions, srcBuffer, sizeof(numExceptions));
+    auto exceptionValues = srcBuffer + HEADER_SIZE;
+    auto exceptionPositions = exceptionValues + header.exceptionCapacity * sizeof(T);
+    for (auto i = 0u; i < numExceptions; i++) {
+        uint16_t pos;
+        memcpy(&pos, exceptionPositions + i * sizeof(uint16_t), sizeof(pos));
+        if (pos >= srcOffset && pos < endOffset) {
+            memcpy(&result[pos - srcOffset], exceptionValues + i * sizeof(T), sizeof(T));
+        }
+    }
+}
+
+template<typename T>
+void FloatCompression<T>::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
+    uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
+    const CompressionMetadata& metadata) const {
+    auto header = ALPHeader::readHeader(metadata.data);
+    auto values = reinterpret_cast<const T*>(srcBuffer);
+    auto packedData = dstBuffer + getPackedDataStart(header);
+    auto exceptionValues = dstBuffer + HEADER_SIZE;
+    auto exceptionPositions = exceptionValues + header.exceptionCapacity * sizeof(T);
+    uint16_t numExceptions;
+    memcpy(&numExceptions, dstBuffer, sizeof(numExceptions));
+    for (auto i = 0u; i < numValues; i++) {
+        auto value = values[srcOffset + i];
+        auto pos = dstOffset + i;
+        KU_ASSERT(canUpdateInPlace(value, header));
+        int64_t encoded = 0;
+        encodeFloat(value, header.exponent, encoded);
+        // The value may previously have been an exception
+        for (auto j = 0u; j < numExceptions; j++) {
+            uint16_t exceptionPos;
+            memcpy(&exceptionPos, exceptionPositions + j * sizeof(uint16_t), sizeof(uint16_t));
+            if (exceptionPos == pos) {
+                numExceptions--;
+                memcpy(exceptionValues + j * sizeof(T), exceptionValues + numExceptions * sizeof(T),
+                    sizeof(T));
+                memcpy(exceptionPositions + j * sizeof(uint16_t),
+                    exceptionPositions + numExceptions * sizeof(uint16_t), sizeof(uint16_t));
+                break;
+            }
+        }
+        if (header.bitWidth > 0) {
+            auto chunkStart = packedData + pos / CHUNK_SIZE * CHUNK_SIZE * header.bitWidth / 8;
+            uint64_t chunk[CHUNK_SIZE];
+            fastunpack(chunkStart, chunk, header.bitWidth);
+            chunk[pos % CHUNK_SIZE] = (uint64_t)(encoded - header.offset);
+            fastpack(chunk, chunkStart, header.bitWidth);
+        }
+    }
+    memcpy(dstBuffer, &numExceptions, sizeof(numExceptions));
+}
+
+template<typename T>
+bool FloatCompression<T>::canUpdateInPlace(T value, const ALPHeader& header) {
+    int64_t encoded;
+    if (!encodeFloat(value, header.exponent, encoded)) {
+        return false;
+    }
+    return encoded >= header.offset &&
+           std::bit_width((uint64_t)(encoded - header.offset)) <= header.bitWidth;
+}
+
+template class FloatCompression<double>;
+template class FloatCompression<float>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/) const {
@@ -596,9 +1442,12 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame,
     case CompressionType::CONSTANT:
         return constant.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
             posInVector, numValuesToRead, metadata);
+    case CompressionType::FSST:
     case CompressionType::UNCOMPRESSED:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
+    // Frame of reference encoding uses the same data layout as integer bitpacking
+    case CompressionType::FRAME_OF_REFERENCE:
     case CompressionType::INTEGER_BITPACKING: {
         switch (physicalType) {
         case PhysicalTypeID::INT64: {
@@ -641,6 +1490,75 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame,
         }
         }
     }
+    case CompressionType::DELTA: {
+        switch (physicalType) {
+        case PhysicalTypeID::INT64: {
+            return IntegerDelta<int64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT32: {
+            return IntegerDelta<int32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT16: {
+            return IntegerDelta<int16_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT8: {
+            return IntegerDelta<int8_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("DELTA is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
+    case CompressionType::RLE: {
+        switch (physicalType) {
+        case PhysicalTypeID::INT64: {
+            return RunLengthEncoding<int64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT32: {
+            return RunLengthEncoding<int32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT16: {
+            return RunLengthEncoding<int16_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT8: {
+            return RunLengthEncoding<int8_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        // Dictionary indices of string columns
+        case PhysicalTypeID::STRING: {
+            return RunLengthEncoding<uint32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                resultVector->getData(), posInVector, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("RLE is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
@@ -656,9 +1574,12 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageElementC
     case CompressionType::CONSTANT:
         return constant.copyFromPage(
             frame, pageCursor.elemPosInPage, result, startPosInResult, numValuesToRead, metadata);
+    case CompressionType::FSST:
     case CompressionType::UNCOMPRESSED:
         return uncompressed.decompressFromPage(
             frame, pageCursor.elemPosInPage, result, startPosInResult, numValuesToRead, metadata);
+    // Frame of reference encoding uses the same data layout as integer bitpacking
+    case CompressionType::FRAME_OF_REFERENCE:
     case CompressionType::INTEGER_BITPACKING: {
         switch (physicalType) {
         case PhysicalTypeID::INT64: {
@@ -701,6 +1622,80 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageElementC
         }
         }
     }
+    case CompressionType::DELTA: {
+        switch (physicalType) {
+        case PhysicalTypeID::INT64: {
+            return IntegerDelta<int64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT32: {
+            return IntegerDelta<int32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT16: {
+            return IntegerDelta<int16_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT8: {
+            return IntegerDelta<int8_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("DELTA is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
+    case CompressionType::RLE: {
+        switch (physicalType) {
+        case PhysicalTypeID::INT64: {
+            return RunLengthEncoding<int64_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT32: {
+            return RunLengthEncoding<int32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT16: {
+            return RunLengthEncoding<int16_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        case PhysicalTypeID::INT8: {
+            return RunLengthEncoding<int8_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        // Dictionary indices of string columns
+        case PhysicalTypeID::STRING: {
+            return RunLengthEncoding<uint32_t>().decompressFromPage(frame, pageCursor.elemPosInPage,
+                result, startPosInResult, numValuesToRead, metadata);
+        }
+        default: {
+            throw NotImplementedException("RLE is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
+    // Offsets of INTERNAL_ID columns
+    case CompressionType::NEIGHBOR_DELTA: {
+        return NeighborListDelta().decompressFromPage(frame, pageCursor.elemPosInPage, result,
+            startPosInResult, numValuesToRead, metadata);
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(
@@ -720,6 +1715,8 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
     case CompressionType::UNCOMPRESSED:
         return uncompressed.setValuesFromUncompressed(
             data, dataOffset, frame, posInFrame, numValues, metadata);
+    // Frame of reference encoding uses the same data layout as integer bitpacking
+    case CompressionType::FRAME_OF_REFERENCE:
     case CompressionType::INTEGER_BITPACKING: {
         switch (physicalType) {
         case PhysicalTypeID::INT64: {
@@ -762,6 +1759,22 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
         }
         }
     }
+    case CompressionType::ALP: {
+        switch (physicalType) {
+        case PhysicalTypeID::DOUBLE: {
+            return FloatCompression<double>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        case PhysicalTypeID::FLOAT: {
+            return FloatCompression<float>().setValuesFromUncompressed(
+                data, dataOffset, frame, posInFrame, numValues, metadata);
+        }
+        default: {
+            throw NotImplementedException("ALP is not implemented for type " +
+                                          PhysicalTypeUtils::physicalTypeToString(physicalType));
+        }
+        }
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.setValuesFromUncompressed(
             data, dataOffset, frame, posInFrame, numValues, metadata);
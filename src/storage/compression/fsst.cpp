@@ -0,0 +1,225 @@
+#include "storage/compression/fsst.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "common/assert.h"
+
+namespace kuzu {
+namespace storage {
+
+// Training only looks at (roughly) this many bytes of the input.
+static constexpr uint64_t TRAINING_SAMPLE_SIZE = 32 * 1024;
+static constexpr uint8_t NUM_TRAINING_GENERATIONS = 5;
+// During training, the input is split into tokens, each of which is either a symbol from the
+// current table (its code) or an escaped byte (ESCAPED_BYTE_TOKEN + byte).
+static constexpr uint16_t ESCAPED_BYTE_TOKEN = 256;
+static constexpr uint16_t NUM_TOKENS = 512;
+
+static std::vector<std::string_view> sampleStrings(const std::vector<std::string_view>& strings) {
+    uint64_t totalSize = 0;
+    for (auto& string : strings) {
+        totalSize += string.size();
+    }
+    if (totalSize <= TRAINING_SAMPLE_SIZE) {
+        return strings;
+    }
+    // Take evenly spaced strings so that the sample is representative of the whole input.
+    auto stride = (totalSize + TRAINING_SAMPLE_SIZE - 1) / TRAINING_SAMPLE_SIZE;
+    std::vector<std::string_view> sample;
+    uint64_t sampleSize = 0;
+    for (auto i = 0u; i < strings.size() && sampleSize < TRAINING_SAMPLE_SIZE; i += stride) {
+        auto string = strings[i].substr(0, TRAINING_SAMPLE_SIZE - sampleSize);
+        sample.push_back(string);
+        sampleSize += string.size();
+    }
+    return sample;
+}
+
+FSSTSymbolTable FSSTSymbolTable::train(const std::vector<std::string_view>& strings) {
+    auto sample = sampleStrings(strings);
+    FSSTSymbolTable table;
+    table.buildIndex();
+    std::vector<uint32_t> tokenCounts(NUM_TOKENS);
+    std::vector<uint32_t> pairCounts(NUM_TOKENS * NUM_TOKENS);
+    for (auto generation = 0u; generation < NUM_TRAINING_GENERATIONS; generation++) {
+        std::fill(tokenCounts.begin(), tokenCounts.end(), 0);
+        std::fill(pairCounts.begin(), pairCounts.end(), 0);
+        // Count how often each token, and each pair of adjacent tokens, occurs when compressing
+        // the sample with the current table.
+        for (auto& string : sample) {
+            auto data = reinterpret_cast<const uint8_t*>(string.data());
+            uint16_t prevToken = NUM_TOKENS;
+            for (uint64_t pos = 0; pos < string.size();) {
+                auto code = table.findLongestSymbol(data + pos, string.size() - pos);
+                uint16_t token;
+                if (code == ESCAPE_CODE) {
+                    token = ESCAPED_BYTE_TOKEN + data[pos];
+                    pos++;
+                } else {
+                    token = code;
+                    pos += table.symbolLengths[code];
+                }
+                tokenCounts[token]++;
+                if (prevToken != NUM_TOKENS) {
+                    pairCounts[prevToken * NUM_TOKENS + token]++;
+                }
+                prevToken = token;
+            }
+        }
+        auto getTokenSymbol = [&](uint16_t token) {
+            if (token >= ESCAPED_BYTE_TOKEN) {
+                return std::string(1, (char)(token - ESCAPED_BYTE_TOKEN));
+            }
+            return std::string(reinterpret_cast<const char*>(table.symbols[token].data()),
+                table.symbolLengths[token]);
+        };
+        // The gain of a candidate symbol is the number of bytes of the sample it would have
+        // covered. Candidates are the current tokens and the concatenation of adjacent tokens.
+        std::unordered_map<std::string, uint64_t> gains;
+        for (uint16_t token = 0; token < NUM_TOKENS; token++) {
+            if (tokenCounts[token] == 0) {
+                continue;
+            }
+            auto symbol = getTokenSymbol(token);
+            gains[symbol] += (uint64_t)tokenCounts[token] * symbol.size();
+            for (uint16_t next = 0; next < NUM_TOKENS; next++) {
+                auto count = pairCounts[token * NUM_TOKENS + next];
+                if (count == 0) {
+                    continue;
+                }
+                auto concatenated = symbol + getTokenSymbol(next);
+                if (concatenated.size() <= MAX_SYMBOL_LENGTH) {
+                    gains[concatenated] += (uint64_t)count * concatenated.size();
+                }
+            }
+        }
+        std::vector<std::pair<std::string, uint64_t>> candidates(gains.begin(), gains.end());
+        auto numSymbols = std::min<uint64_t>(candidates.size(), MAX_NUM_SYMBOLS);
+        // Ties are broken by the symbol itself so that training is deterministic.
+        std::partial_sort(candidates.begin(), candidates.begin() + numSymbols, candidates.end(),
+            [](const auto& a, const auto& b) {
+                return a.second > b.second || (a.second == b.second && a.first < b.first);
+            });
+        table = FSSTSymbolTable();
+        for (auto i = 0u; i < numSymbols; i++) {
+            table.addSymbol(candidates[i].first);
+        }
+        table.buildIndex();
+    }
+    return table;
+}
+
+uint64_t FSSTSymbolTable::getSerializedSize() const {
+    uint64_t size = 1 + numSymbols;
+    for (auto code = 0u; code < numSymbols; code++) {
+        size += symbolLengths[code];
+    }
+    return size;
+}
+
+void FSSTSymbolTable::serialize(uint8_t* buffer) const {
+    *buffer++ = numSymbols;
+    memcpy(buffer, symbolLengths.data(), numSymbols);
+    buffer += numSymbols;
+    for (auto code = 0u; code < numSymbols; code++) {
+        memcpy(buffer, symbols[code].data(), symbolLengths[code]);
+        buffer += symbolLengths[code];
+    }
+}
+
+FSSTSymbolTable FSSTSymbolTable::deserialize(const uint8_t* buffer) {
+    FSSTSymbolTable table;
+    auto numSymbols = *buffer++;
+    auto symbolData = buffer + numSymbols;
+    for (auto code = 0u; code < numSymbols; code++) {
+        auto length = buffer[code];
+        table.addSymbol(std::string_view(reinterpret_cast<const char*>(symbolData), length));
+        symbolData += length;
+    }
+    table.buildIndex();
+    return table;
+}
+
+uint64_t FSSTSymbolTable::compress(const uint8_t* in, uint64_t length, uint8_t* out) const {
+    auto outStart = out;
+    for (uint64_t pos = 0; pos < length;) {
+        auto code = findLongestSymbol(in + pos, length - pos);
+        *out++ = code;
+        if (code == ESCAPE_CODE) {
+            *out++ = in[pos++];
+        } else {
+            pos += symbolLengths[code];
+        }
+    }
+    return out - outStart;
+}
+
+uint64_t FSSTSymbolTable::getDecompressedSize(const uint8_t* in, uint64_t length) const {
+    uint64_t size = 0;
+    for (uint64_t pos = 0; pos < length; pos++) {
+        if (in[pos] == ESCAPE_CODE) {
+            pos++;
+            size++;
+        } else {
+            size += symbolLengths[in[pos]];
+        }
+    }
+    return size;
+}
+
+void FSSTSymbolTable::decompress(const uint8_t* in, uint64_t length, uint8_t* out) const {
+    for (uint64_t pos = 0; pos < length; pos++) {
+        auto code = in[pos];
+        if (code == ESCAPE_CODE) {
+            *out++ = in[++pos];
+        } else {
+            memcpy(out, symbols[code].data(), symbolLengths[code]);
+            out += symbolLengths[code];
+        }
+    }
+}
+
+void FSSTSymbolTable::addSymbol(std::string_view symbol) {
+    KU_ASSERT(numSymbols < MAX_NUM_SYMBOLS);
+    KU_ASSERT(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH);
+    memcpy(symbols[numSymbols].data(), symbol.data(), symbol.size());
+    symbolLengths[numSymbols] = symbol.size();
+    numSymbols++;
+}
+
+void FSSTSymbolTable::buildIndex() {
+    for (auto code = 0u; code < numSymbols; code++) {
+        sortedCodes[code] = code;
+    }
+    std::sort(sortedCodes.begin(), sortedCodes.begin() + numSymbols, [&](uint8_t a, uint8_t b) {
+        if (symbols[a][0] != symbols[b][0]) {
+            return symbols[a][0] < symbols[b][0];
+        }
+        return symbolLengths[a] > symbolLengths[b];
+    });
+    uint16_t idx = 0;
+    for (auto byte = 0u; byte < 256; byte++) {
+        codeIdxByFirstByte[byte] = idx;
+        while (idx < numSymbols && symbols[sortedCodes[idx]][0] == byte) {
+            idx++;
+        }
+    }
+    codeIdxByFirstByte[256] = idx;
+}
+
+uint8_t FSSTSymbolTable::findLongestSymbol(const uint8_t* in, uint64_t length) const {
+    for (auto idx = codeIdxByFirstByte[in[0]]; idx < codeIdxByFirstByte[in[0] + 1]; idx++) {
+        auto code = sortedCodes[idx];
+        if (symbolLengths[code] <= length &&
+            memcmp(in, symbols[code].data(), symbolLengths[code]) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+} // namespace storage
+} // namespace kuzu
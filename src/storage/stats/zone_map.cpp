@@ -0,0 +1,251 @@
+#include "storage/stats/zone_map.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "common/null_mask.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+static inline T readValue(const std::array<uint8_t, ZoneMap::VALUE_SIZE>& data) {
+    T value;
+    memcpy(&value, data.data(), sizeof(T));
+    return value;
+}
+
+template<typename T>
+static inline void writeValue(std::array<uint8_t, ZoneMap::VALUE_SIZE>& data, T value) {
+    memcpy(data.data(), &value, sizeof(T));
+}
+
+template<typename T>
+static inline bool isNaN(T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::isnan(value);
+    } else {
+        return false;
+    }
+}
+
+template<typename T>
+static ZoneMap computeZoneMap(const uint8_t* buffer, const uint64_t* nullMask, uint64_t numValues) {
+    ZoneMap zoneMap;
+    zoneMap.isValid = true;
+    auto values = reinterpret_cast<const T*>(buffer);
+    T min{}, max{};
+    for (auto i = 0u; i < numValues; i++) {
+        if (nullMask && NullMask::isNull(nullMask, i)) {
+            continue;
+        }
+        auto value = values[i];
+        // NaN is unordered, so a chunk containing it can't be described by a range.
+        if (isNaN(value)) {
+            zoneMap.isValid = false;
+            return zoneMap;
+        }
+        if (zoneMap.isEmpty) {
+            min = max = value;
+            zoneMap.isEmpty = false;
+        } else if (value < min) {
+            min = value;
+        } else if (value > max) {
+            max = value;
+        }
+    }
+    if (!zoneMap.isEmpty) {
+        writeValue(zoneMap.min, min);
+        writeValue(zoneMap.max, max);
+    }
+    return zoneMap;
+}
+
+template<typename T>
+static bool updateZoneMap(ZoneMap& zoneMap, const uint8_t* data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    if (isNaN(value)) {
+        zoneMap.invalidate();
+    } else if (zoneMap.isEmpty) {
+        writeValue(zoneMap.min, value);
+        writeValue(zoneMap.max, value);
+        zoneMap.isEmpty = false;
+    } else if (value < readValue<T>(zoneMap.min)) {
+        writeValue(zoneMap.min, value);
+    } else if (value > readValue<T>(zoneMap.max)) {
+        writeValue(zoneMap.max, value);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+template<typename T>
+static bool canSkipZoneMap(const ZoneMap& zoneMap, ExpressionType comparison,
+    const std::array<uint8_t, ZoneMap::VALUE_SIZE>& data) {
+    auto value = readValue<T>(data);
+    if (isNaN(value)) {
+        return false;
+    }
+    auto min = readValue<T>(zoneMap.min);
+    auto max = readValue<T>(zoneMap.max);
+    switch (comparison) {
+    case ExpressionType::EQUALS:
+        return value < min || value > max;
+    case ExpressionType::GREATER_THAN:
+        return max <= value;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return max < value;
+    case ExpressionType::LESS_THAN:
+        return min >= value;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return min > value;
+    default:
+        return false;
+    }
+}
+
+bool ZoneMap::isSupported(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+ZoneMap ZoneMap::compute(PhysicalTypeID physicalType, const uint8_t* buffer,
+    const uint64_t* nullMask, uint64_t numValues) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return computeZoneMap<int64_t>(buffer, nullMask, numValues);
+    case PhysicalTypeID::INT32:
+        return computeZoneMap<int32_t>(buffer, nullMask, numValues);
+    case PhysicalTypeID::INT16:
+        return computeZoneMap<int16_t>(buffer, nullMask, numValues);
+    case PhysicalTypeID::INT8:
+        return computeZoneMap<int8_t>(buffer, nullMask, numValues);
+    case PhysicalTypeID::UINT64:
+        return computeZoneMap<uint64_t>(buffer, nullMask, numValues);
+    case PhysicalTypeID::UINT32:
+        return computeZoneMap<uint32_t>(buffer, nullMask, numValues);
+    case PhysicalTypeID::UINT16:
+        return computeZoneMap<uint16_t>(buffer, nullMask, numValues);
+    case PhysicalTypeID::UINT8:
+        return computeZoneMap<uint8_t>(buffer, nullMask, numValues);
+    case PhysicalTypeID::DOUBLE:
+        return computeZoneMap<double>(buffer, nullMask, numValues);
+    case PhysicalTypeID::FLOAT:
+        return computeZoneMap<float>(buffer, nullMask, numValues);
+    default:
+        return ZoneMap();
+    }
+}
+
+bool ZoneMap::update(PhysicalTypeID physicalType, const uint8_t* value) {
+    if (!isValid) {
+        return false;
+    }
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return updateZoneMap<int64_t>(*this, value);
+    case PhysicalTypeID::INT32:
+        return updateZoneMap<int32_t>(*this, value);
+    case PhysicalTypeID::INT16:
+        return updateZoneMap<int16_t>(*this, value);
+    case PhysicalTypeID::INT8:
+        return updateZoneMap<int8_t>(*this, value);
+    case PhysicalTypeID::UINT64:
+        return updateZoneMap<uint64_t>(*this, value);
+    case PhysicalTypeID::UINT32:
+        return updateZoneMap<uint32_t>(*this, value);
+    case PhysicalTypeID::UINT16:
+        return updateZoneMap<uint16_t>(*this, value);
+    case PhysicalTypeID::UINT8:
+        return updateZoneMap<uint8_t>(*this, value);
+    case PhysicalTypeID::DOUBLE:
+        return updateZoneMap<double>(*this, value);
+    case PhysicalTypeID::FLOAT:
+        return updateZoneMap<float>(*this, value);
+    default:
+        invalidate();
+        return true;
+    }
+}
+
+bool ZoneMapCheck::isSupportedComparison(ExpressionType comparison) {
+    switch (comparison) {
+    case ExpressionType::EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+        return true;
+    default:
+        return false;
+    }
+}
+
+ExpressionType ZoneMapCheck::flipComparison(ExpressionType comparison) {
+    switch (comparison) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return comparison;
+    }
+}
+
+bool ZoneMapCheck::canSkip(const ZoneMap& zoneMap, PhysicalTypeID physicalType) const {
+    if (!zoneMap.isValid) {
+        return false;
+    }
+    // Comparisons against nulls never evaluate to true.
+    if (zoneMap.isEmpty) {
+        return true;
+    }
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return canSkipZoneMap<int64_t>(zoneMap, comparison, value);
+    case PhysicalTypeID::INT32:
+        return canSkipZoneMap<int32_t>(zoneMap, comparison, value);
+    case PhysicalTypeID::INT16:
+        return canSkipZoneMap<int16_t>(zoneMap, comparison, value);
+    case PhysicalTypeID::INT8:
+        return canSkipZoneMap<int8_t>(zoneMap, comparison, value);
+    case PhysicalTypeID::UINT64:
+        return canSkipZoneMap<uint64_t>(zoneMap, comparison, value);
+    case PhysicalTypeID::UINT32:
+        return canSkipZoneMap<uint32_t>(zoneMap, comparison, value);
+    case PhysicalTypeID::UINT16:
+        return canSkipZoneMap<uint16_t>(zoneMap, comparison, value);
+    case PhysicalTypeID::UINT8:
+        return canSkipZoneMap<uint8_t>(zoneMap, comparison, value);
+    case PhysicalTypeID::DOUBLE:
+        return canSkipZoneMap<double>(zoneMap, comparison, value);
+    case PhysicalTypeID::FLOAT:
+        return canSkipZoneMap<float>(zoneMap, comparison, value);
+    default:
+        return false;
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -72,8 +72,10 @@ WALPageIdxAndFrame DBFileUtils::createWALVersionIfNecessaryAndPinPage(page_idx_t
             });
         }
         fileHandle.setWALPageIdxNoLock(originalPageIdx /* pageIdxInOriginalFile */, pageIdxInWAL);
-        wal.fileHandle->setLockedPageDirty(pageIdxInWAL);
     }
+    // The WAL page may have been evicted and read back since it was created, which clears its dirty
+    // bit, so it must be set again for the caller's update to be flushed on eviction.
+    wal.fileHandle->setLockedPageDirty(pageIdxInWAL);
     return {originalPageIdx, pageIdxInWAL, walFrame};
 }
 
@@ -326,7 +326,7 @@ InternalIDColumn::InternalIDColumn(std::string name, const MetadataDAHInfo& meta
     transaction::Transaction* transaction, RWPropertyStats stats)
     : Column{name, LogicalType::INTERNAL_ID(), metaDAHeaderInfo, dataFH, metadataFH, bufferManager,
           wal, transaction, stats, false /* enableCompression */},
-      commonTableID{INVALID_TABLE_ID} {}
+      commonTableID{INVALID_TABLE_ID}, compressNbrLists{false} {}
 
 void InternalIDColumn::populateCommonTableID(ValueVector* resultVector) const {
     auto nodeIDs = ((internalID_t*)resultVector->getData());
@@ -336,6 +336,15 @@ void InternalIDColumn::populateCommonTableID(ValueVector* resultVector) const {
     }
 }
 
+std::unique_ptr<ColumnChunk> InternalIDColumn::getEmptyChunkForCommit() {
+    // Chunks rewritten by an out-of-place commit must be able to pick the same compressions as
+    // the chunks written by COPY and the sliding commit.
+    if (compressNbrLists) {
+        return ColumnChunkFactory::createCSRAdjColumnChunk(true /* enableCompression */);
+    }
+    return ColumnChunkFactory::createColumnChunk(dataType->copy(), enableCompression);
+}
+
 Column::Column(std::string name, std::unique_ptr<LogicalType> dataType,
     const MetadataDAHInfo& metaDAHeaderInfo, BMFileHandle* dataFH, BMFileHandle* metadataFH,
     BufferManager* bufferManager, WAL* wal, transaction::Transaction* transaction,
@@ -418,6 +427,7 @@ void Column::scan(
         auto numValuesToScan = chunkMetadata.numValues;
         KU_ASSERT(chunkMetadata.numValues <= columnChunk->getCapacity());
         while (numValuesScanned < numValuesToScan) {
+            prefetchPages(transaction, chunkMetadata, cursor.pageIdx);
             auto numValuesToReadInPage =
                 std::min(numValuesPerPage, numValuesToScan - numValuesScanned);
             KU_ASSERT(isPageIdxValid(cursor.pageIdx, chunkMetadata));
@@ -441,6 +451,7 @@ void Column::scan(Transaction* transaction, const ReadState& state, offset_t sta
         uint64_t numValuesToScanInPage =
             std::min((uint64_t)state.numValuesPerPage - cursor.elemPosInPage,
                 numValuesToScan - numValuesScanned);
+        prefetchPages(transaction, state.metadata, cursor.pageIdx);
         readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
             readToPageFunc(frame, cursor, result, numValuesScanned, numValuesToScanInPage,
                 state.metadata.compMeta);
@@ -478,6 +489,7 @@ void Column::scanUnfiltered(Transaction* transaction, PageElementCursor& pageCur
             std::min((uint64_t)numValuesPerPage - pageCursor.elemPosInPage,
                 numValuesToScan - numValuesScanned);
         KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
+        prefetchPages(transaction, chunkMeta, pageCursor.pageIdx);
         readFromPage(transaction, pageCursor.pageIdx, [&](uint8_t* frame) -> void {
             readToVectorFunc(frame, pageCursor, resultVector, numValuesScanned + startPosInVector,
                 numValuesToScanInPage, chunkMeta.compMeta);
@@ -501,6 +513,7 @@ void Column::scanFiltered(Transaction* transaction, PageElementCursor& pageCurso
         if (isInRange(nodeIDVector->state->selVector->selectedPositions[posInSelVector],
                 numValuesScanned, numValuesScanned + numValuesToScanInPage)) {
             KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
+            prefetchPages(transaction, chunkMeta, pageCursor.pageIdx);
             readFromPage(transaction, pageCursor.pageIdx, [&](uint8_t* frame) -> void {
                 readToVectorFunc(frame, pageCursor, resultVector, numValuesScanned,
                     numValuesToScanInPage, chunkMeta.compMeta);
@@ -560,11 +573,31 @@ void Column::readFromPage(
     bufferManager->optimisticRead(*fileHandleToPin, pageIdxToPin, func);
 }
 
+void Column::prefetchPages(
+    Transaction* transaction, const ColumnChunkMetadata& chunkMeta, page_idx_t pageIdx) {
+    // Pages updated by a write transaction are read from the WAL file instead, so only read-only
+    // scans of the original pages are worth prefetching.
+    if (transaction->isWriteTransaction() || chunkMeta.pageIdx == INVALID_PAGE_IDX) {
+        return;
+    }
+    auto endPageIdx = chunkMeta.pageIdx + chunkMeta.numPages;
+    if (pageIdx >= endPageIdx ||
+        (pageIdx - chunkMeta.pageIdx) % StorageConstants::NUM_PAGES_TO_PREFETCH != 0) {
+        return;
+    }
+    bufferManager->prefetch(*dataFH, pageIdx,
+        std::min<page_idx_t>(StorageConstants::NUM_PAGES_TO_PREFETCH, endPageIdx - pageIdx));
+}
+
 void Column::append(ColumnChunk* columnChunk, uint64_t nodeGroupIdx) {
     // Main column chunk.
     auto preScanMetadata = columnChunk->getMetadataToFlush();
     auto startPageIdx = dataFH->addNewPages(preScanMetadata.numPages);
     auto metadata = columnChunk->flushBuffer(dataFH, startPageIdx, preScanMetadata);
+    if (!ZoneMap::isSupported(dataType->getPhysicalType())) {
+        // E.g. INTERNAL_ID columns, whose chunks only materialize the offsets as INT64.
+        metadata.zoneMap.invalidate();
+    }
     metadataDA->resize(nodeGroupIdx + 1);
     metadataDA->update(nodeGroupIdx, metadata);
     if (nullColumn) {
@@ -577,12 +610,20 @@ void Column::write(node_group_idx_t nodeGroupIdx, offset_t offsetInChunk,
     ValueVector* vectorToWriteFrom, uint32_t posInVectorToWriteFrom) {
     bool isNull = vectorToWriteFrom->isNull(posInVectorToWriteFrom);
     auto chunkMeta = metadataDA->get(nodeGroupIdx, TransactionType::WRITE);
+    bool metadataChanged = false;
     if (!isNull) {
         writeValue(
             chunkMeta, nodeGroupIdx, offsetInChunk, vectorToWriteFrom, posInVectorToWriteFrom);
+        // In-place updates can only widen the zone map. It is recomputed on out-of-place commits.
+        metadataChanged = chunkMeta.zoneMap.update(dataType->getPhysicalType(),
+            vectorToWriteFrom->getData() +
+                posInVectorToWriteFrom * vectorToWriteFrom->getNumBytesPerValue());
     }
     if (offsetInChunk >= chunkMeta.numValues) {
         chunkMeta.numValues = offsetInChunk + 1;
+        metadataChanged = true;
+    }
+    if (metadataChanged) {
         metadataDA->update(nodeGroupIdx, chunkMeta);
     }
 }
@@ -651,6 +692,8 @@ offset_t Column::appendValues(
         }
     }
     state.metadata.numValues += numValues;
+    // Values appended this way bypass the zone map, so it can no longer be trusted.
+    state.metadata.zoneMap.invalidate();
     metadataDA->update(nodeGroupIdx, state.metadata);
     return startOffset;
 }
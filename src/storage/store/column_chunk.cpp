@@ -17,8 +17,8 @@ ColumnChunkMetadata fixedSizedFlushBuffer(const uint8_t* buffer, uint64_t buffer
     KU_ASSERT(dataFH->getNumPages() >= startPageIdx + metadata.numPages);
     dataFH->getFileInfo()->writeFile(
         buffer, bufferSize, startPageIdx * BufferPoolConstants::PAGE_4KB_SIZE);
-    return ColumnChunkMetadata(
-        startPageIdx, metadata.numPages, metadata.numValues, metadata.compMeta);
+    return ColumnChunkMetadata(startPageIdx, metadata.numPages, metadata.numValues,
+        metadata.compMeta, metadata.zoneMap);
 }
 
 ColumnChunkMetadata fixedSizedGetMetadata(
@@ -33,18 +33,23 @@ ColumnChunkMetadata booleanGetMetadata(
         numValues, CompressionMetadata(CompressionType::BOOLEAN_BITPACKING));
 }
 
+// Candidate compression algorithms for a chunk. The one used for the chunk's data is chosen when
+// the chunk is flushed.
+using compression_algs_t = std::vector<std::shared_ptr<CompressionAlg>>;
+
 class CompressedFlushBuffer {
-    std::shared_ptr<CompressionAlg> alg;
+    compression_algs_t algs;
     const LogicalType& dataType;
 
 public:
-    CompressedFlushBuffer(std::shared_ptr<CompressionAlg> alg, LogicalType& dataType)
-        : alg{std::move(alg)}, dataType{dataType} {}
+    CompressedFlushBuffer(compression_algs_t algs, LogicalType& dataType)
+        : algs{std::move(algs)}, dataType{dataType} {}
 
     CompressedFlushBuffer(const CompressedFlushBuffer& other) = default;
 
     ColumnChunkMetadata operator()(const uint8_t* buffer, uint64_t /*bufferSize*/,
         BMFileHandle* dataFH, page_idx_t startPageIdx, const ColumnChunkMetadata& metadata) {
+        auto alg = getAlg(metadata.compMeta.compression);
         auto valuesRemaining = metadata.numValues;
         const uint8_t* bufferStart = buffer;
         auto compressedBuffer = std::make_unique<uint8_t[]>(BufferPoolConstants::PAGE_4KB_SIZE);
@@ -80,64 +85,113 @@ public:
                 BufferPoolConstants::PAGE_4KB_SIZE,
                 (startPageIdx + metadata.numPages - 1) * BufferPoolConstants::PAGE_4KB_SIZE);
         }
-        return ColumnChunkMetadata(
-            startPageIdx, metadata.numPages, metadata.numValues, metadata.compMeta);
+        return ColumnChunkMetadata(startPageIdx, metadata.numPages, metadata.numValues,
+            metadata.compMeta, metadata.zoneMap);
+    }
+
+private:
+    CompressionAlg* getAlg(CompressionType compression) const {
+        for (auto& alg : algs) {
+            if (alg->getCompressionType() == compression) {
+                return alg.get();
+            }
+        }
+        KU_UNREACHABLE;
     }
 };
 
+// Chunks using these compressions are never updated in place, so every update of or append to
+// them rewrites the chunk out of place. They are only picked for chunks of full node groups,
+// which no longer grow through appends.
+static bool isOnlyForFullNodeGroups(CompressionType compression) {
+    return compression == CompressionType::DELTA || compression == CompressionType::RLE;
+}
+
 class GetCompressionMetadata {
-    std::shared_ptr<CompressionAlg> alg;
+    compression_algs_t algs;
     const LogicalType& dataType;
 
 public:
-    GetCompressionMetadata(std::shared_ptr<CompressionAlg> alg, LogicalType& dataType)
-        : alg{std::move(alg)}, dataType{dataType} {}
+    GetCompressionMetadata(compression_algs_t algs, LogicalType& dataType)
+        : algs{std::move(algs)}, dataType{dataType} {}
 
     GetCompressionMetadata(const GetCompressionMetadata& other) = default;
 
+    // Picks the algorithm which needs the fewest pages. On ties, earlier algorithms are preferred,
+    // since they are cheaper to update in-place.
     ColumnChunkMetadata operator()(
         const uint8_t* buffer, uint64_t /*bufferSize*/, uint64_t capacity, uint64_t numValues) {
-        auto metadata = alg->getCompressionMetadata(buffer, numValues);
-        auto numValuesPerPage = metadata.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
-        auto numPages = capacity / numValuesPerPage + (capacity % numValuesPerPage == 0 ? 0 : 1);
-        return ColumnChunkMetadata(INVALID_PAGE_IDX, numPages, numValues, metadata);
+        std::optional<ColumnChunkMetadata> result;
+        for (auto& alg : algs) {
+            if (numValues < StorageConstants::NODE_GROUP_SIZE &&
+                isOnlyForFullNodeGroups(alg->getCompressionType())) {
+                continue;
+            }
+            auto metadata = alg->getCompressionMetadata(buffer, numValues);
+            auto numValuesPerPage =
+                metadata.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
+            auto numPages =
+                capacity / numValuesPerPage + (capacity % numValuesPerPage == 0 ? 0 : 1);
+            if (!result || numPages < result->numPages) {
+                result = ColumnChunkMetadata(INVALID_PAGE_IDX, numPages, numValues, metadata);
+            }
+        }
+        KU_ASSERT(result.has_value());
+        return *result;
     }
 };
 
-static std::shared_ptr<CompressionAlg> getCompression(
-    const LogicalType& dataType, bool enableCompression) {
+template<typename T>
+static compression_algs_t getSignedIntegerCompressions() {
+    return {std::make_shared<IntegerBitpacking<T>>(),
+        std::make_shared<IntegerFrameOfReference<T>>(), std::make_shared<IntegerDelta<T>>(),
+        std::make_shared<RunLengthEncoding<T>>()};
+}
+
+static compression_algs_t getCompressions(const LogicalType& dataType, bool enableCompression) {
     if (!enableCompression) {
-        return std::make_shared<Uncompressed>(dataType);
+        return {std::make_shared<Uncompressed>(dataType)};
     }
     switch (dataType.getPhysicalType()) {
     case PhysicalTypeID::INT64: {
-        return std::make_shared<IntegerBitpacking<int64_t>>();
+        return getSignedIntegerCompressions<int64_t>();
     }
     case PhysicalTypeID::INT32: {
-        return std::make_shared<IntegerBitpacking<int32_t>>();
+        return getSignedIntegerCompressions<int32_t>();
     }
     case PhysicalTypeID::INT16: {
-        return std::make_shared<IntegerBitpacking<int16_t>>();
+        return getSignedIntegerCompressions<int16_t>();
     }
     case PhysicalTypeID::INT8: {
-        return std::make_shared<IntegerBitpacking<int8_t>>();
+        return getSignedIntegerCompressions<int8_t>();
     }
+    // Uncompressed is kept unless ALP saves pages, since it can always be updated in-place.
+    case PhysicalTypeID::DOUBLE: {
+        return {
+            std::make_shared<Uncompressed>(dataType), std::make_shared<FloatCompression<double>>()};
+    }
+    case PhysicalTypeID::FLOAT: {
+        return {
+            std::make_shared<Uncompressed>(dataType), std::make_shared<FloatCompression<float>>()};
+    }
+    // Unsigned values are used internally for offsets, which are frequently updated in-place, and
+    // IntegerBitpacking already uses the minimum as an offset whenever it saves space.
     case PhysicalTypeID::VAR_LIST:
     case PhysicalTypeID::UINT64: {
-        return std::make_shared<IntegerBitpacking<uint64_t>>();
+        return {std::make_shared<IntegerBitpacking<uint64_t>>()};
     }
     case PhysicalTypeID::STRING:
     case PhysicalTypeID::UINT32: {
-        return std::make_shared<IntegerBitpacking<uint32_t>>();
+        return {std::make_shared<IntegerBitpacking<uint32_t>>()};
     }
     case PhysicalTypeID::UINT16: {
-        return std::make_shared<IntegerBitpacking<uint16_t>>();
+        return {std::make_shared<IntegerBitpacking<uint16_t>>()};
     }
     case PhysicalTypeID::UINT8: {
-        return std::make_shared<IntegerBitpacking<uint8_t>>();
+        return {std::make_shared<IntegerBitpacking<uint8_t>>()};
     }
     default: {
-        return std::make_shared<Uncompressed>(dataType);
+        return {std::make_shared<Uncompressed>(dataType)};
     }
     }
 }
@@ -183,10 +237,12 @@ void ColumnChunk::initializeFunction() {
     case PhysicalTypeID::UINT32:
     case PhysicalTypeID::UINT16:
     case PhysicalTypeID::UINT8:
-    case PhysicalTypeID::INT128: {
-        auto compression = getCompression(*this->dataType, enableCompression);
-        flushBufferFunction = CompressedFlushBuffer(compression, *this->dataType);
-        getMetadataFunction = GetCompressionMetadata(compression, *this->dataType);
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT: {
+        auto compressions = getCompressions(*this->dataType, enableCompression);
+        flushBufferFunction = CompressedFlushBuffer(compressions, *this->dataType);
+        getMetadataFunction = GetCompressionMetadata(std::move(compressions), *this->dataType);
         break;
     }
     default: {
@@ -341,10 +397,24 @@ ColumnChunkMetadata ColumnChunk::getMetadataToFlush() const {
         // Determine if we can make use of constant compression
         auto constantMetadata = ConstantCompression::analyze(*this);
         if (constantMetadata) {
-            return ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues, *constantMetadata);
+            return ColumnChunkMetadata(
+                INVALID_PAGE_IDX, 0, numValues, *constantMetadata, getZoneMap());
         }
     }
-    return getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    auto metadata = getMetadataFunction(buffer.get(), bufferSize, capacity, numValues);
+    metadata.zoneMap = getZoneMap();
+    return metadata;
+}
+
+ZoneMap ColumnChunk::getZoneMap() const {
+    if (numBytesPerValue == 0 || !ZoneMap::isSupported(dataType->getPhysicalType())) {
+        return ZoneMap();
+    }
+    // The null chunk's mayHaveNull flag isn't maintained when it is scanned from disk, so always
+    // consult the null bits.
+    auto nullMask =
+        nullChunk ? reinterpret_cast<const uint64_t*>(nullChunk->getData()) : nullptr;
+    return ZoneMap::compute(dataType->getPhysicalType(), buffer.get(), nullMask, numValues);
 }
 
 ColumnChunkMetadata ColumnChunk::flushBuffer(
@@ -502,8 +572,16 @@ public:
 class InternalIDColumnChunk final : public ColumnChunk {
 public:
     // Physically, we only materialize offset of INTERNAL_ID, which is same as INT64,
-    explicit InternalIDColumnChunk(uint64_t capacity)
-        : ColumnChunk(LogicalType::INT64(), capacity, false /*enableCompression*/) {}
+    explicit InternalIDColumnChunk(uint64_t capacity, bool compressNbrLists = false)
+        : ColumnChunk(LogicalType::INT64(), capacity, compressNbrLists) {
+        if (compressNbrLists) {
+            // Uncompressed is kept unless delta encoding the offsets saves pages.
+            compression_algs_t compressions{
+                std::make_shared<Uncompressed>(*dataType), std::make_shared<NeighborListDelta>()};
+            flushBufferFunction = CompressedFlushBuffer(compressions, *dataType);
+            getMetadataFunction = GetCompressionMetadata(std::move(compressions), *dataType);
+        }
+    }
 
     void append(ValueVector* vector) override {
         KU_ASSERT(vector->dataType.getPhysicalType() == PhysicalTypeID::INTERNAL_ID);
@@ -572,5 +650,10 @@ std::unique_ptr<ColumnChunk> ColumnChunkFactory::createColumnChunk(
     }
 }
 
+std::unique_ptr<ColumnChunk> ColumnChunkFactory::createCSRAdjColumnChunk(
+    bool enableCompression, uint64_t capacity) {
+    return std::make_unique<InternalIDColumnChunk>(capacity, enableCompression);
+}
+
 } // namespace storage
 } // namespace kuzu
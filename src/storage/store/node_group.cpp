@@ -122,6 +122,11 @@ CSRNodeGroup::CSRNodeGroup(
     // By default, initialize all column chunks except for the csrOffsetChunk to empty, as they
     // should be resized after csr offset calculation (e.g., during CopyRel).
     : NodeGroup{columnTypes, enableCompression, 0 /* capacity */} {
+    // The first chunk holds the neighbour offsets of the adj column, which are compressed per CSR
+    // list.
+    KU_ASSERT(!columnTypes.empty() &&
+              columnTypes[0]->getPhysicalType() == common::PhysicalTypeID::INTERNAL_ID);
+    chunks[0] = ColumnChunkFactory::createCSRAdjColumnChunk(enableCompression, 0 /* capacity */);
     csrHeaderChunks.init(enableCompression);
 }
 
@@ -52,6 +52,27 @@ void NodeTableData::scan(Transaction* transaction, TableReadState& readState,
     }
 }
 
+bool NodeTableData::canSkipNodeGroup(Transaction* transaction, node_group_idx_t nodeGroupIdx,
+    const std::vector<ZoneMapCheck>& checks) {
+    // Zone maps only describe committed data. Local updates may introduce values outside them.
+    if (transaction->isWriteTransaction() &&
+        transaction->getLocalStorage()->getLocalTableData(tableID)) {
+        return false;
+    }
+    if (nodeGroupIdx >= getNumNodeGroups(transaction)) {
+        return false;
+    }
+    for (auto& check : checks) {
+        KU_ASSERT(check.columnID < columns.size());
+        auto column = columns[check.columnID].get();
+        auto metadata = column->getMetadata(nodeGroupIdx, transaction->getType());
+        if (check.canSkip(metadata.zoneMap, column->getDataType()->getPhysicalType())) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void NodeTableData::insert(Transaction* transaction, ValueVector* nodeIDVector,
     const std::vector<ValueVector*>& propertyVectors) {
     // We assume that offsets are given in the ascending order, thus lastOffset is the max one.
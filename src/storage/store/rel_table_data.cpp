@@ -312,6 +312,7 @@ CSRRelTableData::CSRRelTableData(BMFileHandle* dataFH, BMFileHandle* metadataFH,
     csrHeaderColumns.length = std::make_unique<Column>(csrLengthColumnName, LogicalType::UINT64(),
         *csrLengthMetadataDAHInfo, dataFH, metadataFH, bufferManager, wal, &DUMMY_READ_TRANSACTION,
         RWPropertyStats::empty(), enableCompression, false /* requireNUllColumn */);
+    dynamic_cast<InternalIDColumn*>(adjColumn.get())->setCompressNbrLists(enableCompression);
 }
 
 void CSRRelTableData::initializeReadState(Transaction* transaction,
@@ -599,8 +600,11 @@ std::unique_ptr<ColumnChunk> CSRRelTableData::slideCSRColumnChunk(Transaction* t
     auto columnChunk = ColumnChunkFactory::createColumnChunk(
         column->getDataType()->copy(), enableCompression, oldCapacity);
     column->scan(transaction, nodeGroupIdx, columnChunk.get());
-    auto newColumnChunk = ColumnChunkFactory::createColumnChunk(
-        column->getDataType()->copy(), enableCompression, newCapacity);
+    auto newColumnChunk =
+        column == adjColumn.get() ?
+            ColumnChunkFactory::createCSRAdjColumnChunk(enableCompression, newCapacity) :
+            ColumnChunkFactory::createColumnChunk(
+                column->getDataType()->copy(), enableCompression, newCapacity);
     auto currentNumSrcNodesInNG = csrOffsetChunk->getNumValues();
     auto relIDs = (offset_t*)relIDChunk->getData();
     for (auto offsetInNG = 0u; offsetInNG < currentNumSrcNodesInNG; offsetInNG++) {
@@ -40,15 +40,29 @@ void StringColumn::scanOffsets(Transaction* transaction, const ReadState& state,
 
 void StringColumn::scanValueToVector(Transaction* transaction, const ReadState& dataState,
     string_offset_t startOffset, string_offset_t endOffset, ValueVector* resultVector,
-    uint64_t offsetInVector) {
+    uint64_t offsetInVector, const FSSTSymbolTable* symbolTable,
+    std::vector<uint8_t>& compressedBuffer) {
     KU_ASSERT(endOffset >= startOffset);
-    // Add string to vector first and read directly into the vector
-    auto& kuString =
-        StringVector::reserveString(resultVector, offsetInVector, endOffset - startOffset);
-    dataColumn->scan(transaction, dataState, startOffset, endOffset, (uint8_t*)kuString.getData());
+    ku_string_t* kuString;
+    if (symbolTable) {
+        compressedBuffer.resize(endOffset - startOffset);
+        dataColumn->scan(transaction, dataState, startOffset, endOffset, compressedBuffer.data());
+        auto length =
+            symbolTable->getDecompressedSize(compressedBuffer.data(), compressedBuffer.size());
+        // Decompress directly into the vector
+        kuString = &StringVector::reserveString(resultVector, offsetInVector, length);
+        symbolTable->decompress(
+            compressedBuffer.data(), compressedBuffer.size(), (uint8_t*)kuString->getData());
+    } else {
+        // Add string to vector first and read directly into the vector
+        kuString =
+            &StringVector::reserveString(resultVector, offsetInVector, endOffset - startOffset);
+        dataColumn->scan(
+            transaction, dataState, startOffset, endOffset, (uint8_t*)kuString->getData());
+    }
     // Update prefix to match the scanned string data
-    if (!ku_string_t::isShortString(kuString.len)) {
-        memcpy(kuString.prefix, kuString.getData(), ku_string_t::PREFIX_LENGTH);
+    if (!ku_string_t::isShortString(kuString->len)) {
+        memcpy(kuString->prefix, kuString->getData(), ku_string_t::PREFIX_LENGTH);
     }
 }
 
@@ -61,6 +75,34 @@ void StringColumn::scan(Transaction* transaction, node_group_idx_t nodeGroupIdx,
         offsetInVector);
 }
 
+// Replaces the FSST-compressed data in the chunk (which includes the symbol table) with the
+// decompressed strings, updating the offsets to match.
+static void decompressChunkData(
+    const FSSTSymbolTable& symbolTable, StringColumnChunk* stringColumnChunk) {
+    auto dataChunk = stringColumnChunk->getDataChunk();
+    auto offsetChunk = stringColumnChunk->getOffsetChunk();
+    auto numStrings = offsetChunk->getNumValues();
+    auto offsets = reinterpret_cast<StringColumn::string_offset_t*>(offsetChunk->getData());
+    std::vector<uint8_t> compressedData(
+        dataChunk->getData(), dataChunk->getData() + dataChunk->getNumValues());
+    std::vector<StringColumn::string_offset_t> compressedOffsets(offsets, offsets + numStrings);
+    compressedOffsets.push_back(compressedData.size());
+    StringColumn::string_offset_t dataSize = 0;
+    for (auto i = 0u; i < numStrings; i++) {
+        offsets[i] = dataSize;
+        dataSize += symbolTable.getDecompressedSize(compressedData.data() + compressedOffsets[i],
+            compressedOffsets[i + 1] - compressedOffsets[i]);
+    }
+    if (dataSize > dataChunk->getCapacity()) {
+        dataChunk->resize(std::bit_ceil(dataSize));
+    }
+    for (auto i = 0u; i < numStrings; i++) {
+        symbolTable.decompress(compressedData.data() + compressedOffsets[i],
+            compressedOffsets[i + 1] - compressedOffsets[i], dataChunk->getData() + offsets[i]);
+    }
+    dataChunk->setNumValues(dataSize);
+}
+
 void StringColumn::scan(
     Transaction* transaction, node_group_idx_t nodeGroupIdx, ColumnChunk* columnChunk) {
     Column::scan(transaction, nodeGroupIdx, columnChunk);
@@ -76,21 +118,135 @@ void StringColumn::scan(
     }
     dataColumn->scan(transaction, nodeGroupIdx, stringColumnChunk->getDataChunk());
 
-    auto offsetMetadata = dataColumn->getMetadata(nodeGroupIdx, transaction->getType());
+    auto offsetMetadata = offsetColumn->getMetadata(nodeGroupIdx, transaction->getType());
     // Make sure that the chunk is large enough
     if (offsetMetadata.numValues > stringColumnChunk->getOffsetChunk()->getCapacity()) {
         stringColumnChunk->getOffsetChunk()->resize(std::bit_ceil(offsetMetadata.numValues));
     }
     offsetColumn->scan(transaction, nodeGroupIdx, stringColumnChunk->getOffsetChunk());
+
+    auto dataState = dataColumn->getReadState(transaction->getType(), nodeGroupIdx);
+    auto symbolTable = getSymbolTable(transaction, nodeGroupIdx, dataState);
+    if (symbolTable) {
+        decompressChunkData(*symbolTable, stringColumnChunk);
+    }
 }
 
 void StringColumn::append(ColumnChunk* columnChunk, node_group_idx_t nodeGroupIdx) {
     Column::append(columnChunk, nodeGroupIdx);
     auto stringColumnChunk = ku_dynamic_cast<ColumnChunk*, StringColumnChunk*>(columnChunk);
+    if (enableCompression && appendCompressedData(stringColumnChunk, nodeGroupIdx)) {
+        return;
+    }
     dataColumn->append(stringColumnChunk->getDataChunk(), nodeGroupIdx);
     offsetColumn->append(stringColumnChunk->getOffsetChunk(), nodeGroupIdx);
 }
 
+// The size of the serialized symbol table is stored in the data column's compression metadata.
+static CompressionMetadata getFSSTMetadata(uint32_t symbolTableSize) {
+    CompressionMetadata metadata{CompressionType::FSST};
+    memcpy(metadata.data.data(), &symbolTableSize, sizeof(symbolTableSize));
+    return metadata;
+}
+
+static uint32_t getSymbolTableSize(const CompressionMetadata& metadata) {
+    KU_ASSERT(metadata.compression == CompressionType::FSST);
+    uint32_t symbolTableSize;
+    memcpy(&symbolTableSize, metadata.data.data(), sizeof(symbolTableSize));
+    return symbolTableSize;
+}
+
+bool StringColumn::appendCompressedData(
+    StringColumnChunk* stringColumnChunk, node_group_idx_t nodeGroupIdx) {
+    auto dataChunk = stringColumnChunk->getDataChunk();
+    auto offsetChunk = stringColumnChunk->getOffsetChunk();
+    auto dataSize = dataChunk->getNumValues();
+    // Data which fits in a single page can't take up any less space
+    if (dataSize <= BufferPoolConstants::PAGE_4KB_SIZE) {
+        return false;
+    }
+    auto numStrings = offsetChunk->getNumValues();
+    auto offsets = reinterpret_cast<string_offset_t*>(offsetChunk->getData());
+    std::vector<std::string_view> strings;
+    strings.reserve(numStrings);
+    for (auto i = 0u; i < numStrings; i++) {
+        auto endOffset = i + 1 < numStrings ? offsets[i + 1] : dataSize;
+        strings.emplace_back(
+            (const char*)dataChunk->getData() + offsets[i], endOffset - offsets[i]);
+    }
+    auto symbolTable = FSSTSymbolTable::train(strings);
+    auto symbolTableSize = symbolTable.getSerializedSize();
+    auto compressedDataChunk = ColumnChunkFactory::createColumnChunk(
+        LogicalType::UINT8(), false /*enableCompression*/, dataSize);
+    auto compressedOffsetChunk =
+        ColumnChunkFactory::createColumnChunk(LogicalType::UINT64(), enableCompression, numStrings);
+    symbolTable.serialize(compressedDataChunk->getData());
+    string_offset_t compressedSize = symbolTableSize;
+    std::vector<uint8_t> compressedString;
+    for (auto i = 0u; i < numStrings; i++) {
+        compressedString.resize(FSSTSymbolTable::getMaxCompressedSize(strings[i].size()));
+        auto length = symbolTable.compress(
+            (const uint8_t*)strings[i].data(), strings[i].size(), compressedString.data());
+        if (compressedSize + length > dataSize) {
+            // Incompressible data
+            return false;
+        }
+        memcpy(compressedDataChunk->getData() + compressedSize, compressedString.data(), length);
+        compressedOffsetChunk->setValue<string_offset_t>(compressedSize, i);
+        compressedSize += length;
+    }
+    auto numPages = [](uint64_t size) {
+        return (size + BufferPoolConstants::PAGE_4KB_SIZE - 1) / BufferPoolConstants::PAGE_4KB_SIZE;
+    };
+    if (numPages(compressedSize) >= numPages(dataSize)) {
+        return false;
+    }
+    compressedDataChunk->setNumValues(compressedSize);
+    compressedOffsetChunk->setNumValues(numStrings);
+    dataColumn->append(compressedDataChunk.get(), nodeGroupIdx);
+    auto dataMetadata = dataColumn->metadataDA->get(nodeGroupIdx, TransactionType::WRITE);
+    dataMetadata.compMeta = getFSSTMetadata(symbolTableSize);
+    dataMetadata.zoneMap.invalidate();
+    dataColumn->metadataDA->update(nodeGroupIdx, dataMetadata);
+    offsetColumn->append(compressedOffsetChunk.get(), nodeGroupIdx);
+    return true;
+}
+
+std::shared_ptr<const FSSTSymbolTable> StringColumn::getSymbolTable(
+    Transaction* transaction, node_group_idx_t nodeGroupIdx, const ReadState& dataState) {
+    if (dataState.metadata.compMeta.compression != CompressionType::FSST) {
+        return nullptr;
+    }
+    // The committed version of a node group only changes at checkpoint, which clears the cache.
+    // Write transactions may see chunks they have rewritten themselves, so they don't use it.
+    if (transaction->isWriteTransaction()) {
+        return std::make_shared<const FSSTSymbolTable>(readSymbolTable(transaction, dataState));
+    }
+    std::unique_lock lck{symbolTableCacheMtx};
+    if (nodeGroupIdx >= symbolTableCache.size()) {
+        symbolTableCache.resize(nodeGroupIdx + 1);
+    }
+    auto& cached = symbolTableCache[nodeGroupIdx];
+    if (cached.symbolTable && cached.pageIdx == dataState.metadata.pageIdx) {
+        return cached.symbolTable;
+    }
+    lck.unlock();
+    auto symbolTable =
+        std::make_shared<const FSSTSymbolTable>(readSymbolTable(transaction, dataState));
+    lck.lock();
+    // The cache may have been resized while the lock was released.
+    symbolTableCache[nodeGroupIdx] = CachedSymbolTable{dataState.metadata.pageIdx, symbolTable};
+    return symbolTable;
+}
+
+FSSTSymbolTable StringColumn::readSymbolTable(
+    Transaction* transaction, const ReadState& dataState) {
+    KU_ASSERT(dataState.metadata.compMeta.compression == CompressionType::FSST);
+    std::vector<uint8_t> serializedTable(getSymbolTableSize(dataState.metadata.compMeta));
+    dataColumn->scan(transaction, dataState, 0, serializedTable.size(), serializedTable.data());
+    return FSSTSymbolTable::deserialize(serializedTable.data());
+}
+
 void StringColumn::writeValue(const ColumnChunkMetadata& chunkMeta, node_group_idx_t nodeGroupIdx,
     offset_t offsetInChunk, ValueVector* vectorToWriteFrom, uint32_t posInVectorToWriteFrom) {
     auto& kuStr = vectorToWriteFrom->getValue<ku_string_t>(posInVectorToWriteFrom);
@@ -108,12 +264,16 @@ void StringColumn::checkpointInMemory() {
     Column::checkpointInMemory();
     dataColumn->checkpointInMemory();
     offsetColumn->checkpointInMemory();
+    std::unique_lock lck{symbolTableCacheMtx};
+    symbolTableCache.clear();
 }
 
 void StringColumn::rollbackInMemory() {
     Column::rollbackInMemory();
     dataColumn->rollbackInMemory();
     offsetColumn->rollbackInMemory();
+    std::unique_lock lck{symbolTableCacheMtx};
+    symbolTableCache.clear();
 }
 
 void StringColumn::scanInternal(
@@ -188,11 +348,13 @@ void StringColumn::scanValuesToVector(Transaction* transaction, node_group_idx_t
     scanOffsets(transaction, offsetState, offsets.data(), firstOffsetToScan, numOffsetsToScan,
         dataState.metadata.numValues);
 
+    auto symbolTable = getSymbolTable(transaction, nodeGroupIdx, dataState);
+    std::vector<uint8_t> compressedBuffer;
     for (auto pos = 0u; pos < offsetsToScan.size(); pos++) {
         auto startOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan];
         auto endOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan + 1];
         scanValueToVector(transaction, dataState, startOffset, endOffset, resultVector,
-            offsetsToScan[pos].second);
+            offsetsToScan[pos].second, symbolTable.get(), compressedBuffer);
         auto& scannedString = resultVector->getValue<ku_string_t>(offsetsToScan[pos].second);
         // For each string which has the same index in the dictionary as the one we scanned,
         // copy the scanned string to its position in the result vector
@@ -277,8 +439,12 @@ bool StringColumn::canCommitInPlace(transaction::Transaction* transaction,
         totalStringLengthToAdd += kuStr.len;
     }
 
-    // Make sure there is sufficient space in the data chunk (not currently compressed)
+    // Make sure there is sufficient space in the data chunk
     auto dataColumnMetadata = getDataColumn()->getMetadata(nodeGroupIdx, transaction->getType());
+    if (dataColumnMetadata.compMeta.compression == CompressionType::FSST) {
+        // New strings would need to be compressed with the chunk's symbol table
+        return false;
+    }
     auto totalStringDataAfterUpdate = dataColumnMetadata.numValues + totalStringLengthToAdd;
     if (totalStringDataAfterUpdate >
         dataColumnMetadata.numPages * BufferPoolConstants::PAGE_4KB_SIZE) {
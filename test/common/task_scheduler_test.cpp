@@ -0,0 +1,279 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "common/exception/runtime.h"
+#include "common/task_system/task_scheduler.h"
+#include "graph_test/graph_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::testing;
+
+class FunctionTask : public Task {
+public:
+    FunctionTask(uint64_t maxNumThreads, std::function<void()> func)
+        : Task{maxNumThreads}, func{std::move(func)} {}
+
+    void run() override { func(); }
+
+private:
+    std::function<void()> func;
+};
+
+// Blocks the threads that wait on it until it is released.
+class Latch {
+public:
+    void wait() {
+        std::unique_lock lck{mtx};
+        cv.wait(lck, [&] { return isReleased; });
+    }
+    void release() {
+        std::unique_lock lck{mtx};
+        isReleased = true;
+        cv.notify_all();
+    }
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool isReleased = false;
+};
+
+class TaskSchedulerTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+    }
+
+    std::unique_ptr<ExecutionContext> createContext(uint64_t numThreads) {
+        return std::make_unique<ExecutionContext>(numThreads, &profiler,
+            getMemoryManager(*database), getBufferManager(*database), getClientContext(*conn),
+            getFileSystem(*database), database.get());
+    }
+
+protected:
+    Profiler profiler;
+};
+
+TEST_F(TaskSchedulerTest, DeferredTasksRunUnderQuota) {
+    TaskScheduler scheduler{4 /* numThreads */};
+    // With a quota of one thread, workers taking the tasks of the DAG while another one of them
+    // runs have to defer them.
+    auto context = createContext(1 /* numThreads */);
+    std::atomic<uint64_t> numRunningThreads{0};
+    std::atomic<uint64_t> maxNumRunningThreads{0};
+    std::vector<std::atomic<uint64_t>> numRuns(17);
+    auto createTask = [&](uint64_t taskIdx) {
+        return std::make_unique<FunctionTask>(4 /* maxNumThreads */, [&, taskIdx]() {
+            auto numRunning = ++numRunningThreads;
+            auto maxNumRunning = maxNumRunningThreads.load();
+            while (numRunning > maxNumRunning &&
+                   !maxNumRunningThreads.compare_exchange_weak(maxNumRunning, numRunning)) {}
+            numRuns[taskIdx]++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            numRunningThreads--;
+        });
+    };
+    std::shared_ptr<Task> root = createTask(0);
+    for (auto i = 1u; i < numRuns.size(); ++i) {
+        root->addChildTask(createTask(i));
+    }
+    scheduler.scheduleTaskAndWaitOrError(root, QueryPriority::NORMAL, context.get());
+    ASSERT_EQ(maxNumRunningThreads, 1);
+    for (auto i = 0u; i < numRuns.size(); ++i) {
+        ASSERT_GE(numRuns[i], 1) << "task " << i;
+    }
+}
+
+TEST_F(TaskSchedulerTest, ErroringTaskTearsDownDAG) {
+    TaskScheduler scheduler{2 /* numThreads */};
+    auto context = createContext(2 /* numThreads */);
+    std::atomic<bool> isSiblingRunning{false};
+    std::atomic<uint64_t> numRunningThreads{0};
+    std::atomic<bool> hasRootRun{false};
+    auto root = std::make_shared<FunctionTask>(1 /* maxNumThreads */, [&]() { hasRootRun = true; });
+    // The sibling runs until the exception interrupts the query.
+    root->addChildTask(std::make_unique<FunctionTask>(1 /* maxNumThreads */, [&]() {
+        numRunningThreads++;
+        isSiblingRunning = true;
+        while (!context->clientContext->isInterrupted()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        numRunningThreads--;
+    }));
+    root->addChildTask(std::make_unique<FunctionTask>(1 /* maxNumThreads */, [&]() {
+        while (!isSiblingRunning) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        throw RuntimeException("child failed");
+    }));
+    try {
+        scheduler.scheduleTaskAndWaitOrError(root, QueryPriority::NORMAL, context.get());
+        FAIL() << "The exception of the child task is not thrown.";
+    } catch (RuntimeException& e) { ASSERT_STREQ(e.what(), "Runtime exception: child failed"); }
+    // No worker is left working on the DAG once the exception is thrown.
+    ASSERT_EQ(numRunningThreads, 0);
+    ASSERT_FALSE(hasRootRun);
+    ASSERT_TRUE(root->hasException());
+    // The scheduler keeps serving other queries. Running a query resets the interrupt of the
+    // connection.
+    ASSERT_TRUE(conn->query("RETURN 1")->isSuccess());
+    auto task = std::make_shared<FunctionTask>(1 /* maxNumThreads */, [&]() { hasRootRun = true; });
+    scheduler.scheduleTaskAndWaitOrError(task, QueryPriority::NORMAL, context.get());
+    ASSERT_TRUE(hasRootRun);
+}
+
+TEST_F(TaskSchedulerTest, DestructorReleasesQueuedTasks) {
+    auto scheduler = std::make_unique<TaskScheduler>(1 /* numThreads */);
+    auto context = createContext(2 /* numThreads */);
+    auto context2 = createContext(1 /* numThreads */);
+    Latch isTaskStarted, canTaskFinish, isBlockerStarted, canBlockerFinish;
+    // The only worker pushes the task into its deque before running it, since the task accepts
+    // another thread, and leaves the reference there when the task completes.
+    auto task = std::make_shared<FunctionTask>(2 /* maxNumThreads */, [&]() {
+        isTaskStarted.release();
+        canTaskFinish.wait();
+    });
+    std::weak_ptr<Task> weakTask = task;
+    std::thread user([&]() {
+        scheduler->scheduleTaskAndWaitOrError(task, QueryPriority::NORMAL, context.get());
+    });
+    isTaskStarted.wait();
+    // Tasks of HIGH priority queries are taken before the deque, so the worker runs this one next
+    // and keeps the reference in its deque until the scheduler is destructed.
+    auto blocker = std::make_shared<FunctionTask>(1 /* maxNumThreads */, [&]() {
+        isBlockerStarted.release();
+        canBlockerFinish.wait();
+    });
+    std::thread user2([&]() {
+        scheduler->scheduleTaskAndWaitOrError(blocker, QueryPriority::HIGH, context2.get());
+    });
+    // Let the blocker be submitted before the task finishes.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    canTaskFinish.release();
+    user.join();
+    isBlockerStarted.wait();
+    std::thread destructor([&]() { scheduler.reset(); });
+    // Let the destructor stop the worker before the blocker finishes.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    canBlockerFinish.release();
+    user2.join();
+    destructor.join();
+    task.reset();
+    blocker.reset();
+    ASSERT_TRUE(weakTask.expired());
+}
+
+TEST_F(TaskSchedulerTest, HighPriorityQueryRunsWhileLowPriorityQueryHoldsWorkers) {
+    TaskScheduler scheduler{2 /* numThreads */};
+    auto lowContext = createContext(2 /* numThreads */);
+    auto highContext = createContext(1 /* numThreads */);
+    Latch isLowStarted, canLowFinish;
+    std::atomic<uint64_t> numLowRunningThreads{0};
+    std::atomic<uint64_t> maxNumLowRunningThreads{0};
+    auto createLowTask = [&]() {
+        return std::make_unique<FunctionTask>(2 /* maxNumThreads */, [&]() {
+            auto numRunning = ++numLowRunningThreads;
+            auto maxNumRunning = maxNumLowRunningThreads.load();
+            while (numRunning > maxNumRunning &&
+                   !maxNumLowRunningThreads.compare_exchange_weak(maxNumRunning, numRunning)) {}
+            isLowStarted.release();
+            canLowFinish.wait();
+            numLowRunningThreads--;
+        });
+    };
+    auto lowRoot = std::make_shared<FunctionTask>(1 /* maxNumThreads */, []() {});
+    lowRoot->addChildTask(createLowTask());
+    lowRoot->addChildTask(createLowTask());
+    std::thread lowUser([&]() {
+        scheduler.scheduleTaskAndWaitOrError(lowRoot, QueryPriority::LOW, lowContext.get());
+    });
+    isLowStarted.wait();
+    // A LOW priority query leaves one worker to other queries, even if its connection allows it
+    // to use more.
+    std::atomic<bool> hasHighRun{false};
+    auto highTask = std::make_shared<FunctionTask>(1 /* maxNumThreads */, [&]() { hasHighRun = true; });
+    scheduler.scheduleTaskAndWaitOrError(highTask, QueryPriority::HIGH, highContext.get());
+    ASSERT_TRUE(hasHighRun);
+    ASSERT_EQ(numLowRunningThreads, 1);
+    canLowFinish.release();
+    lowUser.join();
+    ASSERT_EQ(maxNumLowRunningThreads, 1);
+}
+
+TEST_F(TaskSchedulerTest, QuotaLeavesWorkersToOtherQueries) {
+    TaskScheduler scheduler{2 /* numThreads */};
+    auto context = createContext(1 /* numThreads */);
+    auto context2 = createContext(1 /* numThreads */);
+    Latch isStarted, canFinish;
+    std::atomic<uint64_t> numRunningThreads{0};
+    auto root = std::make_shared<FunctionTask>(1 /* maxNumThreads */, []() {});
+    for (auto i = 0u; i < 3; ++i) {
+        root->addChildTask(std::make_unique<FunctionTask>(2 /* maxNumThreads */, [&]() {
+            numRunningThreads++;
+            isStarted.release();
+            canFinish.wait();
+            numRunningThreads--;
+        }));
+    }
+    std::thread user([&]() {
+        scheduler.scheduleTaskAndWaitOrError(root, QueryPriority::NORMAL, context.get());
+    });
+    isStarted.wait();
+    // The tasks of the first query accept more threads, but its quota keeps the second worker
+    // free for another query of the same priority.
+    std::atomic<bool> hasRun{false};
+    auto task = std::make_shared<FunctionTask>(1 /* maxNumThreads */, [&]() { hasRun = true; });
+    scheduler.scheduleTaskAndWaitOrError(task, QueryPriority::NORMAL, context2.get());
+    ASSERT_TRUE(hasRun);
+    ASSERT_EQ(numRunningThreads, 1);
+    canFinish.release();
+    user.join();
+}
+
+TEST_F(TaskSchedulerTest, HighPriorityTasksAreTakenFirst) {
+    TaskScheduler scheduler{1 /* numThreads */};
+    auto blockerContext = createContext(1 /* numThreads */);
+    auto normalContext = createContext(1 /* numThreads */);
+    auto highContext = createContext(1 /* numThreads */);
+    Latch isBlockerStarted, canBlockerFinish;
+    auto blocker = std::make_shared<FunctionTask>(1 /* maxNumThreads */, [&]() {
+        isBlockerStarted.release();
+        canBlockerFinish.wait();
+    });
+    std::thread blockerUser([&]() {
+        scheduler.scheduleTaskAndWaitOrError(blocker, QueryPriority::NORMAL, blockerContext.get());
+    });
+    isBlockerStarted.wait();
+    std::mutex mtx;
+    std::vector<QueryPriority> order;
+    auto createTask = [&](QueryPriority priority) {
+        return std::make_shared<FunctionTask>(1 /* maxNumThreads */, [&, priority]() {
+            std::unique_lock lck{mtx};
+            order.push_back(priority);
+        });
+    };
+    auto normalTask = createTask(QueryPriority::NORMAL);
+    auto highTask = createTask(QueryPriority::HIGH);
+    std::thread normalUser([&]() {
+        scheduler.scheduleTaskAndWaitOrError(normalTask, QueryPriority::NORMAL, normalContext.get());
+    });
+    // Let the NORMAL priority query be submitted first.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::thread highUser([&]() {
+        scheduler.scheduleTaskAndWaitOrError(highTask, QueryPriority::HIGH, highContext.get());
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    canBlockerFinish.release();
+    blockerUser.join();
+    normalUser.join();
+    highUser.join();
+    ASSERT_EQ(order.size(), 2);
+    ASSERT_EQ(order[0], QueryPriority::HIGH);
+    ASSERT_EQ(order[1], QueryPriority::NORMAL);
+}
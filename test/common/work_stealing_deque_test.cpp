@@ -0,0 +1,72 @@
+#include <atomic>
+#include <numeric>
+#include <thread>
+
+#include "common/task_system/work_stealing_deque.h"
+#include "gtest/gtest.h"
+
+using namespace kuzu::common;
+
+TEST(WorkStealingDequeTest, PopTakesNewestAndStealTakesOldest) {
+    std::vector<uint64_t> items(100);
+    std::iota(items.begin(), items.end(), 0);
+    // Start small so that the pushes grow the buffer several times.
+    WorkStealingDeque<uint64_t*> deque{2 /* capacity */};
+    for (auto& item : items) {
+        deque.push(&item);
+    }
+    ASSERT_EQ(*deque.steal(), 0);
+    ASSERT_EQ(*deque.pop(), 99);
+    ASSERT_EQ(*deque.steal(), 1);
+    for (auto i = 98u; i >= 2; --i) {
+        ASSERT_EQ(*deque.pop(), i);
+    }
+    ASSERT_TRUE(deque.isEmpty());
+    ASSERT_EQ(deque.pop(), nullptr);
+    ASSERT_EQ(deque.steal(), nullptr);
+}
+
+TEST(WorkStealingDequeTest, EveryItemIsTakenOnceByOwnerOrThief) {
+    constexpr uint64_t numItems = 200000;
+    constexpr uint64_t numThieves = 3;
+    std::vector<uint64_t> items(numItems);
+    std::iota(items.begin(), items.end(), 0);
+    std::vector<std::atomic<uint64_t>> numTimesTaken(numItems);
+    WorkStealingDeque<uint64_t*> deque{2 /* capacity */};
+    std::atomic<bool> isOwnerDone{false};
+    std::vector<std::thread> thieves;
+    for (auto i = 0u; i < numThieves; ++i) {
+        thieves.emplace_back([&]() {
+            while (!isOwnerDone) {
+                if (auto item = deque.steal()) {
+                    numTimesTaken[*item]++;
+                }
+            }
+        });
+    }
+    // The owner pushes in bursts, which grow the buffer while thieves steal from it, and pops
+    // some of the items itself, racing with the thieves for the last ones.
+    auto numPushed = 0u;
+    while (numPushed < numItems) {
+        auto burstSize = std::min<uint64_t>(numItems - numPushed, 1 + numPushed % 1000);
+        for (auto i = 0u; i < burstSize; ++i) {
+            deque.push(&items[numPushed++]);
+        }
+        for (auto i = 0u; i < burstSize / 2; ++i) {
+            if (auto item = deque.pop()) {
+                numTimesTaken[*item]++;
+            }
+        }
+    }
+    while (auto item = deque.pop()) {
+        numTimesTaken[*item]++;
+    }
+    isOwnerDone = true;
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+    ASSERT_TRUE(deque.isEmpty());
+    for (auto i = 0u; i < numItems; ++i) {
+        ASSERT_EQ(numTimesTaken[i], 1) << "item " << i;
+    }
+}
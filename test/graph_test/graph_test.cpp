@@ -1,9 +1,11 @@
 #include "graph_test/graph_test.h"
 
 #include "binder/binder.h"
+#include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "planner/operator/logical_plan_util.h"
 #include "planner/planner.h"
+#include "processor/plan_mapper.h"
 #include "spdlog/spdlog.h"
 #include "storage/storage_manager.h"
 #include "transaction/transaction_manager.h"
@@ -33,6 +35,28 @@ void PrivateGraphTest::validateQueryBestPlanJoinOrder(
     ASSERT_STREQ(LogicalPlanUtil::encodeJoin(*plan).c_str(), expectedJoinOrder.c_str());
 }
 
+std::unique_ptr<processor::PhysicalPlan> PrivateGraphTest::getPhysicalPlan(
+    const std::string& query) {
+    auto catalog = getCatalog(*database);
+    auto statement = parser::Parser::parseQuery(query);
+    // The binder reads the catalog in the active transaction.
+    auto transactionContext = conn->clientContext->getTransactionContext();
+    transactionContext->beginAutoTransaction(true /* readOnlyStatement */);
+    auto boundStatement =
+        Binder(*catalog, database->memoryManager.get(), database->storageManager.get(),
+            database->vfs.get(), conn->clientContext.get(), database->extensionOptions.get())
+            .bind(*statement);
+    auto planner = Planner(catalog, getStorageManager(*database));
+    auto plan = planner.getBestPlan(*boundStatement);
+    optimizer::Optimizer::optimize(plan.get(), conn->clientContext.get());
+    auto mapper = processor::PlanMapper(
+        *database->storageManager, database->memoryManager.get(), database->catalog.get());
+    auto physicalPlan = mapper.mapLogicalPlanToPhysical(
+        plan.get(), boundStatement->getStatementResult()->getColumns());
+    transactionContext->rollback();
+    return physicalPlan;
+}
+
 void DBTest::createDB(uint64_t checkpointWaitTimeout) {
     if (database != nullptr) {
         database.reset();
@@ -1,5 +1,6 @@
 #include "graph_test/base_graph_test.h"
 #include "main/kuzu.h"
+#include "processor/physical_plan.h"
 #include "test_runner/test_runner.h"
 #include "transaction/transaction_context.h"
 
@@ -26,6 +27,8 @@ protected:
     }
 
     void validateQueryBestPlanJoinOrder(std::string query, std::string expectedJoinOrder);
+    // Binds, plans, optimizes and maps the query the way the connection does before executing it.
+    std::unique_ptr<processor::PhysicalPlan> getPhysicalPlan(const std::string& query);
 };
 
 // This class starts database without initializing graph.
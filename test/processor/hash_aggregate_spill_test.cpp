@@ -0,0 +1,53 @@
+#include <regex>
+
+#include "graph_test/graph_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+class HashAggregateSpillTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        systemConfig->bufferPoolSize = 16 * 1024 * 1024;
+        createDBAndConn();
+    }
+
+    uint64_t getNumSpilledEntries(const std::string& query) {
+        auto result = conn->query("PROFILE " + query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        auto profile = result->getNext()->getValue(0)->toString();
+        std::smatch match;
+        EXPECT_TRUE(std::regex_search(profile, match, std::regex{"NumSpilledEntries: (\\d+)"}))
+            << profile;
+        return match.empty() ? 0 : std::stoull(match[1].str());
+    }
+};
+
+TEST_F(HashAggregateSpillTest, SpillWhenGroupsExceedBufferPool) {
+    // The 300000 inputs are generated from two short ranges, since the plan printed by PROFILE
+    // holds the folded range literals.
+    auto query = "UNWIND range(0, 299) AS i UNWIND range(0, 999) AS j WITH (i * 1000 + j) % 200000 "
+                 "AS k, COUNT(*) AS c WHERE c = 2 RETURN COUNT(*)";
+    ASSERT_GT(getNumSpilledEntries(query), 0);
+    auto result = conn->query(query);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 100000);
+}
+
+TEST_F(HashAggregateSpillTest, SpillStringKeysAndStates) {
+    // The keys are too long to be inlined, so they are stored in the overflow buffer of the table.
+    // The MIN states are short, since each state holding a long string has a buffer of its own.
+    auto query = "UNWIND range(0, 299) AS i UNWIND range(0, 999) AS j WITH i * 1000 + j AS n WITH "
+                 "concat('a-long-group-key-', to_string(n % 200000)) AS k, COUNT(*) AS c, "
+                 "MIN(to_string(n / 200000)) AS m WHERE c = 2 AND m = '0' RETURN COUNT(*)";
+    ASSERT_GT(getNumSpilledEntries(query), 0);
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 100000);
+}
+
+TEST_F(HashAggregateSpillTest, NoSpillWhenGroupsFitInMemory) {
+    ASSERT_EQ(getNumSpilledEntries("UNWIND range(0, 299) AS i WITH i % 200 AS k, COUNT(*) AS c "
+                                   "WHERE c = 2 RETURN COUNT(*)"),
+        0);
+}
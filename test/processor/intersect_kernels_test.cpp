@@ -0,0 +1,96 @@
+#include <random>
+
+#include "gtest/gtest.h"
+#include "processor/operator/intersect/intersect_kernels.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+struct IntersectResult {
+    std::vector<sel_t> leftPositions;
+    std::vector<sel_t> rightPositions;
+};
+
+static std::vector<nodeID_t> generateSortedList(
+    std::mt19937_64& rng, uint64_t size, offset_t maxOffset) {
+    std::uniform_int_distribution<offset_t> dist(0, maxOffset);
+    std::vector<nodeID_t> list(size);
+    for (auto& nodeID : list) {
+        nodeID = nodeID_t{dist(rng), 0 /* tableID */};
+    }
+    std::sort(list.begin(), list.end(),
+        [](const nodeID_t& a, const nodeID_t& b) { return a.offset < b.offset; });
+    return list;
+}
+
+static IntersectResult runKernel(IntersectKernels::intersect_func_t kernel,
+    const std::vector<nodeID_t>& left, const std::vector<nodeID_t>& right) {
+    IntersectResult result;
+    result.leftPositions.resize(left.size());
+    result.rightPositions.resize(left.size());
+    auto numMatches = kernel(left.data(), left.size(), right.data(), right.size(),
+        result.leftPositions.data(), result.rightPositions.data());
+    result.leftPositions.resize(numMatches);
+    result.rightPositions.resize(numMatches);
+    return result;
+}
+
+static void checkKernelsAgainstMerge(
+    const std::vector<nodeID_t>& left, const std::vector<nodeID_t>& right) {
+    auto expected = runKernel(IntersectKernels::mergeIntersect, left, right);
+    std::vector<IntersectKernels::intersect_func_t> kernels{IntersectKernels::gallopingIntersect,
+        IntersectKernels::intersect};
+    if (auto kernel = IntersectKernels::getAVX2Kernel()) {
+        kernels.push_back(kernel);
+    }
+    if (auto kernel = IntersectKernels::getAVX512Kernel()) {
+        kernels.push_back(kernel);
+    }
+    for (auto kernel : kernels) {
+        auto result = runKernel(kernel, left, right);
+        ASSERT_EQ(result.leftPositions, expected.leftPositions);
+        ASSERT_EQ(result.rightPositions, expected.rightPositions);
+    }
+}
+
+TEST(IntersectKernelsTest, MergeIntersect) {
+    std::vector<nodeID_t> left{{1, 0}, {3, 0}, {3, 0}, {5, 0}, {9, 0}};
+    std::vector<nodeID_t> right{{0, 0}, {3, 0}, {5, 0}, {5, 0}, {7, 0}, {9, 0}};
+    auto result = runKernel(IntersectKernels::mergeIntersect, left, right);
+    EXPECT_EQ(result.leftPositions, (std::vector<sel_t>{1, 3, 4}));
+    EXPECT_EQ(result.rightPositions, (std::vector<sel_t>{1, 2, 5}));
+}
+
+TEST(IntersectKernelsTest, EmptyLists) {
+    std::vector<nodeID_t> empty;
+    std::vector<nodeID_t> list{{1, 0}, {2, 0}};
+    checkKernelsAgainstMerge(empty, list);
+    checkKernelsAgainstMerge(list, empty);
+}
+
+TEST(IntersectKernelsTest, RandomLists) {
+    std::mt19937_64 rng(0);
+    for (auto leftSize : {1u, 7u, 64u, 500u}) {
+        for (auto rightSize : {1u, 9u, 100u, 2048u}) {
+            for (auto maxOffset : {10u, 1000u, 100000u}) {
+                auto left = generateSortedList(rng, leftSize, maxOffset);
+                auto right = generateSortedList(rng, rightSize, maxOffset);
+                checkKernelsAgainstMerge(left, right);
+            }
+        }
+    }
+}
+
+TEST(IntersectKernelsTest, LargeOffsets) {
+    // Offsets with the highest bit set must be compared as unsigned integers.
+    std::vector<nodeID_t> left{{1, 0}, {UINT64_MAX - 2, 0}, {UINT64_MAX - 1, 0}};
+    std::vector<nodeID_t> right;
+    for (auto i = 0u; i < 16; i++) {
+        right.push_back(nodeID_t{(offset_t)i, 0});
+    }
+    for (auto i = 0u; i < 16; i++) {
+        right.push_back(nodeID_t{UINT64_MAX - 16 + i, 0});
+    }
+    checkKernelsAgainstMerge(left, right);
+    EXPECT_EQ(runKernel(IntersectKernels::mergeIntersect, left, right).leftPositions.size(), 3);
+}
@@ -0,0 +1,58 @@
+#include <regex>
+
+#include "graph_test/graph_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+class JoinKeyFilterTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE item(id INT64, k INT64, PRIMARY KEY(id))")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE next(FROM item TO item)")->isSuccess());
+        ASSERT_TRUE(
+            conn->query("UNWIND range(0, 999) AS i CREATE (:item {id: i, k: i % 100})")->isSuccess());
+        ASSERT_TRUE(
+            conn->query("MATCH (a:item), (b:item) WHERE b.id = a.id + 1 CREATE (a)-[:next]->(b)")
+                ->isSuccess());
+    }
+
+    std::string getPlan(const std::string& query) {
+        auto result = conn->query("EXPLAIN " + query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        return result->getNext()->getValue(0)->toString();
+    }
+
+    uint64_t getProfilerAttribute(const std::string& query, const std::string& attribute) {
+        auto result = conn->query("PROFILE " + query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        auto profile = result->getNext()->getValue(0)->toString();
+        std::smatch match;
+        EXPECT_TRUE(std::regex_search(profile, match, std::regex{attribute + ": (\\d+)"}))
+            << profile;
+        return match.empty() ? 0 : std::stoull(match[1].str());
+    }
+};
+
+TEST_F(JoinKeyFilterTest, FilterProbeTuplesOfSmallBuildSide) {
+    auto query = "MATCH (a:item)-[:next]->(b:item), (c:item) WHERE b.k = c.k AND c.id = 3 RETURN "
+                 "COUNT(*), SUM(a.id)";
+    ASSERT_NE(getPlan(query).find("JOIN_KEY_FILTER"), std::string::npos);
+    // Only the 10 probe tuples with b.k = 3 pass the filter, apart from false positives.
+    ASSERT_GT(getProfilerAttribute(query, "NumFilteredTuples"), 900);
+    auto result = conn->query(query);
+    auto tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 10);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), 4520);
+}
+
+TEST_F(JoinKeyFilterTest, NoFilterForLargeBuildSide) {
+    // The build side is estimated to be as large as the probe side.
+    auto query = "MATCH (a:item), (b:item) WHERE a.k = b.k RETURN COUNT(*)";
+    ASSERT_EQ(getPlan(query).find("JOIN_KEY_FILTER"), std::string::npos);
+    auto result = conn->query(query);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 10000);
+}
@@ -0,0 +1,177 @@
+#include "common/cast.h"
+#include "graph_test/graph_test.h"
+#include "processor/operator/sink.h"
+#include "processor/processor.h"
+#include "processor/processor_task.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace testing {
+
+class PipelineSchedulingTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE item(id INT64, k INT64, PRIMARY KEY(id))")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE next(FROM item TO item)")->isSuccess());
+        ASSERT_TRUE(
+            conn->query("UNWIND range(0, 999) AS i CREATE (:item {id: i, k: i % 100})")->isSuccess());
+        ASSERT_TRUE(
+            conn->query("MATCH (a:item), (b:item) WHERE b.id = a.id + 1 CREATE (a)-[:next]->(b)")
+                ->isSuccess());
+    }
+
+    // Decomposes the plan of the query into the task DAG that the query processor schedules.
+    std::vector<ProcessorTask*> getTasks(const std::string& query) {
+        plan = getPhysicalPlan(query);
+        context = std::make_unique<ExecutionContext>(2 /* numThreads */, &profiler,
+            getMemoryManager(*database), getBufferManager(*database), getClientContext(*conn),
+            getFileSystem(*database), database.get());
+        auto lastOperator = plan->lastOperator.get();
+        root = std::make_shared<ProcessorTask>(
+            ku_dynamic_cast<PhysicalOperator*, Sink*>(lastOperator), context.get());
+        getQueryProcessor(*database)->decomposePlanIntoTask(
+            lastOperator->getChild(0), root.get(), context.get());
+        std::vector<ProcessorTask*> tasks;
+        collectTasks(root.get(), tasks);
+        return tasks;
+    }
+
+    static void collectTasks(Task* task, std::vector<ProcessorTask*>& tasks) {
+        tasks.push_back(ku_dynamic_cast<Task*, ProcessorTask*>(task));
+        for (auto& child : task->children) {
+            collectTasks(child.get(), tasks);
+        }
+    }
+
+    // Whether the task cannot start before the other one completes.
+    static bool dependsOn(Task* task, Task* other) {
+        for (auto& child : task->children) {
+            if (child.get() == other || dependsOn(child.get(), other)) {
+                return true;
+            }
+        }
+        for (auto dependency : task->dependencies) {
+            if (dependency == other || dependsOn(dependency, other)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool isOrdered(Task* task, Task* other) {
+        return dependsOn(task, other) || dependsOn(other, task);
+    }
+
+    static bool pipelineContains(PhysicalOperator* op, PhysicalOperatorType type) {
+        if (op->getOperatorType() == type) {
+            return true;
+        }
+        for (auto i = 0u; i < op->getNumChildren(); ++i) {
+            auto child = op->getChild(i);
+            if (!child->isSink() && pipelineContains(child, type)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool pipelineContains(ProcessorTask* task, PhysicalOperatorType type) {
+        return pipelineContains(task->getSink(), type);
+    }
+
+    // A pipeline writing a semi mask must not overlap with any other pipeline of the query.
+    static void validateSemiMaskerPipelinesAreOrdered(const std::vector<ProcessorTask*>& tasks) {
+        auto numSemiMaskerTasks = 0u;
+        for (auto task : tasks) {
+            if (!pipelineContains(task, PhysicalOperatorType::SEMI_MASKER)) {
+                continue;
+            }
+            numSemiMaskerTasks++;
+            for (auto other : tasks) {
+                if (other != task) {
+                    ASSERT_TRUE(isOrdered(task, other));
+                }
+            }
+        }
+        ASSERT_GT(numSemiMaskerTasks, 0);
+    }
+
+protected:
+    std::unique_ptr<PhysicalPlan> plan;
+    Profiler profiler;
+    std::unique_ptr<ExecutionContext> context;
+    std::shared_ptr<ProcessorTask> root;
+};
+
+TEST_F(PipelineSchedulingTest, IndependentBuildSidesAreNotOrdered) {
+    auto query = "MATCH (a:item), (b:item), (c:item) WHERE a.id = 1 AND b.id = 2 AND c.id = 3 "
+                 "RETURN a.k + b.k + c.k";
+    std::vector<ProcessorTask*> buildTasks;
+    for (auto task : getTasks(query)) {
+        if (task != root.get()) {
+            buildTasks.push_back(task);
+        }
+    }
+    // The build sides of the cross products may run at the same time.
+    ASSERT_EQ(buildTasks.size(), 2);
+    ASSERT_FALSE(isOrdered(buildTasks[0], buildTasks[1]));
+    auto result = conn->query(query);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 6);
+}
+
+TEST_F(PipelineSchedulingTest, BuildToProbeSemiMaskIsOrdered) {
+    auto query = "MATCH (a:item)-[:next]->(b:item)-[:next]->(c:item) WHERE c.id = 5 RETURN a.id";
+    validateSemiMaskerPipelinesAreOrdered(getTasks(query));
+    auto result = conn->query(query);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 3);
+}
+
+TEST_F(PipelineSchedulingTest, ProbeToBuildAccumulateIsOrdered) {
+    // The build side of the correlated optional match scans the accumulated probe side.
+    auto query = "MATCH (a:item) WHERE a.k = 7 OPTIONAL MATCH (a)-[:next]->(b:item) WHERE b.k > a.k "
+                 "RETURN COUNT(b)";
+    auto tasks = getTasks(query);
+    ProcessorTask* accumulateTask = nullptr;
+    for (auto task : tasks) {
+        if (task != root.get() &&
+            task->getSink()->getOperatorType() == PhysicalOperatorType::RESULT_COLLECTOR) {
+            accumulateTask = task;
+        }
+    }
+    ASSERT_NE(accumulateTask, nullptr);
+    auto numScanTasks = 0u;
+    for (auto task : tasks) {
+        if (task != root.get() &&
+            pipelineContains(task, PhysicalOperatorType::FACTORIZED_TABLE_SCAN)) {
+            numScanTasks++;
+            ASSERT_TRUE(dependsOn(task, accumulateTask));
+        }
+    }
+    ASSERT_GT(numScanTasks, 0);
+    auto result = conn->query(query);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 10);
+}
+
+TEST_F(PipelineSchedulingTest, FailingBranchTearsDownDAG) {
+    // The branches of the union are pipelines without an order, and only the second one fails.
+    auto query = "MATCH (a:item) RETURN a.id AS x UNION ALL MATCH (a:item) WHERE a.id > 500 "
+                 "RETURN a.id / (a.id - 501) AS x";
+    auto tasks = getTasks(query);
+    ASSERT_EQ(tasks.size(), 3);
+    ASSERT_FALSE(isOrdered(tasks[1], tasks[2]));
+    auto result = conn->query(query);
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(), "Runtime exception: Divide by zero.");
+    // Nothing of the failed query is left running or scheduled.
+    result = conn->query("MATCH (a:item) RETURN COUNT(*)");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1000);
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -0,0 +1,83 @@
+#include <atomic>
+#include <thread>
+
+#include "common/exception/interrupt.h"
+#include "graph_test/graph_test.h"
+#include "processor/query_admission_controller.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::testing;
+
+class QueryAdmissionTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        conn2 = std::make_unique<kuzu::main::Connection>(database.get());
+        memoryBudget = (uint64_t)((double)getBufferManager(*database)->getBufferPoolSize() *
+                                  QueryAdmissionConstants::MEMORY_BUDGET_RATIO);
+    }
+
+    std::unique_ptr<ExecutionContext> createContext(kuzu::main::Connection& connection) {
+        return std::make_unique<ExecutionContext>(1 /* numThreads */, &profiler,
+            getMemoryManager(*database), getBufferManager(*database),
+            getClientContext(connection), getFileSystem(*database), database.get());
+    }
+
+protected:
+    std::unique_ptr<kuzu::main::Connection> conn2;
+    Profiler profiler;
+    uint64_t memoryBudget = 0;
+};
+
+TEST_F(QueryAdmissionTest, HeavyQueryWaitsForReservation) {
+    QueryAdmissionController controller;
+    auto context = createContext(*conn);
+    auto context2 = createContext(*conn2);
+    auto heavyQuery = controller.admit(memoryBudget, QueryPriority::NORMAL, context.get());
+    // Queries that are not memory-heavy don't wait.
+    auto lightQuery = controller.admit(
+        memoryBudget / QueryAdmissionConstants::MEMORY_HEAVY_QUERY_RATIO, QueryPriority::NORMAL,
+        context2.get());
+    lightQuery.reset();
+    std::atomic<bool> admitted{false};
+    std::thread waiter([&]() {
+        auto admittedQuery = controller.admit(memoryBudget, QueryPriority::NORMAL, context2.get());
+        admitted = true;
+    });
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(10 * QueryAdmissionConstants::WAIT_INTERVAL_IN_MS));
+    ASSERT_FALSE(admitted);
+    heavyQuery.reset();
+    waiter.join();
+    ASSERT_TRUE(admitted);
+}
+
+TEST_F(QueryAdmissionTest, InterruptWaitingQuery) {
+    QueryAdmissionController controller;
+    auto context = createContext(*conn);
+    auto context2 = createContext(*conn2);
+    auto heavyQuery = controller.admit(memoryBudget, QueryPriority::NORMAL, context.get());
+    conn2->interrupt();
+    ASSERT_THROW(controller.admit(memoryBudget, QueryPriority::NORMAL, context2.get()),
+        InterruptException);
+    heavyQuery.reset();
+    // The reservation of the interrupted query is not kept.
+    auto admittedQuery = controller.admit(memoryBudget, QueryPriority::NORMAL, context.get());
+}
+
+TEST_F(QueryAdmissionTest, ShortQueriesAreEstimatedFromScans) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE item(id INT64, k INT64, PRIMARY KEY(id))")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(0, 9) AS i CREATE (:item {id: i, k: i})")->isSuccess());
+    ASSERT_TRUE(getPhysicalPlan("MATCH (a:item) WHERE a.id = 3 RETURN a.k")->isShortQuery);
+    ASSERT_TRUE(getPhysicalPlan("MATCH (a:item) WHERE a.k < 5 RETURN COUNT(*)")->isShortQuery);
+    // Plans whose input is not estimated from table statistics are never promoted.
+    ASSERT_FALSE(getPhysicalPlan("UNWIND range(0, 999999) AS i RETURN COUNT(*)")->isShortQuery);
+    ASSERT_FALSE(getPhysicalPlan("CALL table_info('item') RETURN *")->isShortQuery);
+    ASSERT_FALSE(
+        getPhysicalPlan("CREATE NODE TABLE other(id INT64, PRIMARY KEY(id))")->isShortQuery);
+    ASSERT_FALSE(
+        getPhysicalPlan("MATCH (a:item) UNWIND range(0, 999999) AS i RETURN COUNT(*)")->isShortQuery);
+}
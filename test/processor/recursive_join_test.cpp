@@ -0,0 +1,58 @@
+#include <regex>
+
+#include "graph_test/graph_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+class RecursiveJoinTest : public EmptyDBTest {
+protected:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        // 20 chains of 10 nodes each.
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE node(id INT64, PRIMARY KEY(id))")->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE next(FROM node TO node)")->isSuccess());
+        ASSERT_TRUE(conn->query("UNWIND range(0, 199) AS i CREATE (:node {id: i})")->isSuccess());
+        ASSERT_TRUE(conn->query("MATCH (a:node), (b:node) WHERE b.id = a.id + 1 AND a.id % 10 <> 9 "
+                                "CREATE (a)-[:next]->(b)")
+                        ->isSuccess());
+    }
+
+    uint64_t getProfilerAttribute(const std::string& query, const std::string& attribute) {
+        auto result = conn->query("PROFILE " + query);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        auto profile = result->getNext()->getValue(0)->toString();
+        std::smatch match;
+        EXPECT_TRUE(std::regex_search(profile, match, std::regex{attribute + ": (\\d+)"}))
+            << profile;
+        return match.empty() ? 0 : std::stoull(match[1].str());
+    }
+};
+
+TEST_F(RecursiveJoinTest, ShortestPathLengthsFromBatchesOfSources) {
+    auto query = "MATCH (a:node)-[r:next* SHORTEST 1..10]->(b:node) RETURN COUNT(*), "
+                 "SUM(length(r))";
+    // The 200 src nodes are scanned in one chunk and searched in batches of up to 64.
+    ASSERT_EQ(getProfilerAttribute(query, "NumMultiSourceBatches"), 4);
+    auto result = conn->query(query);
+    auto tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 900);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), 3300);
+}
+
+TEST_F(RecursiveJoinTest, SingleSourceShortestPathWithAllThreads) {
+    // Node 0 links to all even nodes, so the frontier at level 1 holds more nodes than are left
+    // unvisited, and the odd nodes are visited bottom-up from their even predecessors.
+    ASSERT_TRUE(conn->query("MATCH (a:node), (b:node) WHERE a.id = 0 AND b.id % 2 = 0 AND b.id > 0 "
+                            "CREATE (a)-[:next]->(b)")
+                    ->isSuccess());
+    auto query = "MATCH (a:node)-[r:next* SHORTEST 1..10]->(b:node) WHERE a.id < 1 RETURN "
+                 "COUNT(*), SUM(length(r))";
+    ASSERT_EQ(getProfilerAttribute(query, "NumParallelBFSs"), 1);
+    ASSERT_EQ(getProfilerAttribute(query, "NumBottomUpLevels"), 1);
+    auto result = conn->query(query);
+    auto tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 199);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), 298);
+}
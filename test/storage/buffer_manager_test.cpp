@@ -0,0 +1,160 @@
+#include <cstring>
+#include <filesystem>
+#include <thread>
+
+#include "common/constants.h"
+#include "common/file_system/virtual_file_system.h"
+#include "gtest/gtest.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "test_helper/test_helper.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::testing;
+
+class BufferManagerTest : public testing::Test {
+public:
+    void SetUp() override {
+        tempDir = TestHelper::appendKuzuRootPath(
+            TestHelper::TMP_TEST_DIR + std::string("buffer_manager") +
+            TestHelper::getMillisecondsSuffix());
+        std::filesystem::create_directories(tempDir);
+        vfs = std::make_unique<VirtualFileSystem>();
+    }
+
+    void TearDown() override { std::filesystem::remove_all(tempDir); }
+
+    // Writes `numPages` pages, each filled with its page idx, directly to the file, so that all of
+    // them start out EVICTED.
+    std::unique_ptr<BMFileHandle> createFile(BufferManager& bm, page_idx_t numPages) {
+        auto fileHandle = bm.getBMFileHandle(tempDir + "/data.kz",
+            FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS,
+            BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, vfs.get());
+        uint8_t page[BufferPoolConstants::PAGE_4KB_SIZE];
+        for (auto pageIdx = 0u; pageIdx < numPages; pageIdx++) {
+            memset(page, pageIdx % 256, BufferPoolConstants::PAGE_4KB_SIZE);
+            fileHandle->writePage(page, fileHandle->addNewPage());
+        }
+        return fileHandle;
+    }
+
+    static void checkPages(BufferManager& bm, BMFileHandle& fileHandle, page_idx_t numPages) {
+        for (auto pageIdx = 0u; pageIdx < numPages; pageIdx++) {
+            bm.optimisticRead(fileHandle, pageIdx, [&](uint8_t* frame) {
+                for (auto i = 0u; i < BufferPoolConstants::PAGE_4KB_SIZE; i++) {
+                    ASSERT_EQ(frame[i], pageIdx % 256);
+                }
+            });
+        }
+    }
+
+    // Reads a few hot pages after every `numScanPagesPerRound` pages of a scan, which is longer
+    // than the buffer pool, and returns how many times the hot pages were read from disk in the
+    // last `numRoundsToMeasure` rounds.
+    uint64_t getNumHotPageMisses(EvictionPolicyType evictionPolicy) {
+        auto numFrames = 64u;
+        auto numHotPages = 8u;
+        auto numScanPagesPerRound = numFrames * 3 / 2;
+        auto numRounds = 40u;
+        auto numRoundsToMeasure = 20u;
+        BufferManager bm(numFrames * BufferPoolConstants::PAGE_4KB_SIZE, evictionPolicy);
+        auto fileHandle = createFile(bm, numHotPages + numScanPagesPerRound * numRounds);
+        auto scanPageIdx = numHotPages;
+        uint64_t numMisses = 0;
+        for (auto round = 0u; round < numRounds; round++) {
+            auto numPagesReadBefore = fileHandle->getNumPagesRead();
+            for (auto pageIdx = 0u; pageIdx < numHotPages; pageIdx++) {
+                bm.optimisticRead(*fileHandle, pageIdx, [](uint8_t*) {});
+            }
+            if (round >= numRounds - numRoundsToMeasure) {
+                numMisses += fileHandle->getNumPagesRead() - numPagesReadBefore;
+            }
+            for (auto i = 0u; i < numScanPagesPerRound; i++) {
+                bm.optimisticRead(*fileHandle, scanPageIdx++, [](uint8_t*) {});
+            }
+        }
+        return numMisses;
+    }
+
+public:
+    std::string tempDir;
+    std::unique_ptr<VirtualFileSystem> vfs;
+};
+
+TEST_F(BufferManagerTest, PrefetchPages) {
+    BufferManager bm(BufferPoolConstants::DEFAULT_BUFFER_POOL_SIZE_FOR_TESTING);
+    // Spans several page groups, so that the reads are split at the page group boundaries.
+    auto numPages = 3 * StorageConstants::PAGE_GROUP_SIZE + 10;
+    auto fileHandle = createFile(bm, numPages);
+    bm.prefetch(*fileHandle, 0, numPages);
+    // Prefetching cached pages, and pages past the end of the file, is a no-op.
+    bm.prefetch(*fileHandle, 0, numPages + 100);
+    checkPages(bm, *fileHandle, numPages);
+}
+
+TEST_F(BufferManagerTest, PrefetchPagesWithSmallBufferPool) {
+    // The buffer pool can only hold a few of the pages, so prefetching evicts pages that are
+    // already prefetched, and skips pages that cannot be claimed a frame.
+    BufferManager bm(16 * BufferPoolConstants::PAGE_4KB_SIZE);
+    auto numPages = 200u;
+    auto fileHandle = createFile(bm, numPages);
+    for (auto pageIdx = 0u; pageIdx < numPages; pageIdx += 8) {
+        bm.prefetch(*fileHandle, pageIdx, 32);
+        checkPages(bm, *fileHandle, numPages);
+    }
+}
+
+TEST_F(BufferManagerTest, TwoQueueEvictionIsScanResistant) {
+    auto numFIFOMisses = getNumHotPageMisses(EvictionPolicyType::FIFO);
+    auto numTwoQueueMisses = getNumHotPageMisses(EvictionPolicyType::TWO_QUEUE);
+    // With FIFO, every scan flushes the hot pages out of the buffer pool. The test reads from a
+    // single thread, so all candidates are in its shard of the eviction queue, in FIFO order. The
+    // reads enqueue several purging intervals worth of candidates, and purging keeps the order.
+    ASSERT_EQ(numFIFOMisses, 8 * 20);
+    ASSERT_LT(numTwoQueueMisses * 4, numFIFOMisses);
+}
+
+TEST_F(BufferManagerTest, ConcurrentReadsWithSmallBufferPool) {
+    // Threads unpin into, and evict from, different shards of the eviction queue.
+    BufferManager bm(32 * BufferPoolConstants::PAGE_4KB_SIZE);
+    auto numPages = 256u;
+    auto fileHandle = createFile(bm, numPages);
+    std::vector<std::thread> threads;
+    for (auto threadIdx = 0u; threadIdx < 4; threadIdx++) {
+        threads.emplace_back([&, threadIdx]() {
+            for (auto i = 0u; i < 4 * numPages; i++) {
+                auto pageIdx = (i * 7 + threadIdx * 61) % numPages;
+                if (i % 2 == 0) {
+                    auto frame = bm.pin(*fileHandle, pageIdx);
+                    ASSERT_EQ(frame[0], pageIdx % 256);
+                    bm.unpin(*fileHandle, pageIdx);
+                } else {
+                    bm.optimisticRead(*fileHandle, pageIdx,
+                        [&](uint8_t* frame) { ASSERT_EQ(frame[0], pageIdx % 256); });
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+TEST_F(BufferManagerTest, ReadOnlyFileIsMMapped) {
+    BufferManager bm(BufferPoolConstants::DEFAULT_BUFFER_POOL_SIZE_FOR_TESTING);
+    auto numPages = 100u;
+    createFile(bm, numPages).reset();
+    auto fileHandle = bm.getBMFileHandle(tempDir + "/data.kz",
+        FileHandle::O_PERSISTENT_FILE_READ_ONLY,
+        BMFileHandle::FileVersionedType::VERSIONED_FILE, vfs.get());
+    ASSERT_EQ(fileHandle->getNumPages(), numPages);
+    ASSERT_TRUE(fileHandle->isPageMMapped(numPages - 1));
+    bm.prefetch(*fileHandle, 0, numPages);
+    checkPages(bm, *fileHandle, numPages);
+    auto frame = bm.pin(*fileHandle, 42);
+    ASSERT_EQ(frame, fileHandle->getMMappedPage(42));
+    ASSERT_EQ(frame[BufferPoolConstants::PAGE_4KB_SIZE - 1], 42);
+    bm.unpin(*fileHandle, 42);
+    // No page went through the frames of the BM.
+    ASSERT_EQ(fileHandle->getNumPagesRead(), 0);
+}
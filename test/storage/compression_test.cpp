@@ -1,5 +1,8 @@
+#include <algorithm>
+
 #include "gtest/gtest.h"
 #include "storage/compression/compression.h"
+#include "storage/compression/fsst.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -132,9 +135,9 @@ TEST(CompressionTests, CopyMultiPage) {
     ASSERT_EQ((int64_t*)srcCursor - src.data(), numValues);
 }
 
-template<typename T>
+template<typename T, typename Alg = IntegerBitpacking<T>>
 void integerPackingMultiPage(const std::vector<T>& src) {
-    auto alg = IntegerBitpacking<T>();
+    auto alg = Alg();
     auto pageSize = 4096;
     auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
     auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(LogicalTypeID::INT64));
@@ -288,3 +291,420 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+TEST(CompressionTests, FrameOfReferenceTest) {
+    std::vector<int32_t> src(128);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = i % 50 - 10;
+    }
+    auto alg = IntegerFrameOfReference<int32_t>();
+    test_compression(alg, src);
+    // Unlike IntegerBitpacking, no bit is needed for the sign
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(BitpackHeader::readHeader(metadata.data).bitWidth, 6);
+    auto bitpackingHeader =
+        IntegerBitpacking<int32_t>().getBitWidth((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(bitpackingHeader.bitWidth, 7);
+}
+
+TEST(CompressionTests, ConstantInternalIDCanUpdateInPlace) {
+    // Only the offset of an internal ID is stored in the metadata
+    std::array<uint8_t, CompressionMetadata::DATA_SIZE> data{};
+    offset_t offset = 5;
+    memcpy(data.data(), &offset, sizeof(offset));
+    auto metadata = CompressionMetadata(CompressionType::CONSTANT, data);
+    std::vector<internalID_t> values{{5, 1}, {5, 2}, {6, 1}};
+    EXPECT_TRUE(metadata.canUpdateInPlace((uint8_t*)values.data(), 0, PhysicalTypeID::INTERNAL_ID));
+    EXPECT_TRUE(metadata.canUpdateInPlace((uint8_t*)values.data(), 1, PhysicalTypeID::INTERNAL_ID));
+    EXPECT_FALSE(
+        metadata.canUpdateInPlace((uint8_t*)values.data(), 2, PhysicalTypeID::INTERNAL_ID));
+}
+
+TEST(CompressionTests, FrameOfReferenceMultiPageNegative64) {
+    int64_t numValues = 10000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = -1000000000 - i;
+    }
+    integerPackingMultiPage<int64_t, IntegerFrameOfReference<int64_t>>(src);
+}
+
+TEST(CompressionTests, FrameOfReferenceMultiPageSpanningZero32) {
+    int64_t numValues = 10000;
+    std::vector<int32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i - 100;
+    }
+    integerPackingMultiPage<int32_t, IntegerFrameOfReference<int32_t>>(src);
+}
+
+TEST(CompressionTests, FrameOfReferenceCanUpdateInPlace) {
+    std::vector<int64_t> src{-5, 0, 10};
+    auto metadata = IntegerFrameOfReference<int64_t>().getCompressionMetadata(
+        (uint8_t*)src.data(), src.size());
+    EXPECT_EQ(metadata.compression, CompressionType::FRAME_OF_REFERENCE);
+    std::vector<int64_t> values{-5, 10, 7, -6, 11, INT64_MIN, INT64_MAX};
+    EXPECT_TRUE(metadata.canUpdateInPlace((uint8_t*)values.data(), 0, PhysicalTypeID::INT64));
+    EXPECT_TRUE(metadata.canUpdateInPlace((uint8_t*)values.data(), 1, PhysicalTypeID::INT64));
+    EXPECT_TRUE(metadata.canUpdateInPlace((uint8_t*)values.data(), 2, PhysicalTypeID::INT64));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)values.data(), 3, PhysicalTypeID::INT64));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)values.data(), 4, PhysicalTypeID::INT64));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)values.data(), 5, PhysicalTypeID::INT64));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)values.data(), 6, PhysicalTypeID::INT64));
+}
+
+TEST(CompressionTests, DeltaMultiPageTimestamps) {
+    int64_t numValues = 10000;
+    std::vector<int64_t> src(numValues);
+    // Microsecond timestamps recorded roughly every second
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 1700000000000000 + i * 1000000ll + (i * 7919) % 1000;
+    }
+    auto header = BitpackHeader::readHeader(
+        IntegerDelta<int64_t>().getCompressionMetadata((uint8_t*)src.data(), src.size()).data);
+    EXPECT_EQ(header.bitWidth, 10);
+    integerPackingMultiPage<int64_t, IntegerDelta<int64_t>>(src);
+}
+
+TEST(CompressionTests, DeltaMultiPageDecreasing64) {
+    int64_t numValues = 10000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = -3 * i - i % 3;
+    }
+    integerPackingMultiPage<int64_t, IntegerDelta<int64_t>>(src);
+}
+
+TEST(CompressionTests, DeltaMultiPageExtremes64) {
+    int64_t numValues = 1000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i % 3 == 0 ? INT64_MIN : (i % 3 == 1 ? INT64_MAX : i);
+    }
+    integerPackingMultiPage<int64_t, IntegerDelta<int64_t>>(src);
+}
+
+TEST(CompressionTests, DeltaConstantStride) {
+    std::vector<int64_t> src(5000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = 1000 + 5 * i;
+    }
+    auto alg = IntegerDelta<int64_t>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    EXPECT_EQ(BitpackHeader::readHeader(metadata.data).bitWidth, 0);
+    EXPECT_EQ(
+        metadata.numValues(4096, LogicalType(LogicalTypeID::INT64)), MAX_NUM_VALUES_PER_PAGE);
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)src.data(), 0, PhysicalTypeID::INT64));
+
+    std::vector<uint8_t> dest(4096);
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    EXPECT_EQ(alg.compressNextPage(srcCursor, src.size(), dest.data(), dest.size(), metadata),
+        sizeof(int64_t));
+    EXPECT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    std::vector<int64_t> decompressed(100);
+    alg.decompressFromPage(dest.data(), 4321, (uint8_t*)decompressed.data(), 0,
+        decompressed.size(), metadata);
+    EXPECT_TRUE(std::equal(decompressed.begin(), decompressed.end(), src.begin() + 4321));
+}
+
+TEST(CompressionTests, DeltaConstantStrideMultiPage) {
+    // More values than can be addressed within a single page
+    std::vector<int64_t> src(200000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = 1000 + 5 * i;
+    }
+    integerPackingMultiPage<int64_t, IntegerDelta<int64_t>>(src);
+}
+
+template<typename T>
+void floatCompressionMultiPage(const std::vector<T>& src, CompressionType expectedCompression) {
+    auto alg = FloatCompression<T>();
+    auto pageSize = 4096;
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, expectedCompression);
+    if (expectedCompression != CompressionType::ALP) {
+        return;
+    }
+    auto dataType = LogicalType(
+        std::is_same_v<T, double> ? LogicalTypeID::DOUBLE : LogicalTypeID::FLOAT);
+    auto numValuesPerPage = metadata.numValues(pageSize, dataType);
+    auto numPages = (src.size() + numValuesPerPage - 1) / numValuesPerPage;
+    std::vector<std::vector<uint8_t>> dest(numPages, std::vector<uint8_t>(pageSize));
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    for (auto i = 0u; i < numPages; i++) {
+        alg.compressNextPage(srcCursor, src.size() - i * numValuesPerPage, dest[i].data(),
+            pageSize, metadata);
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        alg.decompressFromPage(dest[i / numValuesPerPage].data(), 0, (uint8_t*)decompressed.data(),
+            i, std::min(numValuesPerPage, (uint64_t)src.size() - i), metadata);
+    }
+    // Compare bits, since the source may contain NaNs
+    ASSERT_EQ(memcmp(decompressed.data(), src.data(), src.size() * sizeof(T)), 0);
+    for (auto i = 0u; i < src.size(); i += 7) {
+        T value;
+        alg.decompressFromPage(dest[i / numValuesPerPage].data(), i % numValuesPerPage,
+            (uint8_t*)&value, 0, 1 /*numValues*/, metadata);
+        EXPECT_EQ(memcmp(&value, &src[i], sizeof(T)), 0);
+    }
+}
+
+TEST(CompressionTests, FloatCompressionDecimals) {
+    std::vector<double> src(10000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = ((int64_t)(i * 7919 % 100000) - 30000) / 100.0;
+    }
+    auto metadata = FloatCompression<double>().getCompressionMetadata(
+        (uint8_t*)src.data(), src.size());
+    auto header = ALPHeader::readHeader(metadata.data);
+    EXPECT_EQ(header.exponent, 2);
+    EXPECT_EQ(header.bitWidth, 17);
+    EXPECT_EQ(header.exceptionCapacity, 0);
+    floatCompressionMultiPage(src, CompressionType::ALP);
+}
+
+TEST(CompressionTests, FloatCompressionFloatDecimals) {
+    std::vector<float> src(10000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = (float)(i % 1000) / 10.0f;
+    }
+    floatCompressionMultiPage(src, CompressionType::ALP);
+}
+
+TEST(CompressionTests, FloatCompressionExceptions) {
+    std::vector<double> src(10000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = 20.5 + (i % 10) * 0.25;
+    }
+    src[3] = std::numeric_limits<double>::quiet_NaN();
+    src[100] = -0.0;
+    src[2000] = 1.0 / 3;
+    src[2001] = std::numeric_limits<double>::infinity();
+    src[9999] = 1e300;
+    auto metadata = FloatCompression<double>().getCompressionMetadata(
+        (uint8_t*)src.data(), src.size());
+    auto header = ALPHeader::readHeader(metadata.data);
+    EXPECT_EQ(header.exponent, 2);
+    // The first four exceptions are in the first page
+    EXPECT_EQ(header.exceptionCapacity, 4);
+    floatCompressionMultiPage(src, CompressionType::ALP);
+}
+
+TEST(CompressionTests, FloatCompressionIncompressible) {
+    std::vector<double> src(1000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = 1.0 / (i + 3);
+    }
+    floatCompressionMultiPage(src, CompressionType::UNCOMPRESSED);
+}
+
+TEST(CompressionTests, FloatCompressionUpdateInPlace) {
+    std::vector<double> src{1.5, 2.25, std::numeric_limits<double>::quiet_NaN(), 3.0};
+    auto alg = FloatCompression<double>();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::ALP);
+    std::vector<uint8_t> dest(4096);
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    alg.compressNextPage(srcCursor, src.size(), dest.data(), dest.size(), metadata);
+
+    std::vector<double> values{2.75, 1.0 / 3, 100.0};
+    EXPECT_TRUE(metadata.canUpdateInPlace((uint8_t*)values.data(), 0, PhysicalTypeID::DOUBLE));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)values.data(), 1, PhysicalTypeID::DOUBLE));
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)values.data(), 2, PhysicalTypeID::DOUBLE));
+    // Overwrite the exception
+    alg.setValuesFromUncompressed(
+        (uint8_t*)values.data(), 0, dest.data(), 2 /*dstOffset*/, 1 /*numValues*/, metadata);
+    src[2] = values[0];
+    std::vector<double> decompressed(src.size());
+    alg.decompressFromPage(
+        dest.data(), 0, (uint8_t*)decompressed.data(), 0, src.size(), metadata);
+    EXPECT_EQ(decompressed, src);
+}
+
+TEST(CompressionTests, RunLengthEncodingSinglePage) {
+    // e.g. a flag column sorted by the flag
+    std::vector<int8_t> src(10000);
+    std::fill(src.begin() + 5000, src.end(), 1);
+    auto metadata =
+        RunLengthEncoding<int8_t>().getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::RLE);
+    EXPECT_GE(metadata.numValues(4096, LogicalType(LogicalTypeID::INT8)), src.size());
+    integerPackingMultiPage<int8_t, RunLengthEncoding<int8_t>>(src);
+}
+
+TEST(CompressionTests, RunLengthEncodingMultiPage64) {
+    std::vector<int64_t> src(100000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = (int64_t)(i / 37) * -1000003;
+    }
+    auto metadata =
+        RunLengthEncoding<int64_t>().getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::RLE);
+    auto numValuesPerPage = metadata.numValues(4096, LogicalType(LogicalTypeID::INT64));
+    EXPECT_LT(numValuesPerPage, src.size());
+    // Much more than the 512 values per page needed without compression
+    EXPECT_GE(numValuesPerPage, 4096);
+    integerPackingMultiPage<int64_t, RunLengthEncoding<int64_t>>(src);
+}
+
+TEST(CompressionTests, RunLengthEncodingUnevenRuns32) {
+    // Short runs in the middle of the chunk limit the number of values in every page
+    std::vector<uint32_t> src(50000, 7);
+    for (auto i = 20000u; i < 21000; i++) {
+        src[i] = i % 2;
+    }
+    integerPackingMultiPage<uint32_t, RunLengthEncoding<uint32_t>>(src);
+}
+
+TEST(CompressionTests, RunLengthEncodingNoRuns16) {
+    std::vector<int16_t> src(5000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = i;
+    }
+    integerPackingMultiPage<int16_t, RunLengthEncoding<int16_t>>(src);
+}
+
+// Neighbour offsets of CSR lists with the given lengths, each clustered around a different base.
+static std::vector<uint64_t> getNeighborLists(
+    const std::vector<uint64_t>& listLengths, bool sorted) {
+    std::vector<uint64_t> offsets;
+    uint64_t seed = 42;
+    auto next = [&]() {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        return seed >> 33;
+    };
+    for (auto length : listLengths) {
+        auto base = next() % 10000000;
+        auto listStart = offsets.size();
+        for (auto i = 0u; i < length; i++) {
+            offsets.push_back(base + next() % 500);
+        }
+        if (sorted) {
+            std::sort(offsets.begin() + listStart, offsets.end());
+        }
+    }
+    return offsets;
+}
+
+TEST(CompressionTests, NeighborListDeltaSortedLists) {
+    std::vector<uint64_t> listLengths;
+    for (auto i = 0u; i < 3000; i++) {
+        listLengths.push_back(i % 40);
+    }
+    auto src = getNeighborLists(listLengths, true /*sorted*/);
+    auto metadata = NeighborListDelta().getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::NEIGHBOR_DELTA);
+    // Much more than the 512 values per page needed without compression
+    EXPECT_GE(metadata.numValues(4096, LogicalType(LogicalTypeID::INTERNAL_ID)), 1024);
+    integerPackingMultiPage<uint64_t, NeighborListDelta>(src);
+}
+
+TEST(CompressionTests, NeighborListDeltaUnsortedLists) {
+    // Lists in insertion order have negative differences as well.
+    std::vector<uint64_t> listLengths(2000, 50);
+    auto src = getNeighborLists(listLengths, false /*sorted*/);
+    auto metadata = NeighborListDelta().getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::NEIGHBOR_DELTA);
+    integerPackingMultiPage<uint64_t, NeighborListDelta>(src);
+}
+
+TEST(CompressionTests, NeighborListDeltaReadList) {
+    std::vector<uint64_t> listLengths{1, 300, 7, 0, 129, 64, 2};
+    auto src = getNeighborLists(listLengths, true /*sorted*/);
+    auto alg = NeighborListDelta();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    ASSERT_EQ(metadata.compression, CompressionType::NEIGHBOR_DELTA);
+    std::vector<uint8_t> page(4096);
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    alg.compressNextPage(srcCursor, src.size(), page.data(), page.size(), metadata);
+    uint64_t listStart = 0;
+    for (auto length : listLengths) {
+        std::vector<uint64_t> list(length);
+        alg.decompressFromPage(
+            page.data(), listStart, (uint8_t*)list.data(), 0, length, metadata);
+        EXPECT_EQ(list, std::vector<uint64_t>(src.begin() + listStart,
+                            src.begin() + listStart + length));
+        listStart += length;
+    }
+}
+
+TEST(CompressionTests, NeighborListDeltaIncompressible) {
+    std::vector<uint64_t> src(1000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = (i % 2 == 0 ? 0 : UINT64_MAX) ^ (i * 0x9E3779B97F4A7C15ull);
+    }
+    auto alg = NeighborListDelta();
+    auto metadata = alg.getCompressionMetadata((uint8_t*)src.data(), src.size());
+    // Uncompressed (512 values per page) is picked for chunks like this one.
+    if (metadata.compression == CompressionType::NEIGHBOR_DELTA) {
+        EXPECT_LE(metadata.numValues(4096, LogicalType(LogicalTypeID::INTERNAL_ID)), 512);
+        integerPackingMultiPage<uint64_t, NeighborListDelta>(src);
+    }
+}
+
+static std::vector<std::string> compressAndDecompressStrings(
+    const FSSTSymbolTable& table, const std::vector<std::string>& strings) {
+    std::vector<std::string> result;
+    for (auto& string : strings) {
+        std::vector<uint8_t> compressed(FSSTSymbolTable::getMaxCompressedSize(string.size()));
+        auto length =
+            table.compress((const uint8_t*)string.data(), string.size(), compressed.data());
+        std::string decompressed(table.getDecompressedSize(compressed.data(), length), '\0');
+        table.decompress(compressed.data(), length, (uint8_t*)decompressed.data());
+        result.push_back(decompressed);
+    }
+    return result;
+}
+
+TEST(CompressionTests, FSSTSharedSubstrings) {
+    std::vector<std::string> strings;
+    uint64_t totalSize = 0;
+    for (auto i = 0u; i < 1000; i++) {
+        strings.push_back("https://www.example.com/products/category-" + std::to_string(i % 17) +
+                          "/item?id=" + std::to_string(i * 7919));
+        totalSize += strings.back().size();
+    }
+    auto table = FSSTSymbolTable::train(
+        std::vector<std::string_view>(strings.begin(), strings.end()));
+    EXPECT_GT(table.getNumSymbols(), 0);
+    uint64_t compressedSize = 0;
+    for (auto& string : strings) {
+        std::vector<uint8_t> compressed(FSSTSymbolTable::getMaxCompressedSize(string.size()));
+        compressedSize +=
+            table.compress((const uint8_t*)string.data(), string.size(), compressed.data());
+    }
+    EXPECT_LT(compressedSize * 2, totalSize);
+    EXPECT_EQ(compressAndDecompressStrings(table, strings), strings);
+}
+
+TEST(CompressionTests, FSSTUnseenBytes) {
+    std::vector<std::string> strings{"aaaaaaaaaaaaaaaa", "abababababab"};
+    auto table = FSSTSymbolTable::train(
+        std::vector<std::string_view>(strings.begin(), strings.end()));
+    // Bytes which are not covered by any symbol are escaped
+    std::vector<std::string> unseen{"", "xyz", std::string("\xff\0\xfe", 3), "aaxaabab"};
+    EXPECT_EQ(compressAndDecompressStrings(table, unseen), unseen);
+}
+
+TEST(CompressionTests, FSSTSerialization) {
+    std::vector<std::string> strings{"Mozilla/5.0 (X11; Linux x86_64)",
+        "Mozilla/5.0 (Windows NT 10.0; Win64; x64)", "Mozilla/5.0 (Macintosh; Intel Mac OS X)"};
+    auto table = FSSTSymbolTable::train(
+        std::vector<std::string_view>(strings.begin(), strings.end()));
+    std::vector<uint8_t> serialized(table.getSerializedSize());
+    table.serialize(serialized.data());
+    auto deserialized = FSSTSymbolTable::deserialize(serialized.data());
+    EXPECT_EQ(deserialized.getNumSymbols(), table.getNumSymbols());
+    for (auto& string : strings) {
+        std::vector<uint8_t> compressed(FSSTSymbolTable::getMaxCompressedSize(string.size()));
+        std::vector<uint8_t> compressed2(compressed.size());
+        auto length =
+            table.compress((const uint8_t*)string.data(), string.size(), compressed.data());
+        ASSERT_EQ(length, deserialized.compress(
+                              (const uint8_t*)string.data(), string.size(), compressed2.data()));
+        EXPECT_EQ(compressed, compressed2);
+    }
+    EXPECT_EQ(compressAndDecompressStrings(deserialized, strings), strings);
+}
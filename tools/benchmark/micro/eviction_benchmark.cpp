@@ -0,0 +1,114 @@
+// Measures how well the buffer manager's eviction policies keep a small set of hot pages cached
+// while a concurrent scan streams through a file larger than the buffer pool. A lookup thread
+// reads random hot pages, and the hit rate of its reads is reported for each policy.
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <thread>
+
+#include "common/constants.h"
+#include "common/file_system/virtual_file_system.h"
+#include "common/string_utils.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+
+struct EvictionBenchmarkConfig {
+    uint64_t bufferPoolSize = 64ull << 20;
+    // Number of hot pages relative to the number of frames in the buffer pool.
+    double hotPagesRatio = 0.75;
+    // Size of the scanned file relative to the buffer pool size.
+    uint64_t scanSizeRatio = 4;
+    uint64_t numSeconds = 5;
+};
+
+static std::unique_ptr<BMFileHandle> createFile(BufferManager& bm, VirtualFileSystem& vfs,
+    const std::string& path, page_idx_t numPages) {
+    vfs.removeFileIfExists(path);
+    auto fileHandle = bm.getBMFileHandle(path, FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS,
+        BMFileHandle::FileVersionedType::NON_VERSIONED_FILE, &vfs);
+    uint8_t page[BufferPoolConstants::PAGE_4KB_SIZE];
+    for (auto pageIdx = 0u; pageIdx < numPages; pageIdx++) {
+        memset(page, pageIdx % 256, BufferPoolConstants::PAGE_4KB_SIZE);
+        fileHandle->writePage(page, fileHandle->addNewPage());
+    }
+    return fileHandle;
+}
+
+static void runBenchmark(EvictionPolicyType policy, const std::string& policyName,
+    const EvictionBenchmarkConfig& config) {
+    VirtualFileSystem vfs;
+    BufferManager bm(config.bufferPoolSize, policy);
+    auto numFrames = config.bufferPoolSize / BufferPoolConstants::PAGE_4KB_SIZE;
+    auto numHotPages = std::max<page_idx_t>(1, numFrames * config.hotPagesRatio);
+    auto numScanPages = numFrames * config.scanSizeRatio;
+    auto tempDir = std::filesystem::temp_directory_path();
+    auto hotFile = createFile(bm, vfs, tempDir / "kuzu_eviction_benchmark_hot", numHotPages);
+    auto scanFile = createFile(bm, vfs, tempDir / "kuzu_eviction_benchmark_scan", numScanPages);
+    std::atomic<bool> stopped{false};
+    uint64_t numPagesScanned = 0;
+    std::thread scanThread([&]() {
+        for (auto pageIdx = 0u; !stopped.load(); pageIdx = (pageIdx + 1) % numScanPages) {
+            bm.optimisticRead(*scanFile, pageIdx, [](uint8_t*) {});
+            numPagesScanned++;
+        }
+    });
+    std::mt19937_64 rng{42};
+    std::uniform_int_distribution<page_idx_t> hotPageDist{0, numHotPages - 1};
+    uint64_t numLookups = 0;
+    uint64_t checksum = 0;
+    auto numMissesBefore = hotFile->getNumPagesRead();
+    auto start = std::chrono::steady_clock::now();
+    auto end = start + std::chrono::seconds(config.numSeconds);
+    while (std::chrono::steady_clock::now() < end) {
+        for (auto i = 0u; i < 1024; i++) {
+            bm.optimisticRead(
+                *hotFile, hotPageDist(rng), [&](uint8_t* frame) { checksum += frame[0]; });
+        }
+        numLookups += 1024;
+    }
+    stopped.store(true);
+    scanThread.join();
+    auto numMisses = hotFile->getNumPagesRead() - numMissesBefore;
+    printf("%-10s lookups: %10lu  hit rate: %6.2f%%  scanned pages: %10lu  (checksum %lu)\n",
+        policyName.c_str(), numLookups, 100.0 * (double)(numLookups - numMisses) / numLookups,
+        numPagesScanned, checksum);
+    hotFile.reset();
+    scanFile.reset();
+    vfs.removeFileIfExists(tempDir / "kuzu_eviction_benchmark_hot");
+    vfs.removeFileIfExists(tempDir / "kuzu_eviction_benchmark_scan");
+}
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+int main(int argc, char** argv) {
+    EvictionBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--bm-size")) {
+            config.bufferPoolSize = (uint64_t)stoull(getArgumentValue(arg)) << 20;
+        } else if (arg.starts_with("--hot-pages-ratio")) {
+            config.hotPagesRatio = stod(getArgumentValue(arg));
+        } else if (arg.starts_with("--scan-size-ratio")) {
+            config.scanSizeRatio = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--seconds")) {
+            config.numSeconds = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    runBenchmark(EvictionPolicyType::FIFO, "FIFO", config);
+    runBenchmark(EvictionPolicyType::TWO_QUEUE, "TWO_QUEUE", config);
+    return 0;
+}
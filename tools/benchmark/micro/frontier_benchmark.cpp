@@ -0,0 +1,122 @@
+// Compares shortest path BFSs over a random graph with sparse frontiers, where visited nodes and
+// bwd edges are kept in hash tables, against dense frontiers, which switch to a visited bitmap and
+// offset-indexed bwd edges once a large enough part of the graph is visited. Each BFS tracks paths
+// and looks up the bwd edge of every visited node afterwards, as the path scanner does.
+
+#include <chrono>
+#include <random>
+
+#include "common/string_utils.h"
+#include "processor/operator/recursive_extend/shortest_path_state.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+struct FrontierBenchmarkConfig {
+    uint64_t numNodes = 1ull << 22;
+    uint64_t avgDegree = 8;
+    uint64_t numSources = 8;
+    uint8_t upperBound = 30;
+};
+
+struct Graph {
+    std::vector<uint64_t> csrOffsets;
+    std::vector<offset_t> nbrOffsets;
+};
+
+static Graph createGraph(const FrontierBenchmarkConfig& config) {
+    std::mt19937_64 rng{42};
+    std::uniform_int_distribution<offset_t> offsetDist{0, config.numNodes - 1};
+    Graph graph;
+    graph.csrOffsets.resize(config.numNodes + 1, 0);
+    std::vector<std::pair<offset_t, offset_t>> edges(config.numNodes * config.avgDegree);
+    for (auto& edge : edges) {
+        edge = {offsetDist(rng), offsetDist(rng)};
+        graph.csrOffsets[edge.first + 1]++;
+    }
+    for (auto i = 0u; i < config.numNodes; i++) {
+        graph.csrOffsets[i + 1] += graph.csrOffsets[i];
+    }
+    graph.nbrOffsets.resize(edges.size());
+    auto positions = graph.csrOffsets;
+    for (auto& [src, dst] : edges) {
+        graph.nbrOffsets[positions[src]++] = dst;
+    }
+    return graph;
+}
+
+static double getElapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+static void runBenchmark(bool isDense, const Graph& graph, const FrontierBenchmarkConfig& config) {
+    TargetDstNodes targetDstNodes(config.numNodes, frontier::node_id_set_t{});
+    ShortestPathState<true /* TRACK_PATH */> bfsState(config.upperBound, &targetDstNodes);
+    if (isDense) {
+        bfsState.enableDenseFrontiers(0 /* tableID */, config.numNodes);
+    }
+    std::mt19937_64 rng{7};
+    std::uniform_int_distribution<offset_t> offsetDist{0, config.numNodes - 1};
+    uint64_t numVisitedNodes = 0;
+    uint64_t checksum = 0;
+    double bfsTime = 0, scanTime = 0;
+    for (auto i = 0u; i < config.numSources; i++) {
+        auto start = std::chrono::steady_clock::now();
+        bfsState.resetState();
+        bfsState.markSrc(nodeID_t{offsetDist(rng), 0 /* tableID */});
+        while (!bfsState.isComplete()) {
+            auto boundNodeID = bfsState.getNextNodeID();
+            while (boundNodeID.offset != INVALID_OFFSET) {
+                for (auto j = graph.csrOffsets[boundNodeID.offset];
+                     j < graph.csrOffsets[boundNodeID.offset + 1]; j++) {
+                    bfsState.markVisited(boundNodeID, nodeID_t{graph.nbrOffsets[j], 0},
+                        relID_t{j, 1 /* tableID */}, 1 /* multiplicity */);
+                }
+                boundNodeID = bfsState.getNextNodeID();
+            }
+            bfsState.finalizeCurrentLevel();
+        }
+        bfsTime += getElapsedMilliseconds(start);
+        start = std::chrono::steady_clock::now();
+        for (auto level = 1u; level < bfsState.getNumFrontiers(); level++) {
+            auto frontier = bfsState.getFrontier(level);
+            for (auto& nodeID : frontier->nodeIDs) {
+                checksum += frontier->getBwdEdges(nodeID)[0].second.offset;
+            }
+            numVisitedNodes += frontier->nodeIDs.size();
+        }
+        scanTime += getElapsedMilliseconds(start);
+    }
+    printf("%-8s bfs: %9.2f ms  scan: %9.2f ms  visited: %lu  checksum: %lu\n",
+        isDense ? "DENSE" : "SPARSE", bfsTime, scanTime, numVisitedNodes, checksum);
+}
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+int main(int argc, char** argv) {
+    FrontierBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--nodes")) {
+            config.numNodes = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--degree")) {
+            config.avgDegree = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--sources")) {
+            config.numSources = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    auto graph = createGraph(config);
+    runBenchmark(false /* isDense */, graph, config);
+    runBenchmark(true /* isDense */, graph, config);
+    return 0;
+}
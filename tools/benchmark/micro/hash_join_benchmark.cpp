@@ -0,0 +1,135 @@
+// Compares building and probing a join hash table on node ID keys with the chained layout, where
+// tuples are inserted into the hash slots in the order they are stored and each key of a probe is
+// looked up one at a time, against the radix-partitioned build and the batched, prefetching probe.
+
+#include <chrono>
+#include <random>
+
+#include "common/file_system/virtual_file_system.h"
+#include "common/string_utils.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+
+struct HashJoinBenchmarkConfig {
+    uint64_t bufferPoolSize = 1ull << 30;
+    uint64_t numBuildTuples = 1ull << 22;
+    uint64_t numProbeTuples = 1ull << 24;
+};
+
+static std::unique_ptr<JoinHashTable> createHashTable(
+    MemoryManager& memoryManager, uint64_t numTuples) {
+    std::vector<std::unique_ptr<LogicalType>> keyTypes;
+    keyTypes.push_back(std::make_unique<LogicalType>(LogicalTypeID::INTERNAL_ID));
+    auto tableSchema = std::make_unique<FactorizedTableSchema>();
+    tableSchema->appendColumn(std::make_unique<ColumnSchema>(
+        false /* isUnFlat */, 0 /* dataChunkPos */, sizeof(internalID_t)));
+    tableSchema->appendColumn(std::make_unique<ColumnSchema>(
+        false /* isUnFlat */, 0 /* dataChunkPos */, sizeof(int64_t)));
+    // Prev pointer column.
+    tableSchema->appendColumn(std::make_unique<ColumnSchema>(
+        false /* isUnFlat */, INVALID_DATA_CHUNK_POS, sizeof(uint8_t*)));
+    auto hashTable = std::make_unique<JoinHashTable>(
+        memoryManager, std::move(keyTypes), std::move(tableSchema));
+    auto state = std::make_shared<DataChunkState>();
+    ValueVector keyVector(LogicalTypeID::INTERNAL_ID, &memoryManager);
+    ValueVector payloadVector(LogicalTypeID::INT64, &memoryManager);
+    keyVector.state = state;
+    payloadVector.state = state;
+    for (uint64_t offset = 0; offset < numTuples; offset += DEFAULT_VECTOR_CAPACITY) {
+        auto numTuplesToAppend = std::min(DEFAULT_VECTOR_CAPACITY, numTuples - offset);
+        state->initOriginalAndSelectedSize(numTuplesToAppend);
+        for (auto i = 0u; i < numTuplesToAppend; i++) {
+            keyVector.setValue<internalID_t>(i, internalID_t{offset + i, 0 /* tableID */});
+            payloadVector.setValue<int64_t>(i, offset + i);
+        }
+        hashTable->appendVectors({&keyVector}, {&payloadVector}, state.get());
+    }
+    return hashTable;
+}
+
+static double getElapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+static void runBenchmark(bool isPartitioned, const HashJoinBenchmarkConfig& config) {
+    VirtualFileSystem vfs;
+    BufferManager bm(config.bufferPoolSize);
+    MemoryManager memoryManager(&bm, &vfs);
+    auto hashTable = createHashTable(memoryManager, config.numBuildTuples);
+    auto start = std::chrono::steady_clock::now();
+    hashTable->allocateHashSlots(hashTable->getNumTuples());
+    if (isPartitioned) {
+        hashTable->buildHashSlotsByPartition();
+    } else {
+        hashTable->buildHashSlotsSequentially();
+    }
+    auto buildTime = getElapsedMilliseconds(start);
+
+    auto keyVector = std::make_unique<ValueVector>(LogicalTypeID::INTERNAL_ID, &memoryManager);
+    auto hashVector = std::make_unique<ValueVector>(LogicalTypeID::INT64, &memoryManager);
+    keyVector->state = std::make_shared<DataChunkState>();
+    std::vector<ValueVector*> keyVectors{keyVector.get()};
+    auto probedTuples = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    auto matchedTuples = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    SelectionVector matchedSelVector(DEFAULT_VECTOR_CAPACITY);
+    matchedSelVector.resetSelectorToValuePosBuffer();
+    std::mt19937_64 rng{42};
+    std::uniform_int_distribution<offset_t> offsetDist{0, config.numBuildTuples - 1};
+    uint64_t numMatches = 0;
+    double probeTime = 0;
+    for (uint64_t i = 0; i < config.numProbeTuples; i += DEFAULT_VECTOR_CAPACITY) {
+        auto numKeys = std::min(DEFAULT_VECTOR_CAPACITY, config.numProbeTuples - i);
+        keyVector->state->initOriginalAndSelectedSize(numKeys);
+        for (auto j = 0u; j < numKeys; j++) {
+            keyVector->setValue<internalID_t>(j, internalID_t{offsetDist(rng), 0 /* tableID */});
+        }
+        start = std::chrono::steady_clock::now();
+        if (isPartitioned) {
+            hashTable->probe(keyVectors, hashVector.get(), nullptr, probedTuples.get());
+        } else {
+            JoinHashTable::computeVectorHashes(keyVectors, hashVector.get(), nullptr);
+            for (auto j = 0u; j < numKeys; j++) {
+                probedTuples[j] = hashTable->getTupleForHash(hashVector->getValue<hash_t>(j));
+            }
+        }
+        numMatches += hashTable->matchUnFlatKey(
+            keyVector.get(), probedTuples.get(), matchedTuples.get(), &matchedSelVector);
+        probeTime += getElapsedMilliseconds(start);
+    }
+    printf("%-12s build: %9.2f ms  probe: %9.2f ms  (%6.2f ns/key)  matches: %lu\n",
+        isPartitioned ? "PARTITIONED" : "CHAINED", buildTime, probeTime,
+        probeTime * 1e6 / config.numProbeTuples, numMatches);
+}
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+int main(int argc, char** argv) {
+    HashJoinBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--bm-size")) {
+            config.bufferPoolSize = (uint64_t)stoull(getArgumentValue(arg)) << 20;
+        } else if (arg.starts_with("--build-tuples")) {
+            config.numBuildTuples = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--probe-tuples")) {
+            config.numProbeTuples = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    runBenchmark(false /* isPartitioned */, config);
+    runBenchmark(true /* isPartitioned */, config);
+    return 0;
+}
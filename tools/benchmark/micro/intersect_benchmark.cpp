@@ -0,0 +1,86 @@
+// Intersects random sorted adjacency lists with each intersect kernel available on this CPU, for
+// a few ratios between the sizes of the two lists. Reports the time per intersection.
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#include "common/constants.h"
+#include "common/string_utils.h"
+#include "processor/operator/intersect/intersect_kernels.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+struct IntersectBenchmarkConfig {
+    uint64_t leftSize = 64;
+    uint64_t numIterations = 100000;
+};
+
+static std::vector<nodeID_t> generateSortedList(std::mt19937_64& rng, uint64_t size) {
+    std::uniform_int_distribution<offset_t> dist(0, DEFAULT_VECTOR_CAPACITY * 16);
+    std::vector<nodeID_t> list(size);
+    for (auto& nodeID : list) {
+        nodeID = nodeID_t{dist(rng), 0 /* tableID */};
+    }
+    std::sort(list.begin(), list.end(),
+        [](const nodeID_t& a, const nodeID_t& b) { return a.offset < b.offset; });
+    return list;
+}
+
+static void runKernel(const std::string& name, IntersectKernels::intersect_func_t kernel,
+    const std::vector<nodeID_t>& left, const std::vector<nodeID_t>& right,
+    uint64_t numIterations) {
+    std::vector<sel_t> leftPositions(left.size()), rightPositions(left.size());
+    uint64_t numMatches = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (auto i = 0u; i < numIterations; i++) {
+        numMatches += kernel(left.data(), left.size(), right.data(), right.size(),
+            leftPositions.data(), rightPositions.data());
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+    printf("  %-10s %10.1f ns/intersection  (%lu matches)\n", name.c_str(),
+        elapsed / numIterations, numMatches / numIterations);
+}
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+int main(int argc, char** argv) {
+    IntersectBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--left")) {
+            config.leftSize = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--iterations")) {
+            config.numIterations = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    std::mt19937_64 rng(0);
+    for (auto ratio : {1u, 4u, 32u}) {
+        auto rightSize = std::min<uint64_t>(config.leftSize * ratio, DEFAULT_VECTOR_CAPACITY);
+        auto left = generateSortedList(rng, config.leftSize);
+        auto right = generateSortedList(rng, rightSize);
+        printf("left: %lu  right: %lu\n", left.size(), right.size());
+        runKernel("merge", IntersectKernels::mergeIntersect, left, right, config.numIterations);
+        runKernel("galloping", IntersectKernels::gallopingIntersect, left, right,
+            config.numIterations);
+        if (auto kernel = IntersectKernels::getAVX2Kernel()) {
+            runKernel("avx2", kernel, left, right, config.numIterations);
+        }
+        if (auto kernel = IntersectKernels::getAVX512Kernel()) {
+            runKernel("avx512", kernel, left, right, config.numIterations);
+        }
+        runKernel("dispatch", IntersectKernels::intersect, left, right, config.numIterations);
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Runs thousands of tiny queries from many connections at the same time, so the cost of handing
+// tasks to workers dominates over the work of each task. Every query has an aggregation and a scan
+// of its result, i.e. two dependent tasks. Reports the throughput and latency percentiles.
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+#include "common/string_utils.h"
+#include "main/kuzu.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+struct TaskSchedulerBenchmarkConfig {
+    uint64_t numThreads = std::thread::hardware_concurrency();
+    uint64_t numConnections = 16;
+    uint64_t numQueriesPerConnection = 1000;
+};
+
+static void runBenchmark(Database& database, const TaskSchedulerBenchmarkConfig& config) {
+    std::vector<std::vector<double>> latencies(config.numConnections);
+    std::vector<std::thread> clients;
+    auto start = std::chrono::steady_clock::now();
+    for (auto i = 0u; i < config.numConnections; i++) {
+        clients.emplace_back([&, i] {
+            Connection conn(&database);
+            latencies[i].reserve(config.numQueriesPerConnection);
+            for (auto j = 0u; j < config.numQueriesPerConnection; j++) {
+                auto queryStart = std::chrono::steady_clock::now();
+                auto result = conn.query("UNWIND range(1, 16) AS x RETURN count(*);");
+                if (!result->isSuccess()) {
+                    printf("Query failed: %s\n", result->getErrorMessage().c_str());
+                    return;
+                }
+                auto queryEnd = std::chrono::steady_clock::now();
+                latencies[i].push_back(
+                    std::chrono::duration<double, std::micro>(queryEnd - queryStart).count());
+            }
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    auto elapsedSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::vector<double> allLatencies;
+    for (auto& connectionLatencies : latencies) {
+        allLatencies.insert(
+            allLatencies.end(), connectionLatencies.begin(), connectionLatencies.end());
+    }
+    if (allLatencies.empty()) {
+        return;
+    }
+    std::sort(allLatencies.begin(), allLatencies.end());
+    auto getPercentile = [&](double percentile) {
+        return allLatencies[(uint64_t)(percentile * (allLatencies.size() - 1))];
+    };
+    printf("threads: %lu  connections: %lu  queries: %lu  throughput: %.0f queries/s\n",
+        config.numThreads, config.numConnections, allLatencies.size(),
+        allLatencies.size() / elapsedSeconds);
+    printf("latency p50: %.1f us  p99: %.1f us  max: %.1f us\n", getPercentile(0.5),
+        getPercentile(0.99), allLatencies.back());
+}
+
+static std::string getArgumentValue(const std::string& arg) {
+    auto splits = StringUtils::split(arg, "=");
+    if (splits.size() != 2) {
+        throw std::invalid_argument("Expect value associate with " + splits[0]);
+    }
+    return splits[1];
+}
+
+int main(int argc, char** argv) {
+    TaskSchedulerBenchmarkConfig config;
+    for (auto i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.starts_with("--threads")) {
+            config.numThreads = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--connections")) {
+            config.numConnections = stoull(getArgumentValue(arg));
+        } else if (arg.starts_with("--queries")) {
+            config.numQueriesPerConnection = stoull(getArgumentValue(arg));
+        } else {
+            printf("Unrecognized option %s", arg.c_str());
+            return 1;
+        }
+    }
+    auto databasePath = std::filesystem::temp_directory_path() / "kuzu_task_scheduler_benchmark";
+    std::filesystem::remove_all(databasePath);
+    {
+        Database database(databasePath.string(), SystemConfig(1ull << 30, config.numThreads));
+        runBenchmark(database, config);
+    }
+    std::filesystem::remove_all(databasePath);
+    return 0;
+}